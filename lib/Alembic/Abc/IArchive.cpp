@@ -142,6 +142,19 @@ int32_t IArchive::getArchiveVersion( )
     return 0;
 }
 
+//-*****************************************************************************
+uint32_t IArchive::getDataAlignment()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getDataAlignment" );
+
+    return m_archive->getDataAlignment();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return 0;
+}
+
 //-*****************************************************************************
 void IArchive::setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
 {
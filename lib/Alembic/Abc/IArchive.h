@@ -178,6 +178,11 @@ public:
     //! of this archive file.
     int32_t getArchiveVersion();
 
+    //! Returns the alignment, in bytes from the start of the file, that the
+    //! numeric sample data of this archive was written with, 0 if it wasn't
+    //! aligned.
+    uint32_t getDataAlignment();
+
     //! The unspecified-bool-type operator casts the object to "true"
     //! if it is valid, and "false" otherwise.
     ALEMBIC_OPERATOR_BOOL( valid() );
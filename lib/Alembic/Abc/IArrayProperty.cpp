@@ -154,6 +154,21 @@ void IArrayProperty::getAs( void * oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void IArrayProperty::getRange( void * oSample,
+                               size_t iFirstElement,
+                               size_t iCount,
+                               const ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getRange()" );
+
+    m_property->getSampleRange( iSS.getIndex( m_property->getTimeSampling(),
+                                              m_property->getNumSamples() ),
+                                iFirstElement, iCount, oSample );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 bool IArrayProperty::getKey( AbcA::ArraySampleKey& oKey,
                              const ISampleSelector &iSS ) const
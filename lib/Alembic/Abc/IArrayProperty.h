@@ -137,6 +137,13 @@ public:
     void getAs( void *oSample,
                 const ISampleSelector &iSS = ISampleSelector() );
 
+    //! Get iCount elements of a sample, starting with element iFirstElement,
+    //! into the address of a datum, without reading the rest of the sample
+    //! where the underlying implementation allows it.  Strings are copied
+    //! into oSample as std::string or std::wstring, like get does.
+    void getRange( void *oSample, size_t iFirstElement, size_t iCount,
+                   const ISampleSelector &iSS = ISampleSelector() ) const;
+
     //! Get a key from an address of a datum.
     //! ...
     bool getKey( AbcA::ArraySampleKey& oKey,
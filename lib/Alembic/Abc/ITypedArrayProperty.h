@@ -198,6 +198,19 @@ public:
                                                   AbcA::ArraySample>( ptr );
     }
 
+    using IArrayProperty::getRange;
+
+    //! Get iCount elements of a sample, starting with element iFirstElement,
+    //! as a typed sample of their own.
+    void getRange( sample_ptr_type& oVal, size_t iFirstElement, size_t iCount,
+                   const ISampleSelector &iSS = ISampleSelector() ) const
+    {
+        value_type *data = new value_type[iCount];
+        oVal.reset( new sample_type( data, iCount ),
+                    AbcA::TArrayDeleter<value_type>() );
+        IArrayProperty::getRange( data, iFirstElement, iCount, iSS );
+    }
+
     //! Return the typed sample by value.
     //! ...
     sample_ptr_type getValue( const ISampleSelector &iSS = ISampleSelector() ) const
@@ -133,6 +133,40 @@ uint32_t OArchive::getNumTimeSamplings()
     return 0;
 }
 
+//-*****************************************************************************
+void OArchive::flush()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArchive::flush" );
+
+    m_archive->flush();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void OArchive::enableWriteProfile( const std::string & iFileName )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArchive::enableWriteProfile" );
+
+    m_archive->enableWriteProfile( iFileName );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+AbcA::WriteProfile OArchive::getWriteProfile()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArchive::getWriteProfile" );
+
+    return m_archive->getWriteProfile();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw,
+    // so return a NO-OP value
+    return AbcA::WriteProfile();
+}
+
 //-*****************************************************************************
 OObject OArchive::getTop()
 {
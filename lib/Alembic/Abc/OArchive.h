@@ -157,6 +157,20 @@ public:
     //! TimeSampling pool.
     uint32_t getNumTimeSamplings();
 
+    //! Blocks until every sample set so far has been written.  If the archive
+    //! writes samples asynchronously, any errors it hit while doing so are
+    //! reported here, so call this before letting go of such an archive.
+    void flush();
+
+    //! Start profiling where the time and bytes spent writing this archive
+    //! go, optionally writing the profile to iFileName as JSON when the
+    //! archive is closed.  See AbcA::ArchiveWriter::enableWriteProfile.
+    void enableWriteProfile( const std::string & iFileName = "" );
+
+    //! The profile of what has been written so far, its toJSON gives it
+    //! as JSON.
+    AbcA::WriteProfile getWriteProfile();
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, rewrapping,
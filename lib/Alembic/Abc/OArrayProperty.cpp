@@ -78,6 +78,16 @@ void OArrayProperty::set( const AbcA::ArraySample &iSamp )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void OArrayProperty::set( AbcA::ArraySamplePtr iSamp )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::set()" );
+
+    m_property->setSample( iSamp );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void OArrayProperty::setFromPrevious()
 {
@@ -111,6 +111,11 @@ public:
     //! ...
     void set( const AbcA::ArraySample &iSample );
 
+    //! Set a sample, sharing ownership of it with the archive, which is
+    //! then free to hold on to it instead of copying it. The data must not
+    //! be changed after this call.
+    void set( AbcA::ArraySamplePtr iSample );
+
     //! Set a sample from the previous sample.
     //! ...
     void setFromPrevious( );
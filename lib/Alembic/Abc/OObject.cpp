@@ -126,6 +126,19 @@ OObject OObject::getParent()
     return OObject();
 }
 
+//-*****************************************************************************
+void OObject::finalize()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OObject::finalize()" );
+
+    if ( m_object )
+    {
+        m_object->finalize();
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 size_t OObject::getNumChildren()
 {
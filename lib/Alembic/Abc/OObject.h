@@ -208,6 +208,14 @@ public:
     //!-************************************************************************
     bool addChildInstance( OObject iTarget, const std::string& iName );
 
+    //! Write this object out now and let go of what was being held for it,
+    //! rather than waiting for it to be deleted, which keeps the memory
+    //! used by big exports down. Its properties must already have been let
+    //! go of, and its children let go of or finalized. This OObject stays
+    //! valid, but no properties or children can be added to it afterwards.
+    //! See AbcA::ObjectWriter::finalize.
+    void finalize();
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, rewrapping,
@@ -142,6 +142,10 @@ public:
     //! state.
     void reset() { m_schema.reset(); OObject::reset(); }
 
+    //! Lets go of the schema, and then finalizes the object.
+    //! See OObject::finalize.
+    void finalize() { m_schema.reset(); OObject::finalize(); }
+
     //! Valid returns whether this function set is
     //! valid.
     bool valid() const
@@ -165,6 +165,22 @@ public:
         OArrayProperty::set( iVal );
     }
 
+    //! Set a sample that the archive may hold on to instead of copying
+    //! See OArrayProperty::set( AbcA::ArraySamplePtr )
+    void set( Alembic::Util::shared_ptr<sample_type> iVal )
+    {
+        OArrayProperty::set( AbcA::ArraySamplePtr( iVal ) );
+    }
+
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+    //! Set a sample by moving the values into it, so that they don't need
+    //! to be copied if the archive holds on to them
+    void set( typename sample_type::value_vector && iVals )
+    {
+        set( sample_type::ownedSample( std::move( iVals ) ) );
+    }
+#endif
+
 private:
 
     void init( AbcA::CompoundPropertyWriterPtr iParent,
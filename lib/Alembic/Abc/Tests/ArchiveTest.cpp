@@ -39,6 +39,10 @@
 #include <Alembic/Abc/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
 #ifdef ALEMBIC_WITH_HDF5
 #include <Alembic/AbcCoreHDF5/All.h>
 #endif
@@ -230,10 +234,67 @@ void scopingTest(bool useOgawa)
     }
 }
 
+//-*****************************************************************************
+void writeProfileTest()
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "writeProfile.abc" );
+
+        // nothing is measured until it is asked for
+        TESTING_ASSERT( archive.getWriteProfile().phases.empty() );
+
+        archive.enableWriteProfile( "writeProfile.json" );
+
+        OObject obj( archive.getTop(), "obj" );
+        OFloatArrayProperty big( obj.getProperties(), "big" );
+        OInt32Property small( obj.getProperties(), "small" );
+
+        std::vector< float > vals( 1000 );
+        for ( int32_t i = 0; i < 6; ++i )
+        {
+            // every other sample is the same as one written before
+            std::fill( vals.begin(), vals.end(), ( float )( i % 2 ) );
+            big.set( FloatArraySample( vals ) );
+            small.set( i );
+        }
+
+        AbcA::WriteProfile profile = archive.getWriteProfile();
+        TESTING_ASSERT( profile.phases.size() == 5 );
+        TESTING_ASSERT( profile.phases[0].name == "hash" );
+        TESTING_ASSERT( profile.phases[0].count == 12 );
+        TESTING_ASSERT( profile.phases[0].bytes ==
+                        6 * ( 1000 * sizeof( float ) + sizeof( int32_t ) ) );
+        TESTING_ASSERT( profile.phases[2].name == "write" );
+        TESTING_ASSERT( profile.phases[2].bytes > 2000 * sizeof( float ) );
+
+        // the last 4 big samples are found among those already written
+        TESTING_ASSERT( profile.numDedupHits >= 4 );
+        TESTING_ASSERT( profile.getDedupHitRate() > 0.0 );
+        TESTING_ASSERT( profile.dedupBytesSaved >=
+                        4 * 1000 * sizeof( float ) );
+        TESTING_ASSERT( !profile.closed );
+
+        // properties are only accounted for once they are done
+        TESTING_ASSERT( profile.largestProperties.empty() );
+    }
+
+    std::ifstream file( "writeProfile.json" );
+    std::string json( ( std::istreambuf_iterator< char >( file ) ),
+                      std::istreambuf_iterator< char >() );
+    TESTING_ASSERT( json.find( "\"closed\": true" ) != std::string::npos );
+    TESTING_ASSERT( json.find( "\"largestProperties\": [\n"
+                               "    { \"path\": \"/obj:big\"" ) !=
+                    std::string::npos );
+    TESTING_ASSERT( json.find( "\"/obj:small\"" ) != std::string::npos );
+    TESTING_ASSERT( json.find( "\"headers\"" ) != std::string::npos );
+}
+
 int main( int argc, char *argv[] )
 {
     archiveInfoTest(true);
     scopingTest(true);
+    writeProfileTest();
 
 #ifdef ALEMBIC_WITH_HDF5
     archiveInfoTest(false);
@@ -690,12 +690,155 @@ void emptyAndValueTest(const std::string &archiveName, bool useOgawa)
 }
 
 
+//-*****************************************************************************
+// keeps the vector a V3fArraySample points into alive until it is deleted
+struct VectorOwner
+{
+    void operator()( V3fArraySample *iSamp ) { delete iSamp; vec.reset(); }
+    Alembic::Util::shared_ptr< std::vector<V3f> > vec;
+};
+
+//-*****************************************************************************
+// Hands samples over to an asynchronous Ogawa archive, dropping every other
+//  reference to them right away, and makes sure they are read back intact
+void ownedSampleTest(const std::string &archiveName)
+{
+    {
+        Alembic::AbcCoreOgawa::WriteArchive writer;
+        writer.setAsyncWrites( 2 );
+        OArchive archive( writer, archiveName );
+        OObject child( archive.getTop(), "owned" );
+        OV3fArrayProperty vecs( child.getProperties(), "vecs" );
+        OStringArrayProperty strs( child.getProperties(), "strs" );
+
+        for ( std::size_t i = 0; i < 5; ++i )
+        {
+            std::vector<V3f> vecVals( g_vectors, g_vectors + i + 1 );
+            std::vector<std::string> strVals( i + 1, "owned" );
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+            if ( i % 2 == 0 )
+            {
+                vecs.set( std::move( vecVals ) );
+                strs.set( std::move( strVals ) );
+                continue;
+            }
+#endif
+            VectorOwner owner;
+            owner.vec.reset( new std::vector<V3f>( vecVals ) );
+            vecs.set( V3fArraySamplePtr( new V3fArraySample( *owner.vec ),
+                                         owner ) );
+            strs.set( StringArraySample( strVals ) );
+        }
+    }
+
+    AbcF::IFactory factory;
+    IArchive archive = factory.getArchive( archiveName );
+    IObject child( archive.getTop(), "owned" );
+    IV3fArrayProperty vecs( child.getProperties(), "vecs" );
+    IStringArrayProperty strs( child.getProperties(), "strs" );
+    TESTING_ASSERT( vecs.getNumSamples() == 5 );
+    TESTING_ASSERT( strs.getNumSamples() == 5 );
+
+    for ( std::size_t i = 0; i < 5; ++i )
+    {
+        V3fArraySamplePtr vecSamp = vecs.getValue( i );
+        StringArraySamplePtr strSamp = strs.getValue( i );
+        TESTING_ASSERT( vecSamp->size() == i + 1 );
+        TESTING_ASSERT( strSamp->size() == i + 1 );
+        for ( std::size_t j = 0; j <= i; ++j )
+        {
+            TESTING_ASSERT( (*vecSamp)[j] == g_vectors[j] );
+            TESTING_ASSERT( (*strSamp)[j] == "owned" );
+        }
+    }
+}
+
+//-*****************************************************************************
+// Reads ranges of samples, without reading the whole samples
+void rangeTest(const std::string &archiveName, bool useOgawa)
+{
+    {
+        OArchive archive;
+        if (useOgawa)
+        {
+            archive = OArchive( Alembic::AbcCoreOgawa::WriteArchive(),
+                archiveName );
+        }
+#ifdef ALEMBIC_WITH_HDF5
+        else
+        {
+            archive = OArchive( Alembic::AbcCoreHDF5::WriteArchive(),
+                archiveName );
+        }
+#endif
+
+        OCompoundProperty root = archive.getTop().getProperties();
+        OV3fArrayProperty vecs( root, "vecs" );
+        OUInt32ArrayProperty nums( root, "nums" );
+        OStringArrayProperty strs( root, "strs" );
+
+        vecs.set( V3fArraySample( g_vectors, 5 ) );
+        vecs.set( V3fArraySample( g_vectors, 3 ) );
+        nums.set( UInt32ArraySample( g_primes, 5 ) );
+
+        std::vector<std::string> strVals;
+        strVals.push_back( "a" );
+        strVals.push_back( "bb" );
+        strVals.push_back( "ccc" );
+        strs.set( strVals );
+    }
+
+    AbcF::IFactory factory;
+    IArchive archive = factory.getArchive( archiveName );
+    ICompoundProperty root = archive.getTop().getProperties();
+    IV3fArrayProperty vecs( root, "vecs" );
+    IUInt32ArrayProperty nums( root, "nums" );
+    IStringArrayProperty strs( root, "strs" );
+
+    V3fArraySamplePtr vecSamp;
+    vecs.getRange( vecSamp, 1, 3 );
+    TESTING_ASSERT( vecSamp->size() == 3 );
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        TESTING_ASSERT( (*vecSamp)[i] == g_vectors[i + 1] );
+    }
+
+    vecs.getRange( vecSamp, 2, 1, ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( vecSamp->size() == 1 && (*vecSamp)[0] == g_vectors[2] );
+
+    vecs.getRange( vecSamp, 3, 0, ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( vecSamp->size() == 0 );
+
+    uint32_t numVals[2] = { 0, 0 };
+    nums.getRange( numVals, 3, 2 );
+    TESTING_ASSERT( numVals[0] == g_primes[3] && numVals[1] == g_primes[4] );
+
+    StringArraySamplePtr strSamp;
+    strs.getRange( strSamp, 1, 2 );
+    TESTING_ASSERT( strSamp->size() == 2 );
+    TESTING_ASSERT( (*strSamp)[0] == "bb" && (*strSamp)[1] == "ccc" );
+
+    // past the end of the sample
+    TESTING_ASSERT_THROW( vecs.getRange( vecSamp, 2, 2,
+        ISampleSelector( ( index_t ) 1 ) ), Alembic::Util::Exception );
+    TESTING_ASSERT_THROW( nums.getRange( numVals, 4, 2 ),
+                          Alembic::Util::Exception );
+    TESTING_ASSERT_THROW( strs.getRange( strSamp, 3, 1 ),
+                          Alembic::Util::Exception );
+}
+
 int main( int argc, char *argv[] )
 {
     // Write and read a simple archive: one child, with one array
     //  property
     bool useOgawa = true;
 
+    ownedSampleTest( "owned_array_test.abc" );
+    rangeTest( "range_array_test.abc", true );
+#ifdef ALEMBIC_WITH_HDF5
+    rangeTest( "range_array_test.abc", false );
+#endif
+
     try
     {
         // An array of v3fs, written with uniform sampling, some of which
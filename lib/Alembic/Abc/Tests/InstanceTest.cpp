@@ -415,6 +415,92 @@ void diabolicalInstance( const std::string& iArchiveName, bool useOgawa )
 
 }
 
+//-*****************************************************************************
+static void writeBranch( OObject iParent, const std::string& iName,
+                         Alembic::Util::int32_t iValue )
+{
+    OObject branch( iParent, iName );
+    OObject x( branch, "x" );
+    OInt32Property( x.getProperties(), "v" ).set( iValue );
+    OObject y( x, "y" );
+    OInt32Property( y.getProperties(), "v" ).set( 2 );
+}
+
+//-*****************************************************************************
+void identicalObjectsTest( const std::string& iArchiveName )
+{
+    {
+        Alembic::AbcCoreOgawa::WriteArchive writer;
+        writer.setInstanceIdenticalObjects( true );
+        OArchive archive( writer, iArchiveName, ErrorHandler::kThrowPolicy );
+        OObject topObject = archive.getTop();
+
+        writeBranch( topObject, "a", 1 );
+        writeBranch( topObject, "b", 1 );
+        writeBranch( topObject, "c", 5 );
+
+        // q/e is written first, so p/e becomes an instance of it, which
+        // means q has to stay as it is even though p is identical to it
+        OObject p( topObject, "p" );
+        OObject q( topObject, "q" );
+        {
+            OObject e( q, "e" );
+            OInt32Property( e.getProperties(), "v" ).set( 7 );
+        }
+        {
+            OObject e( p, "e" );
+            OInt32Property( e.getProperties(), "v" ).set( 7 );
+        }
+        p.reset();
+        q.reset();
+
+        // nothing to be gained from instancing empty objects
+        OObject( topObject, "empty1" );
+        OObject( topObject, "empty2" );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iArchiveName,
+                      ErrorHandler::kThrowPolicy );
+    IObject topObject = archive.getTop();
+    TESTING_ASSERT( topObject.getNumChildren() == 7 );
+
+    IObject a( topObject, "a" );
+    TESTING_ASSERT( !a.isInstanceRoot() );
+    TESTING_ASSERT( !IObject( a, "x" ).isInstanceRoot() );
+
+    IObject b( topObject, "b" );
+    TESTING_ASSERT( b.isInstanceRoot() );
+    TESTING_ASSERT( b.instanceSourcePath() == "/a" );
+    TESTING_ASSERT( b.getFullName() == "/b" );
+    IObject bx = b.getChild( "x" );
+    TESTING_ASSERT( bx.isInstanceDescendant() );
+    TESTING_ASSERT( bx.getFullName() == "/b/x" );
+    TESTING_ASSERT( IInt32Property( bx.getProperties(), "v" ).getValue() == 1 );
+    IObject bxy( bx, "y" );
+    TESTING_ASSERT(
+        IInt32Property( bxy.getProperties(), "v" ).getValue() == 2 );
+
+    IObject c( topObject, "c" );
+    TESTING_ASSERT( !c.isInstanceRoot() );
+    IObject cx( c, "x" );
+    TESTING_ASSERT( !cx.isInstanceRoot() );
+    TESTING_ASSERT( IInt32Property( cx.getProperties(), "v" ).getValue() == 5 );
+    IObject cxy( cx, "y" );
+    TESTING_ASSERT( cxy.isInstanceRoot() );
+    TESTING_ASSERT( cxy.instanceSourcePath() == "/a/x/y" );
+
+    IObject p( topObject, "p" );
+    TESTING_ASSERT( !p.isInstanceRoot() );
+    IObject pe( p, "e" );
+    TESTING_ASSERT( pe.isInstanceRoot() );
+    TESTING_ASSERT( pe.instanceSourcePath() == "/q/e" );
+    TESTING_ASSERT( IInt32Property( pe.getProperties(), "v" ).getValue() == 7 );
+    TESTING_ASSERT( !IObject( topObject, "q" ).isInstanceRoot() );
+
+    TESTING_ASSERT( !IObject( topObject, "empty1" ).isInstanceRoot() );
+    TESTING_ASSERT( !IObject( topObject, "empty2" ).isInstanceRoot() );
+}
+
 //-*****************************************************************************
 int main( int argc, char* argv[] )
 {
@@ -428,6 +514,7 @@ int main( int argc, char* argv[] )
     simpleTestOut( oarkhive, useOgawa );
     simpleTestIn( oarkhive );
     diabolicalInstance( oarkhive2, useOgawa );
+    identicalObjectsTest( "identical.instancetest_ogawa.abc" );
 
 #ifdef ALEMBIC_WITH_HDF5
     useOgawa = false;
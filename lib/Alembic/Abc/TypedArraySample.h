@@ -138,9 +138,37 @@ public:
         return TypedArraySample<TRAITS>( NULL, 0 );
     }
 
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+    //! Moves the contents of iVec into a new sample which owns them, so it
+    //! can be handed to OTypedArrayProperty::set without being copied.
+    static Alembic::Util::shared_ptr<this_type>
+    ownedSample( value_vector && iVec )
+    {
+        Alembic::Util::shared_ptr<value_vector> vec(
+            new value_vector( std::move( iVec ) ) );
+        return Alembic::Util::shared_ptr<this_type>(
+            new this_type( *vec ), VectorDeleter( vec ) );
+    }
+#endif
+
     //-*************************************************************************
     ALEMBIC_OPERATOR_BOOL( ArraySample::valid() );
 
+private:
+    // deletes the sample and lets go of the vector it points into
+    struct VectorDeleter
+    {
+        VectorDeleter( Alembic::Util::shared_ptr<value_vector> iVec )
+          : m_vec( iVec ) {}
+
+        void operator()( this_type *iSample )
+        {
+            delete iSample;
+            m_vec.reset();
+        }
+
+        Alembic::Util::shared_ptr<value_vector> m_vec;
+    };
 };
 
 //-*****************************************************************************
@@ -61,6 +61,7 @@
 #include <Alembic/AbcCoreAbstract/ScalarSample.h>
 #include <Alembic/AbcCoreAbstract/TimeSampling.h>
 #include <Alembic/AbcCoreAbstract/TimeSamplingType.h>
+#include <Alembic/AbcCoreAbstract/WriteProfile.h>
 
 #endif
 
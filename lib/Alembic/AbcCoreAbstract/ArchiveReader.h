@@ -123,6 +123,11 @@ public:
     //! of this archive file.
     virtual int32_t getArchiveVersion() = 0;
 
+    //! The alignment, in bytes from the start of the file, that the numeric
+    //! sample data of this archive was written with, 0 if it wasn't aligned.
+    //! Implementations that don't align anything return 0.
+    virtual uint32_t getDataAlignment();
+
     //! Return self
     //! ...
     virtual ArchiveReaderPtr asArchivePtr() = 0;
@@ -46,6 +46,24 @@ ArchiveWriter::~ArchiveWriter()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArchiveWriter::flush()
+{
+    // Nothing
+}
+
+//-*****************************************************************************
+void ArchiveWriter::enableWriteProfile( const std::string & iFileName )
+{
+    // Nothing
+}
+
+//-*****************************************************************************
+WriteProfile ArchiveWriter::getWriteProfile()
+{
+    return WriteProfile();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -41,6 +41,7 @@
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/MetaData.h>
 #include <Alembic/AbcCoreAbstract/ForwardDeclarations.h>
+#include <Alembic/AbcCoreAbstract/WriteProfile.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -139,6 +140,24 @@ public:
     virtual void setMaxNumSamplesForTimeSamplingIndex( uint32_t iIndex,
                                                        index_t iMaxIndex ) = 0;
 
+    //! Block until every sample that has been set so far has actually been
+    //! written.  Implementations which write samples in the background
+    //! report any errors they ran into while doing so here, for everyone
+    //! else this does nothing.
+    virtual void flush();
+
+    //! Start keeping track of where the time and bytes spent writing this
+    //! archive go, see WriteProfile.  Only what is written from then on is
+    //! counted, so this should be called before anything else is written.
+    //! If iFileName isn't empty the profile is written to it as JSON once
+    //! the archive is closed, which is the only way to see how long closing
+    //! took.  Implementations which can't profile ignore this.
+    virtual void enableWriteProfile( const std::string & iFileName );
+
+    //! The profile of what has been written so far, empty unless
+    //! enableWriteProfile has been called.
+    virtual WriteProfile getWriteProfile();
+
 private:
     int8_t m_compressionHint;
 };
@@ -36,6 +36,9 @@
 
 #include <Alembic/AbcCoreAbstract/ArrayPropertyReader.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
@@ -46,6 +49,45 @@ ArrayPropertyReader::~ArrayPropertyReader()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyReader::getSampleRange( index_t iSampleIndex,
+                                          size_t iFirstElement,
+                                          size_t iCount,
+                                          void *oData )
+{
+    ArraySamplePtr sample;
+    getSample( iSampleIndex, sample );
+
+    ABCA_ASSERT( iFirstElement + iCount <= sample->size(),
+                 "Range " << iFirstElement << " + " << iCount <<
+                 " is past the end of sample " << iSampleIndex <<
+                 " of size " << sample->size() );
+
+    const DataType & dataType = getDataType();
+    size_t first = iFirstElement * dataType.getExtent();
+    size_t count = iCount * dataType.getExtent();
+
+    if ( dataType.getPod() == kStringPOD )
+    {
+        const std::string * data =
+            static_cast< const std::string * >( sample->getData() ) + first;
+        std::copy( data, data + count, static_cast< std::string * >( oData ) );
+    }
+    else if ( dataType.getPod() == kWstringPOD )
+    {
+        const std::wstring * data =
+            static_cast< const std::wstring * >( sample->getData() ) + first;
+        std::copy( data, data + count,
+                   static_cast< std::wstring * >( oData ) );
+    }
+    else if ( count > 0 )
+    {
+        size_t podBytes = PODNumBytes( dataType.getPod() );
+        memcpy( oData, static_cast< const char * >( sample->getData() ) +
+                first * podBytes, count * podBytes );
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
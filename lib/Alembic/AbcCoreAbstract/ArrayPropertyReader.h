@@ -141,6 +141,20 @@ public:
     //! and std::wstring as core language-level primitives.
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         PlainOldDataType iPod ) = 0;
+
+    //! Reads iCount elements of sample iSampleIndex, starting with element
+    //! iFirstElement, into oData as the POD type of this property, without
+    //! reading the rest of the sample where the implementation allows it.
+    //! An element is one value of the DataType, with all of its extent, so
+    //! oData has to be big enough for iCount of them (and for String and
+    //! Wstring, be an array of std::string or std::wstring).
+    //! Ranges past the end of the sample cause an exception to be thrown.
+    //!
+    //! This isn't pure, so implementations that can't do any better than
+    //! reading the whole sample don't have to.
+    virtual void getSampleRange( index_t iSampleIndex,
+                                 size_t iFirstElement, size_t iCount,
+                                 void *oData );
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -46,6 +46,13 @@ ArrayPropertyWriter::~ArrayPropertyWriter()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyWriter::setSample( ArraySamplePtr iSamp )
+{
+    ABCA_ASSERT( iSamp, "Invalid ArraySamplePtr" );
+    setSample( *iSamp );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -75,6 +75,14 @@ public:
     //! treated just like regular data elements.
     virtual void setSample( const ArraySample & iSamp ) = 0;
 
+    //! Sets a sample, taking shared ownership of it
+    //!
+    //! The data iSamp points at must not be changed after this call, the
+    //! class may hold on to it, instead of making its own copy, until the
+    //! sample has been written.  The default implementation calls the
+    //! const reference version above.
+    virtual void setSample( ArraySamplePtr iSamp );
+
     //! Set the next sample to equal the previous sample.
     //! An important feature!
     virtual void setFromPreviousSample() = 0;
@@ -36,13 +36,100 @@
 
 #include <Alembic/AbcCoreAbstract/ArraySample.h>
 #include <Alembic/Util/Murmur3.h>
+#include <Alembic/Util/SpookyV2.h>
+#include <Alembic/Util/Threads.h>
+
+#include <algorithm>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// hashes chunks [begin, end) of a buffer, each into its own digest
+struct ChunkHasher
+{
+    const uint8_t * data;
+    size_t numBytes;
+    size_t podSize;
+    Digest * digests;
+    size_t begin;
+    size_t end;
+
+    void run() const
+    {
+        for ( size_t i = begin; i < end; ++i )
+        {
+            size_t offset = i * kSampleKeyChunkSize;
+            size_t len = std::min( numBytes - offset,
+                                   ( size_t ) kSampleKeyChunkSize );
+            MurmurHash3_x64_128( data + offset, len, podSize,
+                                 digests[i].words );
+        }
+    }
+};
+
+//-*****************************************************************************
+// The kChunkedSampleKey digest, chunks are spread evenly over up to
+// iNumThreads threads (including this one).
+void ChunkedDigest( const void * iData, size_t iNumBytes, size_t iPodSize,
+                    size_t iNumThreads, Digest & oDigest )
+{
+    size_t numChunks = ( iNumBytes + kSampleKeyChunkSize - 1 ) /
+        kSampleKeyChunkSize;
+
+    if ( numChunks <= 1 )
+    {
+        MurmurHash3_x64_128( iData, iNumBytes, iPodSize, oDigest.words );
+        return;
+    }
+
+    std::vector< Digest > digests( numChunks );
+
+    size_t numThreads = std::min( std::max( iNumThreads, ( size_t ) 1 ),
+                                  numChunks );
+    std::vector< ChunkHasher > hashers( numThreads );
+    for ( size_t i = 0; i < numThreads; ++i )
+    {
+        hashers[i].data = static_cast< const uint8_t * >( iData );
+        hashers[i].numBytes = iNumBytes;
+        hashers[i].podSize = iPodSize;
+        hashers[i].digests = &digests.front();
+        hashers[i].begin = ( numChunks * i ) / numThreads;
+        hashers[i].end = ( numChunks * ( i + 1 ) ) / numThreads;
+    }
+
+    Util::RunWorkers( hashers );
+
+    uint64_t hash1 = 0;
+    uint64_t hash2 = 0;
+    Util::SpookyHash::Hash128( &digests.front(),
+                               numChunks * sizeof( Digest ), &hash1, &hash2 );
+    oDigest.words[0] = hash1;
+    oDigest.words[1] = hash2;
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 ArraySample::Key ArraySample::getKey() const
+{
+    std::vector< uint8_t > packed;
+    return getKey( packed );
+}
+
+//-*****************************************************************************
+ArraySample::Key ArraySample::getKey( std::vector< uint8_t > & oPacked ) const
+{
+    return getKey( oPacked, kMurmur3SampleKey, 1 );
+}
+
+//-*****************************************************************************
+ArraySample::Key ArraySample::getKey( std::vector< uint8_t > & oPacked,
+                                      ArraySampleKeyType iKeyType,
+                                      std::size_t iNumThreads ) const
 {
 
     // Depending on data type, loop over everything.
@@ -54,6 +141,9 @@ ArraySample::Key ArraySample::getKey() const
     k.numBytes = numBytes;
     k.origPOD = m_dataType.getPod();
     k.readPOD = k.origPOD;
+    k.keyType = iKeyType;
+
+    oPacked.clear();
 
     switch ( m_dataType.getPod() )
     {
@@ -70,60 +160,103 @@ ArraySample::Key ArraySample::getKey() const
     case kFloat32POD:
     case kFloat64POD:
     {
-        MurmurHash3_x64_128( m_data, numBytes, PODNumBytes(m_dataType.getPod()),
-            k.digest.words );
+        if ( iKeyType == kChunkedSampleKey )
+        {
+            ChunkedDigest( m_data, numBytes,
+                PODNumBytes( m_dataType.getPod() ), iNumThreads, k.digest );
+        }
+        else
+        {
+            MurmurHash3_x64_128( m_data, numBytes,
+                PODNumBytes( m_dataType.getPod() ), k.digest.words );
+        }
     }
     break;
 
     case kStringPOD:
     {
-        std::vector <int8_t> v;
+        const std::string * strs = static_cast<const std::string*>( m_data );
+
+        // size it exactly, each string plus its NULL seperator character
+        size_t numChars = numPods;
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::string &str =
-                static_cast<const std::string*>( m_data )[j];
+            numChars += strs[j].length();
+        }
 
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
+        oPacked.resize( numChars );
+        size_t pos = 0;
+        for ( size_t j = 0; j < numPods; ++j )
+        {
+            size_t strLen = strs[j].length();
+            if ( strLen != 0 )
             {
-                v.push_back(str[k]);
+                memcpy( &oPacked[pos], strs[j].data(), strLen );
             }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
+            pos += strLen;
+            oPacked[pos++] = 0;
         }
 
-        int8_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
+        uint8_t * vptr = NULL;
+        if ( !oPacked.empty() )
+            vptr = &(oPacked.front());
 
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int8_t), k.digest.words );
+        if ( iKeyType == kChunkedSampleKey )
+        {
+            ChunkedDigest( vptr, oPacked.size(), sizeof(int8_t), iNumThreads,
+                           k.digest );
+        }
+        else
+        {
+            MurmurHash3_x64_128( vptr, oPacked.size(), sizeof(int8_t),
+                k.digest.words );
+        }
     }
     break;
 
     case kWstringPOD:
     {
-        std::vector <int32_t> v;
+        const std::wstring * wstrs =
+            static_cast<const std::wstring*>( m_data );
+
+        size_t numChars = numPods;
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::wstring &wstr =
-                static_cast<const std::wstring*>( m_data )[j];
+            numChars += wstrs[j].length();
+        }
 
+        // wchar_t isn't always 32 bits, so copy character by character
+        oPacked.resize( numChars * sizeof(int32_t) );
+        int32_t * vptr = NULL;
+        if ( !oPacked.empty() )
+            vptr = reinterpret_cast< int32_t * >( &(oPacked.front()) );
+
+        size_t pos = 0;
+        for ( size_t j = 0; j < numPods; ++j )
+        {
+            const std::wstring &wstr = wstrs[j];
             size_t wlen = wstr.length();
-            for (size_t k = 0; k < wlen; ++k)
+            for ( size_t k = 0; k < wlen; ++k )
             {
-                v.push_back(wstr[k]);
+                vptr[pos++] = wstr[k];
             }
 
             // append a 0 for the NULL seperator character
-            v.push_back(0);
+            vptr[pos++] = 0;
         }
 
-        int32_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
-
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int32_t), k.digest.words );
+        // the original key only hashes the first numChars bytes, chunked
+        // keys hash all of them
+        if ( iKeyType == kChunkedSampleKey )
+        {
+            ChunkedDigest( vptr, oPacked.size(), sizeof(int32_t), iNumThreads,
+                           k.digest );
+        }
+        else
+        {
+            MurmurHash3_x64_128( vptr, numChars, sizeof(int32_t),
+                k.digest.words );
+        }
     }
     break;
 
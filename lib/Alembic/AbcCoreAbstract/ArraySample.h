@@ -102,6 +102,20 @@ public:
     //! This is a calculation.
     Key getKey() const;
 
+    //! Compute the Key, and for string and wstring samples also hand back
+    //! the NULL separated characters that were hashed (8 bit characters for
+    //! strings, 32 bit characters for wstrings) so that writers can store
+    //! them without packing them a second time. oPacked is left empty for
+    //! every other POD.
+    Key getKey( std::vector< uint8_t > & oPacked ) const;
+
+    //! As above, but computes a key of type iKeyType.  kChunkedSampleKey
+    //! keys of samples that span several chunks are hashed with up to
+    //! iNumThreads threads.
+    Key getKey( std::vector< uint8_t > & oPacked,
+                ArraySampleKeyType iKeyType,
+                std::size_t iNumThreads ) const;
+
     //! Return if it is valid.
     //! An empty ArraySample is valid.
     //! however, an ArraySample that is empty and has a scalar
@@ -44,8 +44,34 @@ namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+//! How the digest of an ArraySampleKey was computed.  Keys of different
+//! types never compare equal, even when they were made from the same data.
+enum ArraySampleKeyType
+{
+    //! MurmurHash3 of the whole sample, the original key
+    kMurmur3SampleKey = 0,
+
+    //! MurmurHash3 of each kSampleKeyChunkSize bytes of the sample, with the
+    //! chunk digests combined via SpookyHash.  The chunks can be hashed in
+    //! parallel.  Samples no bigger than one chunk are digested as a single
+    //! chunk, without the combining step.
+    kChunkedSampleKey = 1
+};
+
+//! The size of the chunks that kChunkedSampleKey digests are made from.
+//! This is part of the key, changing it changes the digests.
+static const uint64_t kSampleKeyChunkSize = 1048576;
+
+//-*****************************************************************************
 struct ArraySampleKey : public Alembic::Util::totally_ordered<ArraySampleKey>
 {
+    ArraySampleKey()
+      : numBytes( 0 )
+      , origPOD( kUnknownPOD )
+      , readPOD( kUnknownPOD )
+      , keyType( kMurmur3SampleKey ) {}
+
     //! total number of bytes of the sample as originally stored
     uint64_t numBytes;
 
@@ -55,6 +81,9 @@ struct ArraySampleKey : public Alembic::Util::totally_ordered<ArraySampleKey>
     //! POD used at read time
     PlainOldDataType readPOD;
 
+    //! How the digest was computed
+    ArraySampleKeyType keyType;
+
     Digest digest;
 
     bool operator==( const ArraySampleKey &iRhs ) const
@@ -62,6 +91,7 @@ struct ArraySampleKey : public Alembic::Util::totally_ordered<ArraySampleKey>
         return ( ( numBytes == iRhs.numBytes ) &&
                  ( origPOD  == iRhs.origPOD  ) &&
                  ( readPOD  == iRhs.readPOD  ) &&
+                 ( keyType  == iRhs.keyType  ) &&
                  ( digest ==   iRhs.digest ) );
     };
 
@@ -76,7 +106,10 @@ struct ArraySampleKey : public Alembic::Util::totally_ordered<ArraySampleKey>
                        ( readPOD < iRhs.readPOD ? true :
                          ( readPOD > iRhs.readPOD ? false :
 
-                           ( digest < iRhs.digest ) ) ) ) ) ) );
+                           ( keyType < iRhs.keyType ? true :
+                             ( keyType > iRhs.keyType ? false :
+
+                               ( digest < iRhs.digest ) ) ) ) ) ) ) ) );
     };
 
 };
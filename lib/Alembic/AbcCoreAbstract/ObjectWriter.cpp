@@ -55,6 +55,12 @@ ObjectWriter::getChild( size_t i )
     return getChild( ohead.getName() );
 }
 
+//-*****************************************************************************
+void ObjectWriter::finalize()
+{
+    // Nothing
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -178,6 +178,14 @@ public:
     //! Returns shared pointer to myself.
     //! Sometimes this may be a spoofed ptr.
     virtual ObjectWriterPtr asObjectPtr() = 0;
+
+    //! Write out everything about this object now, instead of when the
+    //! writer is deleted, and let go of the memory that was being held
+    //! for it. All of its properties must have been let go of, and all of
+    //! its children must have been let go of or finalized. Afterwards no
+    //! properties or children can be added. Implementations which can't
+    //! write objects early do nothing.
+    virtual void finalize();
 };
 
 } // End namespace ALEMBIC_VERSION_NS
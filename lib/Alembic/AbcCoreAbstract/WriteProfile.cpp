@@ -0,0 +1,137 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/WriteProfile.h>
+
+#include <iomanip>
+#include <sstream>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+void WriteJSONString( std::ostream & ioStream, const std::string & iStr )
+{
+    ioStream << '"';
+    for ( std::string::const_iterator it = iStr.begin(); it != iStr.end();
+          ++it )
+    {
+        unsigned char c = ( unsigned char ) *it;
+        if ( c == '"' || c == '\\' )
+        {
+            ioStream << '\\' << *it;
+        }
+        else if ( c < 0x20 )
+        {
+            ioStream << "\\u" << std::hex << std::setw( 4 )
+                     << std::setfill( '0' ) << ( int ) c << std::dec;
+        }
+        else
+        {
+            ioStream << *it;
+        }
+    }
+    ioStream << '"';
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+WriteProfile::WriteProfile()
+  : numDedupLookups( 0 )
+  , numDedupHits( 0 )
+  , dedupBytesSaved( 0 )
+  , closed( false )
+  , closeSeconds( 0.0 )
+{
+}
+
+//-*****************************************************************************
+double WriteProfile::getDedupHitRate() const
+{
+    if ( numDedupLookups == 0 )
+    {
+        return 0.0;
+    }
+
+    return ( double ) numDedupHits / ( double ) numDedupLookups;
+}
+
+//-*****************************************************************************
+std::string WriteProfile::toJSON() const
+{
+    std::ostringstream strm;
+    strm.imbue( std::locale::classic() );
+    strm << std::setprecision( 9 );
+
+    strm << "{\n  \"phases\": {";
+    for ( size_t i = 0; i < phases.size(); ++i )
+    {
+        strm << ( i == 0 ? "\n    " : ",\n    " );
+        WriteJSONString( strm, phases[i].name );
+        strm << ": { \"seconds\": " << phases[i].seconds
+             << ", \"bytes\": " << phases[i].bytes
+             << ", \"count\": " << phases[i].count << " }";
+    }
+    strm << ( phases.empty() ? "}" : "\n  }" );
+
+    strm << ",\n  \"dedup\": { \"lookups\": " << numDedupLookups
+         << ", \"hits\": " << numDedupHits
+         << ", \"hitRate\": " << getDedupHitRate()
+         << ", \"bytesSaved\": " << dedupBytesSaved << " }";
+
+    strm << ",\n  \"largestProperties\": [";
+    for ( size_t i = 0; i < largestProperties.size(); ++i )
+    {
+        strm << ( i == 0 ? "\n    " : ",\n    " ) << "{ \"path\": ";
+        WriteJSONString( strm, largestProperties[i].path );
+        strm << ", \"bytes\": " << largestProperties[i].bytes << " }";
+    }
+    strm << ( largestProperties.empty() ? "]" : "\n  ]" );
+
+    strm << ",\n  \"close\": { \"closed\": "
+         << ( closed ? "true" : "false" )
+         << ", \"seconds\": " << closeSeconds << " }\n}\n";
+
+    return strm.str();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
@@ -0,0 +1,110 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreAbstract_WriteProfile_h
+#define Alembic_AbcCoreAbstract_WriteProfile_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! The cumulative time and bytes spent in one phase of writing an archive.
+//! Phases which run on several threads add up the time of every thread.
+struct WriteProfilePhase
+{
+    WriteProfilePhase() : seconds( 0.0 ), bytes( 0 ), count( 0 ) {}
+
+    std::string name;
+    double seconds;
+    uint64_t bytes;
+    uint64_t count;
+};
+
+//-*****************************************************************************
+//! How many bytes were written for one property, named by the full name
+//! of its object, a ':' and the names of its parent compounds and itself
+//! separated by '/'.
+struct WriteProfileProperty
+{
+    WriteProfileProperty() : bytes( 0 ) {}
+
+    std::string path;
+    uint64_t bytes;
+};
+
+//-*****************************************************************************
+//! Where the time and bytes went while writing an archive, see
+//! ArchiveWriter::enableWriteProfile.  Which phases there are is up to the
+//! implementation writing the archive.
+struct ALEMBIC_EXPORT WriteProfile
+{
+    WriteProfile();
+
+    std::vector< WriteProfilePhase > phases;
+
+    //! How often a sample was looked for among those already written, how
+    //! often it was found and how many bytes didn't have to be written
+    //! because of it.
+    uint64_t numDedupLookups;
+    uint64_t numDedupHits;
+    uint64_t dedupBytesSaved;
+
+    //! The properties which wrote the most bytes, largest first.
+    std::vector< WriteProfileProperty > largestProperties;
+
+    //! Whether the archive has been closed and how long that took.
+    bool closed;
+    double closeSeconds;
+
+    //! numDedupHits / numDedupLookups, 0 if nothing was looked up.
+    double getDedupHitRate() const;
+
+    //! The whole profile as a JSON object.
+    std::string toJSON() const;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
+
+#endif
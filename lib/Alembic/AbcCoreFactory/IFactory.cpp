@@ -52,6 +52,7 @@ IFactory::IFactory()
     m_cacheHierarchy = true;
     m_numStreams = 1;
     m_readStrategy = kMemoryMappedFiles;
+    m_sampleTables = false;
     m_policy = Alembic::Abc::ErrorHandler::kThrowPolicy;
 }
 
@@ -66,7 +67,8 @@ Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
     // try Ogawa first, use kQuietNoop at first in case we fail
     Alembic::AbcCoreOgawa::ReadArchive ogawa(
         m_numStreams,
-        m_readStrategy == kMemoryMappedFiles);
+        m_readStrategy == kMemoryMappedFiles,
+        m_sampleTables );
     Alembic::Abc::IArchive archive( ogawa, iFileName,
         Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
 
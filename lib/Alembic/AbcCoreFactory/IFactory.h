@@ -139,6 +139,18 @@ public:
         m_readStrategy = iStrategy;
     }
 
+    //! Gets whether Ogawa property readers build a table of all of their
+    //! samples the first time they are read from
+    bool getOgawaSampleTables() const { return m_sampleTables; }
+
+    //! Sets whether Ogawa property readers build a table of all of their
+    //! samples the first time they are read from, which speeds up random
+    //! access to many samples of the same property.  The default is false.
+    void setOgawaSampleTables( bool iSampleTables )
+    {
+        m_sampleTables = iSampleTables;
+    }
+
 
     //! Gets the error handler policy
     Alembic::Abc::ErrorHandler::Policy getPolicy() { return m_policy; }
@@ -153,6 +165,7 @@ private:
     bool m_cacheHierarchy;
     size_t m_numStreams;
     OgawaReadStrategy m_readStrategy;
+    bool m_sampleTables;
     Alembic::AbcCoreAbstract::ReadArraySampleCachePtr m_cachePtr;
     Alembic::Abc::ErrorHandler::Policy m_policy;
 
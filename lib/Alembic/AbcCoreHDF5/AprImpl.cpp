@@ -147,6 +147,46 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
     }
 }
 
+//-*****************************************************************************
+void AprImpl::getSampleRange( index_t iSampleIndex, size_t iFirstElement,
+                              size_t iCount, void *oData )
+{
+    const AbcA::DataType &dataType = m_header->getDataType();
+    if ( dataType.getPod() == kStringPOD || dataType.getPod() == kWstringPOD )
+    {
+        AbcA::ArrayPropertyReader::getSampleRange( iSampleIndex,
+            iFirstElement, iCount, oData );
+        return;
+    }
+
+    bool clean = false;
+    hid_t nativeType = GetNativeH5T( AbcA::DataType( dataType.getPod() ),
+                                     clean );
+
+    iSampleIndex = verifySampleIndex( iSampleIndex );
+
+    std::string sampleName = getSampleName( m_header->getName(), iSampleIndex );
+    H5Node parent;
+
+    if ( iSampleIndex == 0 )
+    {
+        parent = m_parentGroup;
+    }
+    else
+    {
+        checkSamplesIGroup();
+        parent = m_samplesIGroup;
+    }
+
+    ReadArrayRange( oData, parent.getObject(), sampleName, dataType,
+                    nativeType, iFirstElement, iCount );
+
+    if ( clean )
+    {
+        H5Tclose( nativeType );
+    }
+}
+
 //-*****************************************************************************
 void AprImpl::readSample( hid_t iGroup,
                           const std::string &iSampleName,
@@ -62,6 +62,12 @@ public:
     virtual void getDimensions( index_t iSampleIndex, Dimensions & oDim );
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         PlainOldDataType iPod );
+
+    // Reads just the range with a hyperslab, except for strings, which have
+    // to be read whole.
+    virtual void getSampleRange( index_t iSampleIndex,
+                                 size_t iFirstElement, size_t iCount,
+                                 void *oData );
 protected:
     friend class SimplePrImpl<AbcA::ArrayPropertyReader, AprImpl,
                               AbcA::ArraySamplePtr&>;
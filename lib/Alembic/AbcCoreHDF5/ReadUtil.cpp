@@ -769,6 +769,68 @@ ReadArray( void * iIntoLocation,
     }
 }
 
+//-*****************************************************************************
+void
+ReadArrayRange( void * iIntoLocation,
+                hid_t iParent,
+                const std::string &iName,
+                const AbcA::DataType &iDataType,
+                hid_t iType,
+                size_t iFirstElement,
+                size_t iCount )
+{
+    assert( iDataType.getPod() != kStringPOD &&
+            iDataType.getPod() != kWstringPOD );
+
+    // Open the data set.
+    hid_t dsetId = H5Dopen( iParent, iName.c_str(), H5P_DEFAULT );
+    ABCA_ASSERT( dsetId >= 0, "Cannot open dataset: " << iName );
+    DsetCloser dsetCloser( dsetId );
+
+    // Read the data space.
+    hid_t dspaceId = H5Dget_space( dsetId );
+    ABCA_ASSERT( dspaceId >= 0, "Could not get dataspace for dataSet: "
+                 << iName );
+    DspaceCloser dspaceCloser( dspaceId );
+
+    // the data set is flattened, so elements are extent values each
+    hsize_t start = iFirstElement * iDataType.getExtent();
+    hsize_t count = iCount * iDataType.getExtent();
+
+    hsize_t hdim = 0;
+    if ( H5Sget_simple_extent_type( dspaceId ) == H5S_SIMPLE )
+    {
+        int rank = H5Sget_simple_extent_ndims( dspaceId );
+        ABCA_ASSERT( rank == 1,
+                     "H5Sget_simple_extent_ndims() must be 1." );
+
+        H5Sget_simple_extent_dims( dspaceId, &hdim, NULL );
+    }
+
+    ABCA_ASSERT( start + count <= hdim,
+                 "Range " << iFirstElement << " + " << iCount <<
+                 " is past the end of dataset: " << iName );
+
+    if ( count == 0 )
+    {
+        return;
+    }
+
+    herr_t status = H5Sselect_hyperslab( dspaceId, H5S_SELECT_SET, &start,
+                                         NULL, &count, NULL );
+    ABCA_ASSERT( status >= 0, "H5Sselect_hyperslab() failed." );
+
+    hid_t memspaceId = H5Screate_simple( 1, &count, NULL );
+    ABCA_ASSERT( memspaceId >= 0, "Could not create memory dataspace for: "
+                 << iName );
+    DspaceCloser memspaceCloser( memspaceId );
+
+    status = H5Dread( dsetId, iType, memspaceId, dspaceId, H5P_DEFAULT,
+                      iIntoLocation );
+
+    ABCA_ASSERT( status >= 0, "H5Dread() failed." );
+}
+
 //-*****************************************************************************
 void
 ReadTimeSamples( hid_t iParent,
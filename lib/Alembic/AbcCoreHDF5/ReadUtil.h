@@ -127,6 +127,18 @@ ReadArray( void * iIntoLocation,
            const AbcA::DataType &iDataType,
            hid_t iType );
 
+//-*****************************************************************************
+// Reads iCount elements starting with iFirstElement of a fixed size POD
+// array, selecting just those with a hyperslab.
+void
+ReadArrayRange( void * iIntoLocation,
+                hid_t iParent,
+                const std::string &iName,
+                const AbcA::DataType &iDataType,
+                hid_t iType,
+                size_t iFirstElement,
+                size_t iCount );
+
 //-*****************************************************************************
 // Fills in oTimeSamples with the different TimeSampling that the archive uses
 // Intrinsically all archives have the first TimeSampling for uniform time 
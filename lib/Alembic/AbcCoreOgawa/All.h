@@ -39,5 +39,6 @@
 
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcCoreOgawa/ReadWrite.h>
+#include <Alembic/AbcCoreOgawa/CopySample.h>
 
 #endif
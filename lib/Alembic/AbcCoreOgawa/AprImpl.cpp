@@ -43,6 +43,27 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// Keeps the decoded buffer an ArraySample points at alive for as long as the
+// sample is.
+struct DecodedDeleter
+{
+    DecodedDeleter(
+        const Util::shared_ptr< const std::vector< Util::uint8_t > > & iData )
+      : m_data( iData ) {}
+
+    void operator()( AbcA::ArraySample * iSample ) const
+    {
+        delete iSample;
+    }
+
+    Util::shared_ptr< const std::vector< Util::uint8_t > > m_data;
+};
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
                   Ogawa::IGroupPtr iGroup,
@@ -50,6 +71,8 @@ AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
   : m_parent( iParent )
   , m_group( iGroup )
   , m_header( iHeader )
+  , m_useSampleTable( false )
+  , m_decodedIndex( ( size_t ) -1 )
 {
     // Validate all inputs.
     ABCA_ASSERT( m_parent, "Invalid parent" );
@@ -61,6 +84,109 @@ AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
         ABCA_THROW( "Attempted to create a ArrayPropertyReader from a "
                     "non-array property type" );
     }
+
+    m_useSampleTable = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->useSampleTables();
+}
+
+//-*****************************************************************************
+Ogawa::IDataPtr AprImpl::getData( size_t iIndex, std::size_t iThreadId )
+{
+    if ( !m_useSampleTable )
+    {
+        return m_group->getData( iIndex, iThreadId );
+    }
+
+    return m_sampleTable.get( m_group, iIndex, iThreadId );
+}
+
+//-*****************************************************************************
+AprImpl::DecodedDataPtr
+AprImpl::readDecoded( size_t iIndex, std::size_t iThreadId,
+                      Util::Dimensions & oDims )
+{
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    Ogawa::IDataPtr data = getData( iIndex * 2, iThreadId );
+    ReadDimensions( getData( iIndex * 2 + 1, iThreadId ), data, iThreadId,
+                    dataType, oDims );
+    std::size_t numBytes = dataType.getNumBytes() * oDims.numPoints();
+
+    // walk back to the keyframe, or to the sample we decoded last, every
+    // sample in between has to be the same size
+    std::vector< Ogawa::IDataPtr > deltas;
+    DecodedDataPtr base;
+    size_t index = iIndex;
+    while ( true )
+    {
+        {
+            Alembic::Util::scoped_lock l( m_decodedMutex );
+            if ( index == m_decodedIndex && m_decodedData &&
+                 m_decodedData->size() == numBytes )
+            {
+                base = m_decodedData;
+            }
+        }
+
+        if ( base )
+        {
+            // asking for the sample we decoded last doesn't copy anything
+            if ( deltas.empty() )
+            {
+                return base;
+            }
+            break;
+        }
+
+        if ( !IsDeltaEncodedData( data, numBytes ) )
+        {
+            // an empty sample has no key and no data
+            Util::shared_ptr< std::vector< Util::uint8_t > > keyframe(
+                new std::vector< Util::uint8_t >( numBytes ) );
+            if ( numBytes > 0 )
+            {
+                ABCA_ASSERT( data && data->getSize() == numBytes + 16,
+                    "Read invalid: Delta encoded property keyframe " <<
+                    index << " is the wrong size." );
+                data->read( numBytes, &( keyframe->front() ), 16,
+                            iThreadId );
+            }
+            base = keyframe;
+            break;
+        }
+
+        deltas.push_back( data );
+
+        Util::uint32_t ref = 0;
+        data->read( 4, &ref, 16, iThreadId );
+        ABCA_ASSERT( ref < index,
+            "Read invalid: Delta encoded sample " << index <<
+            " refers to sample " << ref );
+        index = ref;
+        data = getData( index * 2, iThreadId );
+    }
+
+    DecodedDataPtr ret = base;
+    if ( !deltas.empty() )
+    {
+        // the base may be shared, so the deltas are undone on a copy of it
+        Util::shared_ptr< std::vector< Util::uint8_t > > decoded(
+            new std::vector< Util::uint8_t >( *base ) );
+        std::vector< Util::uint8_t > encoded;
+        for ( size_t i = deltas.size(); i > 0; --i )
+        {
+            Ogawa::IDataPtr & delta = deltas[i - 1];
+            encoded.resize( delta->getSize() - 16 );
+            delta->read( encoded.size(), &( encoded.front() ), 16,
+                         iThreadId );
+            DecodeFloatDelta( encoded, *decoded );
+        }
+        ret = decoded;
+    }
+
+    Alembic::Util::scoped_lock l( m_decodedMutex );
+    m_decodedIndex = iIndex;
+    m_decodedData = ret;
+    return ret;
 }
 
 //-*****************************************************************************
@@ -108,12 +234,77 @@ void AprImpl::getSample( index_t iSampleIndex, AbcA::ArraySamplePtr &oSample )
         AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
 
     std::size_t id = streamId->getID();
-    Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
-    Ogawa::IDataPtr data = m_group->getData(index, id);
+
+    if ( m_header->isDeltaEncoded )
+    {
+        Util::Dimensions dims;
+        DecodedDataPtr decoded = readDecoded( index / 2, id, dims );
+
+        // the sample points straight at the decoded buffer and keeps it
+        // alive, the cache shares it instead of copying it out
+        const void * bytes = NULL;
+        if ( !decoded->empty() )
+        {
+            bytes = &( decoded->front() );
+        }
+        oSample.reset( new AbcA::ArraySample( bytes,
+                           m_header->header.getDataType(), dims ),
+                       DecodedDeleter( decoded ) );
+        return;
+    }
+
+    Ogawa::IDataPtr dims = getData( index + 1, id );
+    Ogawa::IDataPtr data = getData( index, id );
 
     ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample );
 }
 
+//-*****************************************************************************
+void AprImpl::getSampleRange( index_t iSampleIndex, size_t iFirstElement,
+                              size_t iCount, void *oData )
+{
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    if ( m_header->isDeltaEncoded ||
+         dataType.getPod() == Alembic::Util::kStringPOD ||
+         dataType.getPod() == Alembic::Util::kWstringPOD )
+    {
+        AbcA::ArrayPropertyReader::getSampleRange( iSampleIndex,
+            iFirstElement, iCount, oData );
+        return;
+    }
+
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr dims = getData( index + 1, id );
+    Ogawa::IDataPtr data = getData( index, id );
+
+    Util::Dimensions dim;
+    ReadDimensions( dims, data, id, dataType, dim );
+
+    ABCA_ASSERT( iFirstElement + iCount <= dim.numPoints(),
+                 "Range " << iFirstElement << " + " << iCount <<
+                 " is past the end of sample " << iSampleIndex <<
+                 " of size " << dim.numPoints() );
+
+    if ( iCount == 0 )
+    {
+        return;
+    }
+
+    // past the 16 byte key
+    std::size_t elementBytes = dataType.getNumBytes();
+    ABCA_ASSERT( data && data->getSize() >= 16 +
+                 ( iFirstElement + iCount ) * elementBytes,
+                 "Read invalid: Array sample " << iSampleIndex <<
+                 " is too small" );
+    data->read( iCount * elementBytes, oData,
+                16 + iFirstElement * elementBytes, id );
+}
+
 //-*****************************************************************************
 std::pair<index_t, chrono_t> AprImpl::getFloorIndex( chrono_t iTime )
 {
@@ -145,11 +336,15 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
     // * 2 for Array properties (since we also write the dimensions)
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader >(
+            getObject()->getArchive() );
+    oKey.keyType = archive->sampleKeyType();
+
+    StreamIDPtr streamId = archive->getStreamID();
 
     std::size_t id = streamId->getID();
-    Ogawa::IDataPtr data = m_group->getData( index, id );
+    Ogawa::IDataPtr data = getData( index, id );
 
     if ( data )
     {
@@ -159,12 +354,140 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
             data->read( 16, oKey.digest.d, 0, id );
         }
 
+        // a delta is smaller than the sample it decodes to
+        if ( m_header->isDeltaEncoded )
+        {
+            Util::Dimensions dims;
+            ReadDimensions( getData( index + 1, id ), data, id,
+                            m_header->header.getDataType(), dims );
+            oKey.numBytes = m_header->header.getDataType().getNumBytes() *
+                dims.numPoints();
+        }
+
         return true;
     }
 
     return false;
 }
 
+//-*****************************************************************************
+void AprImpl::getRawSample( index_t iSampleIndex,
+                            AbcA::ArraySample::Key & oKey,
+                            Util::Dimensions & oDims,
+                            std::vector< Util::uint8_t > & oData )
+{
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr dims = getData( index + 1, id );
+    Ogawa::IDataPtr data = getData( index, id );
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    ReadDimensions( dims, data, id, dataType, oDims );
+
+    // deltas are only meaningful within this property, so hand back the
+    // decoded sample
+    if ( m_header->isDeltaEncoded )
+    {
+        oKey = AbcA::ArraySample::Key();
+        oKey.numBytes = dataType.getNumBytes() * oDims.numPoints();
+        oKey.origPOD = dataType.getPod();
+        oKey.readPOD = oKey.origPOD;
+        oKey.keyType = getSampleKeyType();
+        if ( data && data->getSize() >= 16 )
+        {
+            data->read( 16, oKey.digest.d, 0, id );
+        }
+
+        DecodedDataPtr decoded = readDecoded( index / 2, id, oDims );
+        oData = *decoded;
+        return;
+    }
+
+    // the same key ArraySample::getKey would have given the writer
+    oKey = AbcA::ArraySample::Key();
+    oKey.numBytes = dataType.getNumBytes() * oDims.numPoints();
+    oKey.origPOD = dataType.getPod();
+    oKey.readPOD = oKey.origPOD;
+    oKey.keyType = getSampleKeyType();
+
+    // empty samples don't store a key
+    oData.clear();
+    if ( data && data->getSize() >= 16 )
+    {
+        data->read( 16, oKey.digest.d, 0, id );
+        oData.resize( data->getSize() - 16 );
+        if ( !oData.empty() )
+        {
+            data->read( oData.size(), &( oData.front() ), 16, id );
+        }
+    }
+}
+
+//-*****************************************************************************
+bool AprImpl::getRawDelta( index_t iSampleIndex,
+                           AbcA::ArraySample::Key & oKey,
+                           Util::Dimensions & oDims,
+                           Util::Digest & oFrom,
+                           std::vector< Util::uint8_t > & oEncoded )
+{
+    if ( !m_header->isDeltaEncoded )
+    {
+        return false;
+    }
+
+    size_t index = m_header->verifyIndex( iSampleIndex );
+
+    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr data = getData( index * 2, id );
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    ReadDimensions( getData( index * 2 + 1, id ), data, id, dataType, oDims );
+    std::size_t numBytes = dataType.getNumBytes() * oDims.numPoints();
+    if ( !IsDeltaEncodedData( data, numBytes ) )
+    {
+        return false;
+    }
+
+    oKey = AbcA::ArraySample::Key();
+    oKey.numBytes = numBytes;
+    oKey.origPOD = dataType.getPod();
+    oKey.readPOD = oKey.origPOD;
+    oKey.keyType = getSampleKeyType();
+    data->read( 16, oKey.digest.d, 0, id );
+
+    oEncoded.resize( data->getSize() - 16 );
+    data->read( oEncoded.size(), &( oEncoded.front() ), 16, id );
+
+    Util::uint32_t ref = 0;
+    ABCA_ASSERT( oEncoded.size() >= 4,
+        "Read invalid: Delta encoded sample " << index << " is too small." );
+    memcpy( &ref, &( oEncoded.front() ), 4 );
+    ABCA_ASSERT( ref < index,
+        "Read invalid: Delta encoded sample " << index <<
+        " refers to sample " << ref );
+
+    Ogawa::IDataPtr from = getData( ref * 2, id );
+    ABCA_ASSERT( from && from->getSize() >= 16,
+        "Read invalid: Delta encoded sample " << index <<
+        " refers to an empty sample" );
+    from->read( 16, oFrom.d, 0, id );
+    return true;
+}
+
+//-*****************************************************************************
+AbcA::ArraySampleKeyType AprImpl::getSampleKeyType()
+{
+    return Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader >(
+        getObject()->getArchive() )->sampleKeyType();
+}
+
 //-*****************************************************************************
 bool AprImpl::isScalarLike()
 {
@@ -181,8 +504,8 @@ void AprImpl::getDimensions( index_t iSampleIndex,
         AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
 
     std::size_t id = streamId->getID();
-    Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
-    Ogawa::IDataPtr data = m_group->getData(index, id);
+    Ogawa::IDataPtr dims = getData( index + 1, id );
+    Ogawa::IDataPtr data = getData( index, id );
 
     ReadDimensions( dims, data, id, m_header->header.getDataType(), oDim );
 
@@ -198,7 +521,35 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
         AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
 
     std::size_t id = streamId->getID();
-    Ogawa::IDataPtr data = m_group->getData( index, id );
+
+    if ( m_header->isDeltaEncoded )
+    {
+        ABCA_ASSERT( iPod != Alembic::Util::kStringPOD &&
+                     iPod != Alembic::Util::kWstringPOD,
+                     "Cannot convert the data to a string, or wstring." );
+
+        Util::Dimensions dims;
+        DecodedDataPtr decoded = readDecoded( index / 2, id, dims );
+        if ( decoded->empty() )
+        {
+            return;
+        }
+
+        Alembic::Util::PlainOldDataType pod =
+            m_header->header.getDataType().getPod();
+        if ( iPod == pod )
+        {
+            memcpy( iIntoLocation, &( decoded->front() ), decoded->size() );
+        }
+        else
+        {
+            ConvertData( pod, iPod, ( char * )( &( decoded->front() ) ),
+                         iIntoLocation, decoded->size() );
+        }
+        return;
+    }
+
+    Ogawa::IDataPtr data = getData( index, id );
     ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod );
 }
 
@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_AprImpl_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/SampleTable.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -74,8 +75,50 @@ public:
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         Alembic::Util::PlainOldDataType iPod );
 
+    // Reads just the bytes of the range, except for strings and delta
+    // encoded samples, which have to be read whole.
+    virtual void getSampleRange( index_t iSampleIndex,
+                                 size_t iFirstElement, size_t iCount,
+                                 void *oData );
+
+    // Reads sample iSampleIndex exactly as it is stored, so it can be
+    // written to another Ogawa archive without decoding or hashing it
+    // again.  oData gets the data for fixed size PODs, and the packed
+    // characters for strings and wstrings.  See ApwImpl::setRawSample.
+    void getRawSample( index_t iSampleIndex,
+                       AbcA::ArraySample::Key & oKey,
+                       Util::Dimensions & oDims,
+                       std::vector< Util::uint8_t > & oData );
+
+    // For a delta encoded property whose sample iSampleIndex is stored as
+    // a delta, reads that delta as it is stored, without decoding it.
+    // oEncoded starts with the index of the stored sample it is a delta
+    // from, whose digest is oFrom.  Returns false, reading nothing, for
+    // keyframes and properties that aren't delta encoded.
+    bool getRawDelta( index_t iSampleIndex,
+                      AbcA::ArraySample::Key & oKey,
+                      Util::Dimensions & oDims,
+                      Util::Digest & oFrom,
+                      std::vector< Util::uint8_t > & oEncoded );
+
+    // how the stored keys of our samples were computed
+    AbcA::ArraySampleKeyType getSampleKeyType();
+
 private:
 
+    // Returns the data child at iIndex, going through our sample table
+    // if the archive asked for one.
+    Ogawa::IDataPtr getData( size_t iIndex, std::size_t iThreadId );
+
+    // Decoded samples are shared, never modified once they are handed out.
+    typedef Util::shared_ptr< const std::vector< Util::uint8_t > >
+        DecodedDataPtr;
+
+    // Reads and decodes stored sample iIndex of a delta encoded property by
+    // undoing the deltas since the keyframe before it.
+    DecodedDataPtr readDecoded( size_t iIndex, std::size_t iThreadId,
+                                Util::Dimensions & oDims );
+
     // Parent compound property writer. It must exist.
     AbcA::CompoundPropertyReaderPtr m_parent;
 
@@ -84,6 +127,19 @@ private:
 
     // Stores the PropertyHeader and other info
     PropertyHeaderPtr m_header;
+
+    // When enabled, every data child of m_group is loaded the first time
+    // a sample is read, so later reads don't have to look up where the
+    // sample lives or how big it is.
+    bool m_useSampleTable;
+    SampleTable m_sampleTable;
+
+    // The last stored sample readDecoded decoded, so that reading the
+    // samples of a delta encoded property in order only has to undo one
+    // delta each.
+    size_t m_decodedIndex;
+    DecodedDataPtr m_decodedData;
+    Alembic::Util::mutex m_decodedMutex;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
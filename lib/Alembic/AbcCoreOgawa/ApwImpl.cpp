@@ -35,8 +35,10 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
+#include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -46,9 +48,12 @@ namespace ALEMBIC_VERSION_NS {
 ApwImpl::ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                   Ogawa::OGroupPtr iGroup,
                   PropertyHeaderPtr iHeader,
-                  size_t iIndex ) :
+                  size_t iIndex,
+                  Ogawa::IGroupPtr iExisting ) :
     m_parent( iParent ), m_header( iHeader ), m_group( iGroup ), m_dims( 1 ),
-    m_index( iIndex )
+    m_index( iIndex ), m_sampleKeyType( AbcA::kMurmur3SampleKey ),
+    m_numKeyThreads( 1 ), m_keyframeInterval( 0 ), m_numSinceKeyframe( 0 ),
+    m_rawDelta( NULL ), m_bytesWritten( 0 )
 {
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_header, "Invalid property header" );
@@ -59,12 +64,105 @@ ApwImpl::ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
         ABCA_THROW( "Attempted to create a ArrayPropertyWriter from a "
                     "non-array property type" );
     }
+
+    Util::shared_ptr< AwImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< AwImpl, AbcA::ArchiveWriter >(
+            m_parent->getObject()->getArchive() );
+    if ( archive )
+    {
+        m_asyncWriter = archive->getAsyncWriter();
+        m_sampleKeyType = archive->sampleKeyType();
+        m_numKeyThreads = archive->numKeyThreads();
+        m_profiler = archive->getWriteProfiler();
+        m_keyframeInterval = archive->deltaKeyframeInterval();
+    }
+
+    // existing properties keep the encoding they were written with
+    Util::PlainOldDataType pod = m_header->header.getDataType().getPod();
+    if ( !iExisting && m_keyframeInterval > 0 &&
+         ( pod == Util::kFloat32POD || pod == Util::kFloat64POD ) )
+    {
+        m_header->isDeltaEncoded = true;
+    }
+
+    if ( iExisting )
+    {
+        reopen( iExisting );
+    }
+}
+
+//-*****************************************************************************
+void ApwImpl::reopen( Ogawa::IGroupPtr iExisting )
+{
+    // the written sample map may only be touched by one thread
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->drain();
+    }
+
+    std::vector< AbcA::ArraySample::Key > keys;
+    std::vector< AbcA::Dimensions > dims;
+    ReadSampleKeys( iExisting, *m_header, m_sampleKeyType, keys, dims );
+
+    // the stored samples stay where they are, each one is followed by its
+    // dimensions
+    std::vector< Ogawa::ODataPtr > datas;
+    std::size_t numChildren = iExisting->getNumChildren();
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        Ogawa::ODataPtr data =
+            m_group->addExistingData( iExisting->getData( i, 0 ) );
+        if ( i % 2 == 0 )
+        {
+            datas.push_back( data );
+        }
+    }
+
+    if ( keys.empty() )
+    {
+        return;
+    }
+
+    ABCA_ASSERT( datas.size() >= keys.size(),
+                 "Not enough samples in existing property: " <<
+                 m_header->header.getName() );
+
+    // let new samples share the existing data
+    WrittenSampleMap & sampleMap =
+        GetWrittenSampleMap( m_parent->getObject()->getArchive() );
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    std::size_t extent = dataType.getExtent();
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+    {
+        WrittenSampleIDPtr writeID( new WrittenSampleID( keys[i], datas[i],
+            extent * dims[i].numPoints() ) );
+
+        // deltas only make sense where they are, the next sample we write
+        // will be a keyframe since m_deltaReference is empty
+        if ( !sampleMap.find( keys[i] ) && !( m_header->isDeltaEncoded &&
+             IsDeltaEncodedData( iExisting->getData( i * 2, 0 ),
+                 dataType.getNumBytes() * dims[i].numPoints() ) ) )
+        {
+            sampleMap.store( writeID );
+        }
+
+        m_previousWrittenSampleID = writeID;
+    }
+
+    m_dims = dims.back();
+    m_hash = HashSampleKeys( *m_header, keys, dims );
 }
 
 
 //-*****************************************************************************
 ApwImpl::~ApwImpl()
 {
+    // everything we queued has to be written before we can finish up
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->drain();
+    }
+
     AbcA::ArchiveWriterPtr archive = m_parent->getObject()->getArchive();
 
     index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
@@ -94,6 +192,13 @@ ApwImpl::~ApwImpl()
         hash.Update( m_hash.d, 16 );
     }
 
+    if ( m_profiler && m_profiler->isEnabled() )
+    {
+        m_profiler->addPropertyBytes(
+            GetProfilePath( m_parent, m_header->header.getName() ),
+            m_bytesWritten );
+    }
+
     Util::uint64_t hash0, hash1;
     hash.Final( &hash0, &hash1 );
     Util::shared_ptr< CpwImpl > parent =
@@ -118,16 +223,92 @@ void ApwImpl::setFromPreviousSample()
     ABCA_ASSERT( m_header->nextSampleIndex > 0,
         "Can't set from previous sample before any samples have been written" );
 
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->queuePreviousSample( this );
+    }
+    else
+    {
+        writePreviousSample();
+    }
+
+    m_header->nextSampleIndex ++;
+}
+
+//-*****************************************************************************
+void ApwImpl::writePreviousSample()
+{
+    // only possible if writing the first sample failed on another thread
+    ABCA_ASSERT( m_previousWrittenSampleID,
+        "Can't set from previous sample, no sample has been written" );
+
     Util::Digest digest = m_previousWrittenSampleID->getKey().digest;
     HashDimensions( m_dims, digest );
     Util::SpookyHash::ShortEnd(m_hash.words[0], m_hash.words[1],
                               digest.words[0], digest.words[1]);
+}
+
+//-*****************************************************************************
+void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
+{
+    setSample( iSamp, AbcA::ArraySamplePtr() );
+}
+
+//-*****************************************************************************
+void ApwImpl::setSample( AbcA::ArraySamplePtr iSamp )
+{
+    ABCA_ASSERT( iSamp, "Invalid ArraySamplePtr" );
+    setSample( *iSamp, iSamp );
+}
+
+//-*****************************************************************************
+void ApwImpl::setSample( const AbcA::ArraySample & iSamp,
+                         AbcA::ArraySamplePtr iOwner )
+{
+    // Make sure we aren't writing more samples than we have times for
+    // This applies to acyclic sampling only
+    ABCA_ASSERT(
+        !m_header->header.getTimeSampling()->getTimeSamplingType().isAcyclic()
+        || m_header->header.getTimeSampling()->getNumStoredTimes() >
+        m_header->nextSampleIndex,
+        "Can not write more samples than we have times for when using "
+        "Acyclic sampling." );
+
+    ABCA_ASSERT( iSamp.getDataType() == m_header->header.getDataType(),
+        "DataType on ArraySample iSamp: " << iSamp.getDataType() <<
+        ", does not match the DataType of the Array property: " <<
+        m_header->header.getDataType() );
+
+    if ( m_asyncWriter )
+    {
+        // hashed and written later, in order, on other threads
+        m_asyncWriter->queueSample( this, iSamp, m_header->nextSampleIndex,
+                                    iOwner );
+    }
+    else
+    {
+        // The Key helps us analyze the sample.
+        // strings and wstrings are packed while hashing so that WriteData
+        // doesn't have to pack them again
+        std::vector< Util::uint8_t > packed;
+        bool profiling = m_profiler && m_profiler->isEnabled();
+        ProfileTimer timer( profiling );
+        AbcA::ArraySample::Key key = iSamp.getKey( packed, m_sampleKeyType,
+                                                  m_numKeyThreads );
+        if ( profiling )
+        {
+            m_profiler->addHash( timer.elapsed(), iSamp, packed );
+        }
+        writeSample( iSamp, key, packed, m_header->nextSampleIndex );
+    }
 
     m_header->nextSampleIndex ++;
 }
 
 //-*****************************************************************************
-void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
+void ApwImpl::setRawSample( const AbcA::ArraySample & iSamp,
+                            const AbcA::ArraySample::Key & iKey,
+                            const std::vector< Util::uint8_t > & iPacked )
 {
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
@@ -143,8 +324,101 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         ", does not match the DataType of the Array property: " <<
         m_header->header.getDataType() );
 
-    // The Key helps us analyze the sample.
-     AbcA::ArraySample::Key key = iSamp.getKey();
+    ABCA_ASSERT( iKey.keyType == m_sampleKeyType,
+        "Can't write a raw sample with a different kind of key" );
+
+    // there is nothing left to do on another thread, but anything queued
+    // before us still has to be written first
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->drain();
+    }
+
+    writeSample( iSamp, iKey, iPacked, m_header->nextSampleIndex );
+
+    m_header->nextSampleIndex ++;
+}
+
+//-*****************************************************************************
+bool ApwImpl::setRawDelta( const AbcA::ArraySample & iSamp,
+                           const AbcA::ArraySample::Key & iKey,
+                           const Util::Digest & iFrom,
+                           const std::vector< Util::uint8_t > & iEncoded )
+{
+    ABCA_ASSERT( iSamp.getDataType() == m_header->header.getDataType(),
+        "DataType on ArraySample iSamp: " << iSamp.getDataType() <<
+        ", does not match the DataType of the Array property: " <<
+        m_header->header.getDataType() );
+
+    ABCA_ASSERT( iKey.keyType == m_sampleKeyType,
+        "Can't write a raw sample with a different kind of key" );
+
+    if ( !m_header->isDeltaEncoded || iEncoded.size() < 4 ||
+         m_header->nextSampleIndex == 0 )
+    {
+        return false;
+    }
+
+    // anything queued before us has to be written first, so we know what
+    // the last sample we wrote is
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->drain();
+    }
+
+    if ( !m_previousWrittenSampleID )
+    {
+        return false;
+    }
+
+    ABCA_ASSERT(
+        !m_header->header.getTimeSampling()->getTimeSamplingType().isAcyclic()
+        || m_header->header.getTimeSampling()->getNumStoredTimes() >
+        m_header->nextSampleIndex,
+        "Can not write more samples than we have times for when using "
+        "Acyclic sampling." );
+
+    // the delta has to be from the last sample we wrote, unless it is that
+    // very sample again, which isn't stored at all
+    const AbcA::ArraySample::Key & previous =
+        m_previousWrittenSampleID->getKey();
+    bool isRepeat = previous.digest == iKey.digest &&
+        previous.numBytes == iKey.numBytes;
+    if ( !isRepeat && ( !( previous.digest == iFrom ) ||
+         previous.numBytes != iKey.numBytes ||
+         m_numSinceKeyframe + 1 >= m_keyframeInterval ) )
+    {
+        return false;
+    }
+
+    m_rawDelta = &iEncoded;
+    try
+    {
+        writeSample( iSamp, iKey, std::vector< Util::uint8_t >(),
+                     m_header->nextSampleIndex );
+    }
+    catch ( ... )
+    {
+        m_rawDelta = NULL;
+        throw;
+    }
+    m_rawDelta = NULL;
+
+    m_header->nextSampleIndex ++;
+    return true;
+}
+
+//-*****************************************************************************
+void ApwImpl::writeSample( const AbcA::ArraySample & iSamp,
+                           const AbcA::ArraySample::Key & iKey,
+                           const std::vector< Util::uint8_t > & iPacked,
+                           index_t iIndex )
+{
+    // whatever makes it to the stream from here on is ours
+    bool profiling = m_profiler && m_profiler->isEnabled();
+    Util::uint64_t bytesBefore = profiling ? m_profiler->getBytesWritten() : 0;
+
+    AbcA::ArraySample::Key key = iKey;
 
      // mask out the non-string POD since Ogawa can safely share the same data
      // even if it originated from a different POD
@@ -158,7 +432,7 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
     }
 
     // We need to write the sample
-    if ( m_header->nextSampleIndex == 0  ||
+    if ( iIndex == 0  ||
          !( m_previousWrittenSampleID &&
             key == m_previousWrittenSampleID->getKey() ) )
     {
@@ -168,12 +442,13 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         {
             // copy the samples from after the last change to the latest index
             for ( index_t smpI = m_header->lastChangedIndex + 1;
-                smpI < m_header->nextSampleIndex; ++smpI )
+                smpI < iIndex; ++smpI )
             {
                 assert( smpI > 0 );
                 CopyWrittenData( m_group, m_previousWrittenSampleID );
                 WriteDimensions( m_group, m_dims,
-                                 iSamp.getDataType().getPod() );
+                                 iSamp.getDataType().getPod(),
+                                 m_header->isDeltaEncoded );
             }
         }
 
@@ -183,11 +458,24 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
 
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key );
+        if ( m_header->isDeltaEncoded )
+        {
+            m_previousWrittenSampleID =
+                writeDeltaData( GetWrittenSampleMap( awp ), iSamp, key,
+                                iPacked );
+        }
+        else
+        {
+            m_previousWrittenSampleID =
+                WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key,
+                           iPacked );
+        }
 
+        // delta encoded samples can't be sized by their data, so their
+        // dimensions are always written
         m_dims = iSamp.getDimensions();
-        WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod() );
+        WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod(),
+                         m_header->isDeltaEncoded );
 
         // if we haven't written this already, isScalarLike will be true
         if ( m_header->isScalarLike && m_dims.numPoints() != 1 )
@@ -204,16 +492,16 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
 
         if (m_header->firstChangedIndex == 0)
         {
-            m_header->firstChangedIndex = m_header->nextSampleIndex;
+            m_header->firstChangedIndex = iIndex;
         }
 
         // this index is now the last change
-        m_header->lastChangedIndex = m_header->nextSampleIndex;
+        m_header->lastChangedIndex = iIndex;
     }
 
     Util::Digest digest = m_previousWrittenSampleID->getKey().digest;
     HashDimensions( m_dims, digest );
-    if ( m_header->nextSampleIndex == 0 )
+    if ( iIndex == 0 )
     {
         m_hash = digest;
     }
@@ -222,7 +510,83 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         Util::SpookyHash::ShortEnd(m_hash.words[0], m_hash.words[1],
                                    digest.words[0], digest.words[1]);
     }
-    m_header->nextSampleIndex ++;
+
+    if ( profiling )
+    {
+        m_bytesWritten += m_profiler->getBytesWritten() - bytesBefore;
+    }
+}
+
+//-*****************************************************************************
+WrittenSampleIDPtr ApwImpl::writeDeltaData( WrittenSampleMap & iMap,
+    const AbcA::ArraySample & iSamp,
+    const AbcA::ArraySample::Key & iKey,
+    const std::vector< Util::uint8_t > & iPacked )
+{
+    const AbcA::DataType & dataType = iSamp.getDataType();
+    std::size_t numPoints = iSamp.getDimensions().numPoints();
+    std::size_t numBytes = dataType.getNumBytes() * numPoints;
+    const Util::uint8_t * bytes =
+        static_cast< const Util::uint8_t * >( iSamp.getData() );
+
+    // a delta from setRawDelta is written as it is, except that it refers
+    // to where its sample is stored here, and since we don't have the
+    // sample it is a delta of, the next one we encode will be a keyframe
+    if ( m_rawDelta )
+    {
+        WrittenSampleIDPtr writeID = iMap.find( iKey );
+        if ( writeID )
+        {
+            CopyWrittenData( m_group, writeID );
+            m_numSinceKeyframe = 0;
+        }
+        else
+        {
+            std::vector< Util::uint8_t > encoded( *m_rawDelta );
+            Util::uint32_t ref =
+                ( Util::uint32_t )( m_group->getNumChildren() / 2 - 1 );
+            memcpy( &( encoded.front() ), &ref, 4 );
+
+            const void * datas[2] = { &iKey.digest, &( encoded.front() ) };
+            Alembic::Util::uint64_t sizes[2] = { 16, encoded.size() };
+            writeID.reset( new WrittenSampleID( iKey,
+                m_group->addData( 2, sizes, datas ),
+                dataType.getExtent() * numPoints ) );
+            m_numSinceKeyframe ++;
+        }
+
+        m_deltaReference.clear();
+        return writeID;
+    }
+
+    // samples that have already been written somewhere are shared as usual,
+    // the previous sample is always the last one we stored
+    std::vector< Util::uint8_t > encoded;
+    bool isDelta = numBytes > 0 && m_numSinceKeyframe + 1 < m_keyframeInterval
+        && m_deltaReference.size() == numBytes && !iMap.find( iKey ) &&
+        EncodeFloatDelta( &( m_deltaReference.front() ), bytes, numBytes,
+            ( Util::uint32_t )( m_group->getNumChildren() / 2 - 1 ), encoded );
+
+    WrittenSampleIDPtr writeID;
+    if ( isDelta )
+    {
+        // deltas only make sense after the sample they are from, so they
+        // are never shared
+        const void * datas[2] = { &iKey.digest, &( encoded.front() ) };
+        Alembic::Util::uint64_t sizes[2] = { 16, encoded.size() };
+        writeID.reset( new WrittenSampleID( iKey,
+            m_group->addData( 2, sizes, datas ),
+            dataType.getExtent() * numPoints ) );
+        m_numSinceKeyframe ++;
+    }
+    else
+    {
+        writeID = WriteData( iMap, m_group, iSamp, iKey, iPacked );
+        m_numSinceKeyframe = 0;
+    }
+
+    m_deltaReference.assign( bytes, bytes + numBytes );
+    return writeID;
 }
 
 //-*****************************************************************************
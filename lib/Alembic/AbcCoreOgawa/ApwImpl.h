@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_ApwImpl_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/AsyncWriter.h>
 #include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
 
 namespace Alembic {
@@ -47,6 +48,7 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 class ApwImpl
     : public AbcA::ArrayPropertyWriter
+    , public AsyncPropertyWriter
     , public Alembic::Util::enable_shared_from_this<ApwImpl>
 {
 protected:
@@ -56,15 +58,46 @@ protected:
     ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
              Ogawa::OGroupPtr iGroup,
              PropertyHeaderPtr iHeader,
-             size_t iIndex );
+             size_t iIndex,
+             Ogawa::IGroupPtr iExisting = Ogawa::IGroupPtr() );
 
     virtual AbcA::ArrayPropertyWriterPtr asArrayPtr();
 
+    // picks up where the existing property iExisting left off
+    void reopen( Ogawa::IGroupPtr iExisting );
+
 public:
     virtual ~ApwImpl();
 
     // ArrayPropertyWriter overrides
     virtual void setSample( const AbcA::ArraySample & iSamp );
+    virtual void setSample( AbcA::ArraySamplePtr iSamp );
+
+    // Writes a sample read by AprImpl::getRawSample from another Ogawa
+    // archive with the same kind of keys.  iSamp describes the sample, and
+    // points at its data unless it is a string or wstring, in which case
+    // iPacked holds the data.
+    void setRawSample( const AbcA::ArraySample & iSamp,
+                       const AbcA::ArraySample::Key & iKey,
+                       const std::vector< Util::uint8_t > & iPacked );
+
+    // Writes a delta read by AprImpl::getRawDelta from another delta
+    // encoded Ogawa archive with the same kind of keys as it is stored,
+    // which only works if the last sample we wrote is the one it is a delta
+    // from (whose digest is iFrom), and we would have written a delta too.
+    // Returns false, having written nothing, otherwise, in which case the
+    // decoded sample has to be written instead.  iSamp describes the
+    // sample, its data isn't used.
+    bool setRawDelta( const AbcA::ArraySample & iSamp,
+                      const AbcA::ArraySample::Key & iKey,
+                      const Util::Digest & iFrom,
+                      const std::vector< Util::uint8_t > & iEncoded );
+
+    // how our samples get their keys
+    AbcA::ArraySampleKeyType getSampleKeyType() const
+    {
+        return m_sampleKeyType;
+    }
     virtual void setFromPreviousSample();
     virtual size_t getNumSamples();
     virtual void setTimeSamplingIndex( Util::uint32_t iIndex );
@@ -75,6 +108,27 @@ public:
     virtual AbcA::CompoundPropertyWriterPtr getParent();
 
 protected:
+    // iOwner is either empty, or the same sample as iSamp which we are
+    // allowed to hold on to
+    void setSample( const AbcA::ArraySample & iSamp,
+                    AbcA::ArraySamplePtr iOwner );
+
+    // AsyncPropertyWriter overrides, these do the actual writing either
+    // directly from setSample and setFromPreviousSample or later on from
+    // the archive's AsyncWriter
+    virtual void writeSample( const AbcA::ArraySample & iSamp,
+                              const AbcA::ArraySample::Key & iKey,
+                              const std::vector< Util::uint8_t > & iPacked,
+                              index_t iIndex );
+    virtual void writePreviousSample();
+
+    // Writes iSamp as a delta from the sample before it if it can, otherwise
+    // the way WriteData does, see WriteArchive::setFloatDeltaEncoding.
+    WrittenSampleIDPtr writeDeltaData( WrittenSampleMap & iMap,
+        const AbcA::ArraySample & iSamp,
+        const AbcA::ArraySample::Key & iKey,
+        const std::vector< Util::uint8_t > & iPacked );
+
     // Previous written array sample identifier!
     WrittenSampleIDPtr m_previousWrittenSampleID;
 
@@ -94,6 +148,28 @@ private:
     AbcA::Dimensions m_dims;
 
     size_t m_index;
+
+    // how the archive wants sample keys computed
+    AbcA::ArraySampleKeyType m_sampleKeyType;
+    std::size_t m_numKeyThreads;
+
+    // set if the archive hashes and writes samples on other threads
+    AsyncWriterPtr m_asyncWriter;
+
+    // for delta encoded properties, how many stored samples may share a
+    // keyframe, how many have since the last one, and the last stored
+    // sample, which the next one is a delta from
+    Util::uint32_t m_keyframeInterval;
+    Util::uint32_t m_numSinceKeyframe;
+    std::vector< Util::uint8_t > m_deltaReference;
+
+    // set by setRawDelta while it writes, the stored delta to write instead
+    // of encoding one
+    const std::vector< Util::uint8_t > * m_rawDelta;
+
+    // the archive's profiler, and what we wrote while it was enabled
+    WriteProfilerPtr m_profiler;
+    Util::uint64_t m_bytesWritten;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -49,8 +49,11 @@ ArImpl::ArImpl( const std::string &iFileName,
                 bool iUseMMap)
   : m_fileName( iFileName )
   , m_archive( iFileName, iNumStreams, iUseMMap )
+  , m_dataAlignment( 0 )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iNumStreams )
+  , m_useSampleTables( false )
+  , m_sampleKeyType( AbcA::kMurmur3SampleKey )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file: " << m_fileName );
@@ -64,8 +67,11 @@ ArImpl::ArImpl( const std::string &iFileName,
 //-*****************************************************************************
 ArImpl::ArImpl( const std::vector< std::istream * > & iStreams )
   : m_archive( iStreams )
+  , m_dataAlignment( 0 )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iStreams.size() )
+  , m_useSampleTables( false )
+  , m_sampleKeyType( AbcA::kMurmur3SampleKey )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file from provided streams." );
@@ -138,6 +144,20 @@ void ArImpl::init()
         m_header->getMetaData().deserialize( metaData );
     }
 
+    // archives which don't say otherwise have the original keys
+    std::ostringstream chunked;
+    chunked << ( int ) AbcA::kChunkedSampleKey;
+    if ( m_header->getMetaData().get( "_ai_SampleKeyType" ) == chunked.str() )
+    {
+        m_sampleKeyType = AbcA::kChunkedSampleKey;
+    }
+
+    std::string alignment =
+        m_header->getMetaData().get( "_ai_DataAlignment" );
+    if ( !alignment.empty() )
+    {
+        m_dataAlignment = ( Util::uint32_t ) atoi( alignment.c_str() );
+    }
 }
 
 //-*****************************************************************************
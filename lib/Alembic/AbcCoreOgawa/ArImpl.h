@@ -101,10 +101,25 @@ public:
         return m_archiveVersion;
     }
 
+    virtual Util::uint32_t getDataAlignment()
+    {
+        return m_dataAlignment;
+    }
+
     StreamIDPtr getStreamID();
 
+    // whether property readers should build a table of all their samples
+    // the first time they are read from
+    bool useSampleTables() const { return m_useSampleTables; }
+
+    // how the keys of the samples in this archive were computed
+    AbcA::ArraySampleKeyType sampleKeyType() const { return m_sampleKeyType; }
+
     const std::vector< AbcA::MetaData > & getIndexedMetaData();
 
+    // the first Ogawa group of the archive, used when appending to it
+    Ogawa::IGroupPtr getGroup() const { return m_archive.getGroup(); }
+
 private:
     void init();
 
@@ -118,6 +133,7 @@ private:
     Alembic::Util::mutex m_orlock;
 
     Util::int32_t m_archiveVersion;
+    Util::uint32_t m_dataAlignment;
 
     std::vector <  AbcA::TimeSamplingPtr > m_timeSamples;
     std::vector <  AbcA::index_t > m_maxSamples;
@@ -126,6 +142,10 @@ private:
 
     StreamManager m_manager;
 
+    bool m_useSampleTables;
+
+    AbcA::ArraySampleKeyType m_sampleKeyType;
+
     std::vector< AbcA::MetaData > m_indexMetaData;
 };
 
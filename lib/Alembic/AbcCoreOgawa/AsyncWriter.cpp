@@ -0,0 +1,476 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/AsyncWriter.h>
+
+#include <Alembic/Util/Threads.h>
+
+#include <deque>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+using Alembic::Util::Monitor;
+using Alembic::Util::MonitorLock;
+
+//-*****************************************************************************
+struct Task
+{
+    Task() : prop( NULL ), index( 0 ), numBytes( 0 ), hashed( false ) {}
+
+    AsyncPropertyWriter * prop;
+
+    // our own copy of the sample, NULL when repeating the previous sample
+    AbcA::ArraySamplePtr sample;
+
+    index_t index;
+    Util::uint64_t numBytes;
+
+    // filled in by the hashing threads
+    bool hashed;
+    AbcA::ArraySample::Key key;
+    std::vector< Util::uint8_t > packed;
+    std::string error;
+};
+
+typedef Alembic::Util::shared_ptr< Task > TaskPtr;
+
+//-*****************************************************************************
+AbcA::ArraySamplePtr CopySample( const AbcA::ArraySample & iSamp )
+{
+    const AbcA::DataType & dataType = iSamp.getDataType();
+    AbcA::ArraySamplePtr copy = AbcA::AllocateArraySample( dataType,
+        iSamp.getDimensions() );
+
+    std::size_t numPods = dataType.getExtent() *
+        iSamp.getDimensions().numPoints();
+
+    if ( numPods == 0 )
+    {
+        return copy;
+    }
+
+    void * data = const_cast< void * >( copy->getData() );
+    if ( dataType.getPod() == Alembic::Util::kStringPOD )
+    {
+        const std::string * src =
+            static_cast< const std::string * >( iSamp.getData() );
+        std::copy( src, src + numPods, static_cast< std::string * >( data ) );
+    }
+    else if ( dataType.getPod() == Alembic::Util::kWstringPOD )
+    {
+        const std::wstring * src =
+            static_cast< const std::wstring * >( iSamp.getData() );
+        std::copy( src, src + numPods,
+                   static_cast< std::wstring * >( data ) );
+    }
+    else
+    {
+        memcpy( data, iSamp.getData(),
+                dataType.getNumBytes() * iSamp.getDimensions().numPoints() );
+    }
+
+    return copy;
+}
+
+//-*****************************************************************************
+// roughly how much memory a queued sample is holding on to
+Util::uint64_t SampleBytes( const AbcA::ArraySample & iSamp )
+{
+    const AbcA::DataType & dataType = iSamp.getDataType();
+    std::size_t numPods = dataType.getExtent() *
+        iSamp.getDimensions().numPoints();
+
+    Util::uint64_t numBytes = 0;
+    if ( dataType.getPod() == Alembic::Util::kStringPOD )
+    {
+        const std::string * strs =
+            static_cast< const std::string * >( iSamp.getData() );
+        for ( std::size_t i = 0; i < numPods; ++i )
+        {
+            numBytes += sizeof( std::string ) + strs[i].size() + 1;
+        }
+    }
+    else if ( dataType.getPod() == Alembic::Util::kWstringPOD )
+    {
+        const std::wstring * strs =
+            static_cast< const std::wstring * >( iSamp.getData() );
+        for ( std::size_t i = 0; i < numPods; ++i )
+        {
+            numBytes += sizeof( std::wstring ) +
+                ( strs[i].size() + 1 ) * ( sizeof( wchar_t ) + 4 );
+        }
+    }
+    else
+    {
+        numBytes = dataType.getNumBytes() * iSamp.getDimensions().numPoints();
+    }
+
+    return numBytes + sizeof( Task );
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+class AsyncWriter::PrivateData
+{
+public:
+    PrivateData() : maxQueuedBytes( 0 ), queuedBytes( 0 ), writing( false ),
+        stopping( false ), keyType( AbcA::kMurmur3SampleKey ),
+        numKeyThreads( 1 ) {}
+
+    void hashLoop();
+    void writeLoop();
+
+    // start a thread running hashLoop or writeLoop
+    bool startThread( bool iWriter );
+
+    // tell the threads to finish what's queued and wait for them
+    void stopThreads();
+
+    static void hashThread( void * iData );
+    static void writeThread( void * iData );
+
+    Monitor monitor;
+
+    // everything queued, in order, the front is the next to be written
+    std::deque< TaskPtr > ordered;
+
+    // the samples that still need to be hashed
+    std::deque< TaskPtr > toHash;
+
+    Util::uint64_t maxQueuedBytes;
+    Util::uint64_t queuedBytes;
+
+    // whether the writer thread is in the middle of writing a task that is
+    // no longer in ordered
+    bool writing;
+
+    bool stopping;
+
+    // how the hashing threads compute sample keys
+    AbcA::ArraySampleKeyType keyType;
+    std::size_t numKeyThreads;
+
+    // times the hashing when it is enabled
+    WriteProfilerPtr profiler;
+
+    // the first error hit since the last flush
+    std::string error;
+
+    std::vector< Util::ThreadPtr > threads;
+};
+
+//-*****************************************************************************
+void AsyncWriter::PrivateData::hashLoop()
+{
+    MonitorLock lock( monitor );
+    for ( ;; )
+    {
+        while ( toHash.empty() && !stopping )
+        {
+            monitor.wait();
+        }
+
+        if ( toHash.empty() )
+        {
+            return;
+        }
+
+        TaskPtr task = toHash.front();
+        toHash.pop_front();
+
+        monitor.unlock();
+
+        try
+        {
+            bool profiling = profiler && profiler->isEnabled();
+            ProfileTimer timer( profiling );
+            task->key = task->sample->getKey( task->packed, keyType,
+                                              numKeyThreads );
+            if ( profiling )
+            {
+                profiler->addHash( timer.elapsed(), *task->sample,
+                                   task->packed );
+            }
+        }
+        catch ( std::exception & e )
+        {
+            task->error = e.what();
+        }
+        catch ( ... )
+        {
+            task->error = "Unknown error while hashing a sample";
+        }
+
+        monitor.lock();
+        task->hashed = true;
+        monitor.notifyAll();
+    }
+}
+
+//-*****************************************************************************
+void AsyncWriter::PrivateData::writeLoop()
+{
+    MonitorLock lock( monitor );
+    for ( ;; )
+    {
+        // the hashing threads never stop while there is something left to
+        // hash so we'll always get to the end of the queue
+        while ( ( ordered.empty() && !stopping ) ||
+                ( !ordered.empty() && !ordered.front()->hashed ) )
+        {
+            monitor.wait();
+        }
+
+        if ( ordered.empty() )
+        {
+            return;
+        }
+
+        TaskPtr task = ordered.front();
+        ordered.pop_front();
+        writing = true;
+
+        monitor.unlock();
+
+        std::string taskError = task->error;
+        if ( taskError.empty() )
+        {
+            try
+            {
+                if ( task->sample )
+                {
+                    task->prop->writeSample( *( task->sample ), task->key,
+                                             task->packed, task->index );
+                }
+                else
+                {
+                    task->prop->writePreviousSample();
+                }
+            }
+            catch ( std::exception & e )
+            {
+                taskError = e.what();
+            }
+            catch ( ... )
+            {
+                taskError = "Unknown error while writing a sample";
+            }
+        }
+
+        // let go of the sample copy before we say we are done with it
+        Util::uint64_t numBytes = task->numBytes;
+        task.reset();
+
+        monitor.lock();
+        if ( !taskError.empty() && error.empty() )
+        {
+            error = taskError;
+        }
+        queuedBytes -= numBytes;
+        writing = false;
+        monitor.notifyAll();
+    }
+}
+
+//-*****************************************************************************
+void AsyncWriter::PrivateData::hashThread( void * iData )
+{
+    static_cast< PrivateData * >( iData )->hashLoop();
+}
+
+//-*****************************************************************************
+void AsyncWriter::PrivateData::writeThread( void * iData )
+{
+    static_cast< PrivateData * >( iData )->writeLoop();
+}
+
+//-*****************************************************************************
+bool AsyncWriter::PrivateData::startThread( bool iWriter )
+{
+    Util::ThreadPtr thread( new Util::Thread() );
+    if ( !thread->start( iWriter ? writeThread : hashThread, this ) )
+    {
+        return false;
+    }
+
+    threads.push_back( thread );
+    return true;
+}
+
+//-*****************************************************************************
+void AsyncWriter::PrivateData::stopThreads()
+{
+    {
+        MonitorLock lock( monitor );
+        stopping = true;
+        monitor.notifyAll();
+    }
+
+    // the loops catch their own errors, so joining doesn't throw
+    for ( std::size_t i = 0; i < threads.size(); ++i )
+    {
+        threads[i]->join();
+    }
+    threads.clear();
+}
+
+//-*****************************************************************************
+AsyncWriter::AsyncWriter( std::size_t iNumHashThreads,
+                          Util::uint64_t iMaxQueuedBytes,
+                          AbcA::ArraySampleKeyType iKeyType,
+                          std::size_t iNumKeyThreads,
+                          WriteProfilerPtr iProfiler )
+    : mData( new PrivateData() )
+{
+    mData->maxQueuedBytes = iMaxQueuedBytes;
+    mData->keyType = iKeyType;
+    mData->numKeyThreads = iNumKeyThreads;
+    mData->profiler = iProfiler;
+
+    ABCA_ASSERT( mData->startThread( true ),
+                 "Could not start the asynchronous writing thread." );
+
+    // we need at least one hashing thread, any more are nice to have
+    if ( !mData->startThread( false ) )
+    {
+        mData->stopThreads();
+        ABCA_THROW( "Could not start the asynchronous hashing thread." );
+    }
+
+    for ( std::size_t i = 1; i < iNumHashThreads; ++i )
+    {
+        if ( !mData->startThread( false ) )
+        {
+            break;
+        }
+    }
+}
+
+//-*****************************************************************************
+AsyncWriter::~AsyncWriter()
+{
+    mData->stopThreads();
+}
+
+//-*****************************************************************************
+void AsyncWriter::queueSample( AsyncPropertyWriter * iProp,
+                               const AbcA::ArraySample & iSamp,
+                               index_t iIndex,
+                               AbcA::ArraySamplePtr iOwned )
+{
+    TaskPtr task( new Task() );
+    task->prop = iProp;
+    task->index = iIndex;
+    task->numBytes = SampleBytes( iSamp );
+
+    // copying is the one expensive thing we do on the calling thread, but
+    // it's what lets the caller reuse its sample as soon as we return
+    if ( iOwned )
+    {
+        task->sample = iOwned;
+    }
+    else
+    {
+        task->sample = CopySample( iSamp );
+    }
+
+    MonitorLock lock( mData->monitor );
+
+    // back pressure, wait until there's room, but always let at least one
+    // sample through no matter how big it is
+    while ( !mData->ordered.empty() &&
+            mData->queuedBytes + task->numBytes > mData->maxQueuedBytes )
+    {
+        mData->monitor.wait();
+    }
+
+    mData->queuedBytes += task->numBytes;
+    mData->ordered.push_back( task );
+    mData->toHash.push_back( task );
+    mData->monitor.notifyAll();
+}
+
+//-*****************************************************************************
+void AsyncWriter::queuePreviousSample( AsyncPropertyWriter * iProp )
+{
+    TaskPtr task( new Task() );
+    task->prop = iProp;
+    task->numBytes = sizeof( Task );
+    task->hashed = true;
+
+    MonitorLock lock( mData->monitor );
+    mData->queuedBytes += task->numBytes;
+    mData->ordered.push_back( task );
+    mData->monitor.notifyAll();
+}
+
+//-*****************************************************************************
+void AsyncWriter::drain()
+{
+    MonitorLock lock( mData->monitor );
+    while ( !mData->ordered.empty() || mData->writing )
+    {
+        mData->monitor.wait();
+    }
+}
+
+//-*****************************************************************************
+void AsyncWriter::flush()
+{
+    std::string error;
+    {
+        MonitorLock lock( mData->monitor );
+        while ( !mData->ordered.empty() || mData->writing )
+        {
+            mData->monitor.wait();
+        }
+        error.swap( mData->error );
+    }
+
+    if ( !error.empty() )
+    {
+        ABCA_THROW( "Error while writing asynchronously: " << error );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
@@ -0,0 +1,124 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_AsyncWriter_h
+#define Alembic_AbcCoreOgawa_AsyncWriter_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/WriteProfiler.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Implemented by the property writers so that the AsyncWriter can hand
+// samples back to them, in the order they were set, once they've been hashed.
+class AsyncPropertyWriter
+{
+public:
+    virtual ~AsyncPropertyWriter() {}
+
+    // Write iSamp as sample number iIndex, iKey and iPacked are what
+    // ArraySample::getKey computed for it.
+    virtual void writeSample( const AbcA::ArraySample & iSamp,
+                              const AbcA::ArraySample::Key & iKey,
+                              const std::vector< Util::uint8_t > & iPacked,
+                              index_t iIndex ) = 0;
+
+    // Repeat the previously written sample.
+    virtual void writePreviousSample() = 0;
+};
+
+//-*****************************************************************************
+// Moves the hashing and writing of samples off of the thread that sets them.
+//
+// Samples are copied when they are queued, hashed by a pool of threads, and
+// then written to the archive in the order they were queued by a single
+// writer thread, which is the only thread that touches the Ogawa stream
+// while samples are in flight.  Anything else which needs to write to the
+// archive must drain the queue first.
+//
+// If more than the maximum number of bytes are waiting to be written, queuing
+// blocks until the writer catches up.
+//
+// Errors hit while hashing or writing are held on to and thrown from flush.
+class AsyncWriter : private Alembic::Util::noncopyable
+{
+public:
+    // sample keys are computed with AbcA::ArraySample::getKey using
+    // iKeyType and iNumKeyThreads, and their hashing is timed by iProfiler
+    // if it is given and enabled
+    AsyncWriter( std::size_t iNumHashThreads,
+                 Util::uint64_t iMaxQueuedBytes,
+                 AbcA::ArraySampleKeyType iKeyType = AbcA::kMurmur3SampleKey,
+                 std::size_t iNumKeyThreads = 1,
+                 WriteProfilerPtr iProfiler = WriteProfilerPtr() );
+
+    // drains the queue and stops all of the threads, any held error is lost
+    ~AsyncWriter();
+
+    // queue iSamp to be written as sample iIndex of iProp, iSamp is copied
+    // unless iOwned is the same sample and we can hold on to that instead
+    void queueSample( AsyncPropertyWriter * iProp,
+                      const AbcA::ArraySample & iSamp,
+                      index_t iIndex,
+                      AbcA::ArraySamplePtr iOwned = AbcA::ArraySamplePtr() );
+
+    // queue a repeat of the previous sample of iProp
+    void queuePreviousSample( AsyncPropertyWriter * iProp );
+
+    // block until everything queued so far has been written
+    void drain();
+
+    // drain, and then throw the first error that was hit, if any
+    void flush();
+
+private:
+    class PrivateData;
+    Alembic::Util::unique_ptr< PrivateData > mData;
+};
+
+typedef Alembic::Util::shared_ptr< AsyncWriter > AsyncWriterPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
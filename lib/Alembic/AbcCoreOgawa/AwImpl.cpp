@@ -38,6 +38,8 @@
 #include <Alembic/AbcCoreOgawa/OwData.h>
 #include <Alembic/AbcCoreOgawa/OwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadWrite.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -45,11 +47,24 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 AwImpl::AwImpl( const std::string &iFileName,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                bool iPackScalarSamples,
+                bool iInlineSmallSamples,
+                Util::uint32_t iDataAlignment,
+                bool iAppend,
+                Util::uint32_t iDeltaKeyframeInterval )
   : m_fileName( iFileName )
   , m_metaData( iMetaData )
-  , m_archive( iFileName )
+  , m_profiler( new WriteProfiler() )
+  , m_archive( iFileName, iAppend )
   , m_metaDataMap( new MetaDataMap() )
+  , m_packScalarSamples( iPackScalarSamples )
+  , m_inlineSmallSamples( iInlineSmallSamples )
+  , m_deltaKeyframeInterval( iDeltaKeyframeInterval > 1 ?
+                             iDeltaKeyframeInterval : 0 )
+  , m_sampleKeyType( AbcA::kMurmur3SampleKey )
+  , m_numKeyThreads( 1 )
+  , m_instanceIdenticalObjects( false )
 {
 
     // add default time sampling
@@ -62,15 +77,36 @@ AwImpl::AwImpl( const std::string &iFileName,
         ABCA_THROW( "Could not open file: " << m_fileName );
     }
 
+    if ( iAppend )
+    {
+        // a separate reader, nothing we append is visible to it
+        m_existing = Alembic::Util::dynamic_pointer_cast< ArImpl,
+            AbcA::ArchiveReader >( ReadArchive( 1, false )( iFileName ) );
+    }
+
+    m_archive.setDataAlignment( iDataAlignment );
+
     init();
 }
 
 //-*****************************************************************************
 AwImpl::AwImpl( std::ostream * iStream,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                bool iPackScalarSamples,
+                bool iInlineSmallSamples,
+                Util::uint32_t iDataAlignment,
+                Util::uint32_t iDeltaKeyframeInterval )
   : m_metaData( iMetaData )
+  , m_profiler( new WriteProfiler() )
   , m_archive( iStream )
   , m_metaDataMap( new MetaDataMap() )
+  , m_packScalarSamples( iPackScalarSamples )
+  , m_inlineSmallSamples( iInlineSmallSamples )
+  , m_deltaKeyframeInterval( iDeltaKeyframeInterval > 1 ?
+                             iDeltaKeyframeInterval : 0 )
+  , m_sampleKeyType( AbcA::kMurmur3SampleKey )
+  , m_numKeyThreads( 1 )
+  , m_instanceIdenticalObjects( false )
 {
     // add default time sampling
     AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling() );
@@ -82,6 +118,8 @@ AwImpl::AwImpl( std::ostream * iStream,
         ABCA_THROW( "Could not use the given ostream." );
     }
 
+    m_archive.setDataAlignment( iDataAlignment );
+
     init();
 }
 
@@ -91,7 +129,52 @@ void AwImpl::init()
     // set the version using Ogawa native calls
     // This expresses the AbcCoreOgawa version - how properties,
     // are stored within Ogawa, etc.
-    Util::int32_t version = ALEMBIC_OGAWA_FILE_VERSION;
+    // Only use the newer version if we need it.
+    Util::int32_t version = ALEMBIC_OGAWA_BASE_FILE_VERSION;
+    if ( m_deltaKeyframeInterval > 0 )
+    {
+        version = ALEMBIC_OGAWA_FILE_VERSION;
+    }
+    else if ( m_packScalarSamples )
+    {
+        version = ALEMBIC_OGAWA_PACKED_FILE_VERSION;
+    }
+
+    Ogawa::IGroupPtr existingGroup;
+    if ( m_existing )
+    {
+        existingGroup = m_existing->getGroup();
+
+        // whatever the existing samples needed they still need
+        Util::int32_t existingVersion = ALEMBIC_OGAWA_BASE_FILE_VERSION;
+        existingGroup->getData( 0, 0 )->read( 4, &existingVersion, 0, 0 );
+        if ( existingVersion > version )
+        {
+            version = existingVersion;
+        }
+
+        m_timeSamples.clear();
+        m_maxSamples.clear();
+        for ( Util::uint32_t i = 0; i < m_existing->getNumTimeSamplings();
+              ++i )
+        {
+            m_timeSamples.push_back( AbcA::TimeSamplingPtr(
+                new AbcA::TimeSampling( *m_existing->getTimeSampling( i ) ) ) );
+            m_maxSamples.push_back(
+                m_existing->getMaxNumSamplesForTimeSamplingIndex( i ) );
+        }
+
+        // the existing headers refer to the existing meta data indices
+        m_metaDataMap->seed( m_existing->getIndexedMetaData() );
+
+        // new samples need keys that can be compared with the existing ones
+        m_sampleKeyType = m_existing->sampleKeyType();
+
+        AbcA::MetaData metaData = m_existing->getMetaData();
+        metaData.append( m_metaData );
+        m_metaData = metaData;
+    }
+
     m_archive.getGroup()->addData( 4, &version );
 
     // This is the Alembic library version XXYYZZ
@@ -102,11 +185,33 @@ void AwImpl::init()
 
     m_metaData.set("_ai_AlembicVersion", AbcA::GetLibraryVersion());
 
-    m_data.reset( new OwData( m_archive.getGroup()->addGroup() ) );
+    if ( m_archive.getDataAlignment() > 1 )
+    {
+        std::ostringstream alignment;
+        alignment << m_archive.getDataAlignment();
+        m_metaData.set( "_ai_DataAlignment", alignment.str() );
+    }
+
+    if ( existingGroup )
+    {
+        m_data.reset( new OwData( m_archive.getGroup()->addGroup(),
+            existingGroup->getGroup( 2, false, 0 ), "/", m_existing ) );
+    }
+    else
+    {
+        m_data.reset( new OwData( m_archive.getGroup()->addGroup() ) );
+    }
 
+    seedEmptyKeys();
+}
+
+//-*****************************************************************************
+void AwImpl::seedEmptyKeys()
+{
     // seed with the common empty keys
     AbcA::ArraySampleKey emptyKey;
     emptyKey.numBytes = 0;
+    emptyKey.keyType = m_sampleKeyType;
     Ogawa::ODataPtr emptyData( new Ogawa::OData() );
 
     emptyKey.origPOD = Alembic::Util::kInt8POD;
@@ -143,6 +248,88 @@ AbcA::ArchiveWriterPtr AwImpl::asArchivePtr()
     return shared_from_this();
 }
 
+//-*****************************************************************************
+void AwImpl::enableAsyncWrites( std::size_t iNumHashThreads,
+                                Util::uint64_t iMaxQueuedBytes )
+{
+    m_asyncWriter.reset( new AsyncWriter( iNumHashThreads,
+                                          iMaxQueuedBytes,
+                                          m_sampleKeyType,
+                                          m_numKeyThreads,
+                                          m_profiler ) );
+}
+
+//-*****************************************************************************
+void AwImpl::useChunkedSampleKeys( std::size_t iNumThreads )
+{
+    // an archive we are appending to keeps the kind of keys it already has
+    if ( m_existing && m_sampleKeyType != AbcA::kChunkedSampleKey )
+    {
+        return;
+    }
+
+    m_sampleKeyType = AbcA::kChunkedSampleKey;
+    m_numKeyThreads = iNumThreads;
+
+    // readers need to know what kind of keys they are getting
+    std::ostringstream keyType;
+    keyType << ( int ) m_sampleKeyType;
+    m_metaData.set( "_ai_SampleKeyType", keyType.str() );
+
+    // the empty keys seeded by init are of the wrong type now
+    seedEmptyKeys();
+}
+
+//-*****************************************************************************
+std::string AwImpl::findInstanceSource( const Util::Digest & iKey,
+                                        const std::string & iFullName )
+{
+    InstanceSources::iterator source = m_instanceSources.find( iKey );
+    if ( source == m_instanceSources.end() )
+    {
+        // we are the first, so later objects can be instances of us
+        m_instanceSources[iKey] = iFullName;
+        m_instanceSourceKeys[iFullName] = iKey;
+        return std::string();
+    }
+
+    // an instance already points somewhere underneath us, so we have to stay
+    // as we are or it would end up pointing at itself
+    std::string prefix = iFullName + "/";
+    std::set< std::string >::iterator used =
+        m_usedInstanceSources.lower_bound( prefix );
+    if ( used != m_usedInstanceSources.end() &&
+         used->compare( 0, prefix.size(), prefix ) == 0 )
+    {
+        return std::string();
+    }
+
+    // nothing underneath us will be written as is anymore, so it can't be
+    // the source of any other instances
+    InstanceSourceKeys::iterator first =
+        m_instanceSourceKeys.lower_bound( prefix );
+    InstanceSourceKeys::iterator last = first;
+    while ( last != m_instanceSourceKeys.end() &&
+            last->first.compare( 0, prefix.size(), prefix ) == 0 )
+    {
+        m_instanceSources.erase( last->second );
+        ++last;
+    }
+    m_instanceSourceKeys.erase( first, last );
+
+    m_usedInstanceSources.insert( source->second );
+    return source->second;
+}
+
+//-*****************************************************************************
+void AwImpl::flush()
+{
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->flush();
+    }
+}
+
 //-*****************************************************************************
 AbcA::ObjectWriterPtr AwImpl::getTop()
 {
@@ -212,9 +399,32 @@ void AwImpl::setMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
     }
 }
 
+//-*****************************************************************************
+void AwImpl::enableWriteProfile( const std::string & iFileName )
+{
+    m_profiler->enable( iFileName );
+    m_archive.setProfile( m_profiler->getStreamProfile() );
+    m_writtenSampleMap.setProfiler( m_profiler );
+}
+
+//-*****************************************************************************
+AbcA::WriteProfile AwImpl::getWriteProfile()
+{
+    return m_profiler->getProfile();
+}
+
 //-*****************************************************************************
 AwImpl::~AwImpl()
 {
+    // m_profiler is let go of after m_archive, once everything is written
+    if ( m_profiler->isEnabled() )
+    {
+        m_profiler->startClose();
+    }
+
+    // finish off any samples that are still in flight, any errors should
+    // have been picked up via flush
+    m_asyncWriter.reset();
 
     // empty out the map so any dataset IDs will be freed up
     m_writtenSampleMap.clear();
@@ -222,6 +432,7 @@ AwImpl::~AwImpl()
     // write out our child headers
     if ( m_data )
     {
+        ProfilePhaseScope phase( m_profiler, WriteProfiler::kHeadersPhase );
         Util::SpookyHash hash;
         m_data->writeHeaders( m_metaDataMap, hash );
     }
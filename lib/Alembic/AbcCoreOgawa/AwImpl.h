@@ -38,7 +38,9 @@
 #define Alembic_AbcCoreOgawa_AwImpl_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/AsyncWriter.h>
 #include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
+#include <Alembic/AbcCoreOgawa/WriteProfiler.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
 namespace Alembic {
@@ -48,6 +50,7 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 class OwData;
 class OwImpl;
+class ArImpl;
 
 //-*****************************************************************************
 class AwImpl : public AbcA::ArchiveWriter
@@ -56,11 +59,22 @@ class AwImpl : public AbcA::ArchiveWriter
 private:
     friend class WriteArchive;
 
+    // With iAppend iFileName has to be an existing Ogawa archive, which is
+    // added to instead of being replaced.
     AwImpl( const std::string &iFileName,
-            const AbcA::MetaData &iMetaData );
+            const AbcA::MetaData &iMetaData,
+            bool iPackScalarSamples = false,
+            bool iInlineSmallSamples = false,
+            Util::uint32_t iDataAlignment = 0,
+            bool iAppend = false,
+            Util::uint32_t iDeltaKeyframeInterval = 0 );
 
     AwImpl( std::ostream * iStream,
-            const AbcA::MetaData & iMetaData );
+            const AbcA::MetaData & iMetaData,
+            bool iPackScalarSamples = false,
+            bool iInlineSmallSamples = false,
+            Util::uint32_t iDataAlignment = 0,
+            Util::uint32_t iDeltaKeyframeInterval = 0 );
 
 public:
     virtual ~AwImpl();
@@ -76,6 +90,12 @@ public:
 
     virtual AbcA::ArchiveWriterPtr asArchivePtr();
 
+    virtual void flush();
+
+    virtual void enableWriteProfile( const std::string & iFileName );
+
+    virtual AbcA::WriteProfile getWriteProfile();
+
     //-*************************************************************************
     // GLOBAL FILE CONTEXT STUFF.
     //-*************************************************************************
@@ -89,6 +109,83 @@ public:
         return m_metaDataMap;
     }
 
+    // whether fixed size scalar properties should pack all of their samples
+    // into a single block
+    bool packScalarSamples() const
+    {
+        return m_packScalarSamples;
+    }
+
+    // whether tiny scalar samples should be stored inline in their
+    // property's Ogawa group
+    bool inlineSmallSamples() const
+    {
+        return m_inlineSmallSamples;
+    }
+
+    // how many stored samples of a float array property may share a
+    // keyframe, 0 if those samples aren't delta encoded at all, see
+    // WriteArchive::setFloatDeltaEncoding
+    Util::uint32_t deltaKeyframeInterval() const
+    {
+        return m_deltaKeyframeInterval;
+    }
+
+    // what kind of keys samples get, see AbcA::ArraySample::getKey
+    AbcA::ArraySampleKeyType sampleKeyType() const
+    {
+        return m_sampleKeyType;
+    }
+
+    // how many threads may be used to compute a single key
+    std::size_t numKeyThreads() const
+    {
+        return m_numKeyThreads;
+    }
+
+    // whether objects whose hierarchy is identical to one that has already
+    // been written should be written as instances of it instead
+    bool instanceIdenticalObjects() const
+    {
+        return m_instanceIdenticalObjects;
+    }
+
+    // Returns the full name of the object that iFullName can be written as
+    // an instance of, or an empty string if it has to be written as is.
+    // iKey hashes everything about the object except for its name.
+    std::string findInstanceSource( const Util::Digest & iKey,
+                                    const std::string & iFullName );
+
+    // The archive we are appending to, as it was before we started, NULL if
+    // we aren't appending.
+    Util::shared_ptr< ArImpl > getExistingArchive() const
+    {
+        return m_existing;
+    }
+
+    // always there, but only measures anything once enableWriteProfile
+    // has been called
+    WriteProfilerPtr getWriteProfiler() const
+    {
+        return m_profiler;
+    }
+
+    // NULL unless samples are hashed and written on other threads
+    AsyncWriterPtr getAsyncWriter() const
+    {
+        return m_asyncWriter;
+    }
+
+    // wait for any samples which are being written on other threads, this
+    // must be done before anything else is written to the archive
+    void drainAsyncWrites()
+    {
+        if ( m_asyncWriter )
+        {
+            m_asyncWriter->drain();
+        }
+    }
+
     virtual Util::uint32_t addTimeSampling( const AbcA::TimeSampling & iTs );
 
     virtual AbcA::TimeSamplingPtr getTimeSampling( Util::uint32_t iIndex );
@@ -104,10 +201,37 @@ public:
 
 private:
     void init();
+
+    // let the written sample map know about the empty samples, which are
+    // always already "written"
+    void seedEmptyKeys();
+
+    // called by WriteArchive right after construction, before anything
+    // has a chance to set any samples
+    void enableAsyncWrites( std::size_t iNumHashThreads,
+                            Util::uint64_t iMaxQueuedBytes );
+
+    // called by WriteArchive right after construction, before
+    // enableAsyncWrites
+    void useChunkedSampleKeys( std::size_t iNumThreads );
+
+    // called by WriteArchive right after construction
+    void useInstanceIdenticalObjects()
+    {
+        m_instanceIdenticalObjects = true;
+    }
+
     std::string m_fileName;
     AbcA::MetaData m_metaData;
+
+    // declared before m_archive so that it outlives it, see ~AwImpl
+    WriteProfilerPtr m_profiler;
+
     Alembic::Ogawa::OArchive m_archive;
 
+    // see getExistingArchive
+    Util::shared_ptr< ArImpl > m_existing;
+
     Alembic::Util::weak_ptr< AbcA::ObjectWriter > m_top;
     Alembic::Util::shared_ptr < OwData > m_data;
 
@@ -117,6 +241,25 @@ private:
 
     WrittenSampleMap m_writtenSampleMap;
     MetaDataMapPtr m_metaDataMap;
+
+    bool m_packScalarSamples;
+    bool m_inlineSmallSamples;
+    Util::uint32_t m_deltaKeyframeInterval;
+
+    AbcA::ArraySampleKeyType m_sampleKeyType;
+    std::size_t m_numKeyThreads;
+
+    AsyncWriterPtr m_asyncWriter;
+
+    bool m_instanceIdenticalObjects;
+
+    // the first object written with a given key, and the reverse lookup,
+    // and the objects which instances have been written of
+    typedef std::map< Util::Digest, std::string > InstanceSources;
+    typedef std::map< std::string, Util::Digest > InstanceSourceKeys;
+    InstanceSources m_instanceSources;
+    InstanceSourceKeys m_instanceSourceKeys;
+    std::set< std::string > m_usedInstanceSources;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
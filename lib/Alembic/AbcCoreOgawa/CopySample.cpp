@@ -0,0 +1,151 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#include <Alembic/AbcCoreOgawa/CopySample.h>
+#include <Alembic/AbcCoreOgawa/AprImpl.h>
+#include <Alembic/AbcCoreOgawa/ApwImpl.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+void CopySample( AbcA::ArrayPropertyReaderPtr iReader,
+                 index_t iSampleIndex,
+                 AbcA::ArrayPropertyWriterPtr iWriter )
+{
+    ABCA_ASSERT( iReader && iWriter,
+                 "CopySample() passed a bogus property" );
+
+    Alembic::Util::shared_ptr< AprImpl > reader =
+        Alembic::Util::dynamic_pointer_cast< AprImpl,
+            AbcA::ArrayPropertyReader >( iReader );
+
+    Alembic::Util::shared_ptr< ApwImpl > writer =
+        Alembic::Util::dynamic_pointer_cast< ApwImpl,
+            AbcA::ArrayPropertyWriter >( iWriter );
+
+    // keys of different types can't be shared, so rehash
+    if ( !reader || !writer ||
+         reader->getSampleKeyType() != writer->getSampleKeyType() )
+    {
+        AbcA::ArraySamplePtr samp;
+        iReader->getSample( iSampleIndex, samp );
+        iWriter->setSample( samp );
+        return;
+    }
+
+    AbcA::ArraySample::Key key;
+    Util::Dimensions dims;
+    std::vector< Util::uint8_t > data;
+    const AbcA::DataType & dataType = reader->getHeader().getDataType();
+
+    // deltas go over as they are when both properties are delta encoded,
+    // and only get decoded when the writer can't take them
+    Util::Digest from;
+    if ( reader->getRawDelta( iSampleIndex, key, dims, from, data ) &&
+         writer->setRawDelta( AbcA::ArraySample( NULL, dataType, dims ), key,
+                              from, data ) )
+    {
+        return;
+    }
+
+    reader->getRawSample( iSampleIndex, key, dims, data );
+    std::vector< Util::uint8_t > packed;
+    const void * samp = NULL;
+    if ( dataType.getPod() == Util::kStringPOD ||
+         dataType.getPod() == Util::kWstringPOD )
+    {
+        packed.swap( data );
+    }
+    else if ( !data.empty() )
+    {
+        samp = &data.front();
+    }
+
+    writer->setRawSample( AbcA::ArraySample( samp, dataType, dims ), key,
+                          packed );
+}
+
+//-*****************************************************************************
+void CopyProperty( AbcA::ArrayPropertyReaderPtr iReader,
+                   AbcA::ArrayPropertyWriterPtr iWriter )
+{
+    ABCA_ASSERT( iReader && iWriter,
+                 "CopyProperty() passed a bogus property" );
+
+    size_t numSamples = iReader->getNumSamples();
+    for ( size_t i = 0; i < numSamples; ++i )
+    {
+        CopySample( iReader, i, iWriter );
+    }
+}
+
+//-*****************************************************************************
+void CopySample( AbcA::ScalarPropertyReaderPtr iReader,
+                 index_t iSampleIndex,
+                 AbcA::ScalarPropertyWriterPtr iWriter )
+{
+    ABCA_ASSERT( iReader && iWriter,
+                 "CopySample() passed a bogus property" );
+
+    // big enough for any scalar, including strings and wstrings
+    AbcA::ArraySamplePtr samp = AbcA::AllocateArraySample(
+        iReader->getHeader().getDataType(), Util::Dimensions( 1 ) );
+
+    void * data = const_cast< void * >( samp->getData() );
+    iReader->getSample( iSampleIndex, data );
+    iWriter->setSample( data );
+}
+
+//-*****************************************************************************
+void CopyProperty( AbcA::ScalarPropertyReaderPtr iReader,
+                   AbcA::ScalarPropertyWriterPtr iWriter )
+{
+    ABCA_ASSERT( iReader && iWriter,
+                 "CopyProperty() passed a bogus property" );
+
+    size_t numSamples = iReader->getNumSamples();
+    for ( size_t i = 0; i < numSamples; ++i )
+    {
+        CopySample( iReader, i, iWriter );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
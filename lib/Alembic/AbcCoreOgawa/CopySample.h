@@ -0,0 +1,86 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#ifndef Alembic_AbcCoreOgawa_CopySample_h
+#define Alembic_AbcCoreOgawa_CopySample_h
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/Util/Export.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Copies sample iSampleIndex of iReader onto the end of iWriter.
+//!
+//! When both properties belong to Ogawa archives whose samples get the same
+//! kind of keys, the stored key and data are written to iWriter exactly as
+//! they were read, without decoding the sample or hashing it again.  Delta
+//! encoded samples stay deltas if iWriter delta encodes too, and are only
+//! decoded and encoded again where it wouldn't have stored a delta.
+//! Otherwise the sample is read and set like any other.
+ALEMBIC_EXPORT void
+CopySample( ::Alembic::AbcCoreAbstract::ArrayPropertyReaderPtr iReader,
+            ::Alembic::AbcCoreAbstract::index_t iSampleIndex,
+            ::Alembic::AbcCoreAbstract::ArrayPropertyWriterPtr iWriter );
+
+//! Copies every sample of iReader onto the end of iWriter, as above.
+ALEMBIC_EXPORT void
+CopyProperty( ::Alembic::AbcCoreAbstract::ArrayPropertyReaderPtr iReader,
+              ::Alembic::AbcCoreAbstract::ArrayPropertyWriterPtr iWriter );
+
+//-*****************************************************************************
+//! Scalar samples are small, and may be packed or inlined differently in
+//! the two archives, so these always read and set the sample.
+ALEMBIC_EXPORT void
+CopySample( ::Alembic::AbcCoreAbstract::ScalarPropertyReaderPtr iReader,
+            ::Alembic::AbcCoreAbstract::index_t iSampleIndex,
+            ::Alembic::AbcCoreAbstract::ScalarPropertyWriterPtr iWriter );
+
+ALEMBIC_EXPORT void
+CopyProperty( ::Alembic::AbcCoreAbstract::ScalarPropertyReaderPtr iReader,
+              ::Alembic::AbcCoreAbstract::ScalarPropertyWriterPtr iWriter );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
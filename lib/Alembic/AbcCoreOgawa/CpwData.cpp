@@ -40,6 +40,8 @@
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -47,10 +49,38 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 CpwData::CpwData( Ogawa::OGroupPtr iGroup )
-    : m_group( iGroup )
+    : m_group( iGroup ), m_numExisting( 0 )
 {
 }
 
+//-*****************************************************************************
+CpwData::CpwData( Ogawa::OGroupPtr iGroup,
+                  Ogawa::IGroupPtr iExisting,
+                  Alembic::Util::shared_ptr< ArImpl > iArchive )
+    : m_group( iGroup ), m_existing( iExisting )
+    , m_existingArchive( iArchive ), m_numExisting( 0 )
+{
+    ABCA_ASSERT( m_existing && m_existingArchive,
+                 "Invalid existing compound property" );
+
+    std::size_t numChildren = m_existing->getNumChildren();
+    if ( numChildren > 0 && m_existing->isChildData( numChildren - 1 ) )
+    {
+        ReadPropertyHeaders( m_existing, numChildren - 1, 0,
+                             *m_existingArchive,
+                             m_existingArchive->getIndexedMetaData(),
+                             m_propertyHeaders );
+    }
+
+    // the existing properties are referenced until they are reopened
+    m_numExisting = m_propertyHeaders.size();
+    for ( std::size_t i = 0; i < m_numExisting; ++i )
+    {
+        m_group->addExistingGroup( m_existing->getGroup( i, true, 0 ) );
+    }
+    m_hashes.resize( m_numExisting * 2, 0 );
+}
+
 //-*****************************************************************************
 CpwData::~CpwData()
 {
@@ -95,17 +125,46 @@ CpwData::getPropertyHeader( const std::string &iName )
 
 //-*****************************************************************************
 AbcA::BasePropertyWriterPtr
-CpwData::getProperty( const std::string &iName )
+CpwData::getProperty( AbcA::CompoundPropertyWriterPtr iParent,
+                      const std::string &iName )
 {
     MadeProperties::iterator fiter = m_madeProperties.find( iName );
-    if ( fiter == m_madeProperties.end() )
+    if ( fiter != m_madeProperties.end() )
     {
-        return AbcA::BasePropertyWriterPtr();
+        WeakBpwPtr wptr = (*fiter).second;
+        return wptr.lock();
     }
 
-    WeakBpwPtr wptr = (*fiter).second;
+    for ( size_t i = 0; i < m_numExisting; ++i )
+    {
+        PropertyHeaderPtr header = m_propertyHeaders[i];
+        if ( header->header.getName() != iName )
+        {
+            continue;
+        }
+
+        Ogawa::OGroupPtr group = m_group->replaceGroup( i );
+        Ogawa::IGroupPtr existing = m_existing->getGroup( i, false, 0 );
+
+        AbcA::BasePropertyWriterPtr ret;
+        if ( header->header.isScalar() )
+        {
+            ret.reset( new SpwImpl( iParent, group, header, i, existing ) );
+        }
+        else if ( header->header.isArray() )
+        {
+            ret.reset( new ApwImpl( iParent, group, header, i, existing ) );
+        }
+        else
+        {
+            ret.reset( new CpwImpl( iParent, group, header, i, existing ) );
+        }
+
+        m_madeProperties[iName] = WeakBpwPtr( ret );
+        return ret;
+    }
 
-    return wptr.lock();
+    return AbcA::BasePropertyWriterPtr();
 }
 
 //-*****************************************************************************
@@ -116,7 +175,8 @@ CpwData::createScalarProperty( AbcA::CompoundPropertyWriterPtr iParent,
                                const AbcA::DataType & iDataType,
                                Util::uint32_t iTimeSamplingIndex )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) ||
+         ( m_numExisting > 0 && getPropertyHeader( iName ) ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -158,7 +218,8 @@ CpwData::createArrayProperty( AbcA::CompoundPropertyWriterPtr iParent,
                               const AbcA::DataType & iDataType,
                               Util::uint32_t iTimeSamplingIndex )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) ||
+         ( m_numExisting > 0 && getPropertyHeader( iName ) ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -198,7 +259,8 @@ CpwData::createCompoundProperty( AbcA::CompoundPropertyWriterPtr iParent,
                                  const std::string & iName,
                                  const AbcA::MetaData & iMetaData )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) ||
+         ( m_numExisting > 0 && getPropertyHeader( iName ) ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -231,6 +293,8 @@ void CpwData::writePropertyHeaders( MetaDataMapPtr iMetaDataMap )
                            prop->header,
                            prop->isScalarLike,
                            prop->isHomogenous,
+                           prop->isPacked,
+                           prop->isDeltaEncoded,
                            prop->timeSamplingIndex,
                            prop->nextSampleIndex,
                            prop->firstChangedIndex,
@@ -260,12 +324,31 @@ void CpwData::fillHash( size_t iIndex, Util::uint64_t iHash0,
 //-*****************************************************************************
 void CpwData::computeHash( Util::SpookyHash & ioHash )
 {
+    // the existing properties which weren't reopened still need their hashes
+    for ( size_t i = 0; i < m_numExisting; ++i )
+    {
+        PropertyHeaderPtr header = m_propertyHeaders[i];
+        if ( !m_madeProperties.count( header->header.getName() ) )
+        {
+            HashExistingProperty( m_existing->getGroup( i, false, 0 ),
+                *header, *m_existingArchive, m_hashes[i * 2],
+                m_hashes[i * 2 + 1] );
+        }
+    }
+
     if ( !m_hashes.empty() )
     {
         ioHash.Update( &m_hashes.front(), m_hashes.size() * 8 );
     }
 }
 
+//-*****************************************************************************
+bool CpwData::isUnchanged()
+{
+    return m_madeProperties.empty() &&
+        m_propertyHeaders.size() == m_numExisting;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
@@ -44,6 +44,8 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
+
 // data class owned by CpwImpl, or OwImpl if it is a "top" object
 // it owns and makes child properties as well as the group hid_t
 // when necessary
@@ -53,6 +55,13 @@ public:
 
     CpwData( Ogawa::OGroupPtr iGroup );
 
+    // Reopens the existing compound property iExisting of the archive being
+    // appended to.  Its headers are written again into iGroup, its
+    // properties stay where they are unless they are reopened too.
+    CpwData( Ogawa::OGroupPtr iGroup,
+             Ogawa::IGroupPtr iExisting,
+             Alembic::Util::shared_ptr< ArImpl > iArchive );
+
     ~CpwData();
 
     size_t getNumProperties();
@@ -61,7 +70,10 @@ public:
 
     const AbcA::PropertyHeader * getPropertyHeader( const std::string &iName );
 
-    AbcA::BasePropertyWriterPtr getProperty( const std::string & iName );
+    // existing properties are reopened the first time they are asked for
+    AbcA::BasePropertyWriterPtr
+    getProperty( AbcA::CompoundPropertyWriterPtr iParent,
+                 const std::string & iName );
 
     AbcA::ScalarPropertyWriterPtr
     createScalarProperty( AbcA::CompoundPropertyWriterPtr iParent,
@@ -89,6 +101,9 @@ public:
 
     void computeHash( Util::SpookyHash & ioHash );
 
+    // whether no properties have been created or reopened
+    bool isUnchanged();
+
 private:
 
     // The group corresponding to this property.
@@ -101,6 +116,12 @@ private:
 
     // child hashes
     std::vector< Util::uint64_t > m_hashes;
+
+    // What we reopened, if anything.  The first m_numExisting properties
+    // are the existing ones.
+    Ogawa::IGroupPtr m_existing;
+    Alembic::Util::shared_ptr< ArImpl > m_existingArchive;
+    std::size_t m_numExisting;
 };
 
 typedef Alembic::Util::shared_ptr<CpwData> CpwDataPtr;
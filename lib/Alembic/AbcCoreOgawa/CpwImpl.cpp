@@ -62,7 +62,8 @@ CpwImpl::CpwImpl( AbcA::ObjectWriterPtr iParent,
 CpwImpl::CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                   Ogawa::OGroupPtr iGroup,
                   PropertyHeaderPtr iHeader,
-                  size_t iIndex )
+                  size_t iIndex,
+                  Ogawa::IGroupPtr iExisting )
   : m_parent( iParent )
   , m_header( iHeader )
   , m_index( iIndex )
@@ -79,7 +80,19 @@ CpwImpl::CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                  m_header->header.getName().find('/') == std::string::npos,
                  "Invalid name" );
 
-    m_data.reset( new CpwData( iGroup ) );
+    if ( iExisting )
+    {
+        Util::shared_ptr< AwImpl > archive =
+            Alembic::Util::dynamic_pointer_cast< AwImpl,
+                AbcA::ArchiveWriter >( m_object->getArchive() );
+
+        m_data.reset( new CpwData( iGroup, iExisting,
+                                   archive->getExistingArchive() ) );
+    }
+    else
+    {
+        m_data.reset( new CpwData( iGroup ) );
+    }
 }
 
 //-*****************************************************************************
@@ -89,10 +102,19 @@ CpwImpl::~CpwImpl()
     // as part of their "top" compound
     if ( m_parent )
     {
-        MetaDataMapPtr mdMap = Alembic::Util::dynamic_pointer_cast<
-            AwImpl, AbcA::ArchiveWriter >(
-                getObject()->getArchive() )->getMetaDataMap();
-        m_data->writePropertyHeaders( mdMap );
+        Util::shared_ptr< AwImpl > archive =
+            Alembic::Util::dynamic_pointer_cast< AwImpl,
+                AbcA::ArchiveWriter >( getObject()->getArchive() );
+
+        // nothing else can be writing while we write our headers
+        archive->drainAsyncWrites();
+
+        MetaDataMapPtr mdMap = archive->getMetaDataMap();
+        {
+            ProfilePhaseScope phase( archive->getWriteProfiler(),
+                                     WriteProfiler::kHeadersPhase );
+            m_data->writePropertyHeaders( mdMap );
+        }
 
         Util::SpookyHash hash;
         hash.Init( 0, 0 );
@@ -155,7 +177,7 @@ CpwImpl::getPropertyHeader( const std::string &iName )
 //-*****************************************************************************
 AbcA::BasePropertyWriterPtr CpwImpl::getProperty( const std::string & iName )
 {
-    return m_data->getProperty( iName );
+    return m_data->getProperty( asCompoundPtr(), iName );
 }
 
 //-*****************************************************************************
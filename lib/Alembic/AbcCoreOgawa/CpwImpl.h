@@ -60,7 +60,8 @@ public:
     CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
              Ogawa::OGroupPtr iGroup,
              PropertyHeaderPtr iHeader,
-             size_t iIndex );
+             size_t iIndex,
+             Ogawa::IGroupPtr iExisting = Ogawa::IGroupPtr() );
 
     virtual ~CpwImpl();
 
@@ -46,6 +46,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <set>
 
 #include <iostream>
 
@@ -54,7 +55,14 @@
 #include <assert.h>
 #include <string.h>
 
-#define ALEMBIC_OGAWA_FILE_VERSION 0
+// The newest layout of properties within Ogawa that we know how to read.
+// Version 1 adds packed scalar samples, version 2 delta encoded float array
+// samples.  Writers only stamp an archive with a newer version when one of
+// the newer layouts was asked for, so that older readers can still open
+// everything else.
+#define ALEMBIC_OGAWA_FILE_VERSION 2
+#define ALEMBIC_OGAWA_PACKED_FILE_VERSION 1
+#define ALEMBIC_OGAWA_BASE_FILE_VERSION 0
 
 //-*****************************************************************************
 
@@ -82,6 +90,8 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isPacked = false;
+        isDeltaEncoded = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -95,6 +105,8 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isPacked = false;
+        isDeltaEncoded = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -113,6 +125,8 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isPacked = false;
+        isDeltaEncoded = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -154,6 +168,15 @@ struct PropertyHeaderAndFriends
 
     bool isHomogenous;
 
+    // Whether all of the samples of this scalar property live in a single
+    // packed Ogawa data block instead of one data block per sample.
+    bool isPacked;
+
+    // Whether some of the samples of this float array property are stored
+    // as deltas from the sample before them, see
+    // WriteArchive::setFloatDeltaEncoding.
+    bool isDeltaEncoded;
+
     // Index of the next sample to write
     Util::uint32_t nextSampleIndex;
 
@@ -60,10 +60,11 @@ Util::uint32_t MetaDataMap::getIndex( const std::string & iStr )
         }
         // 255 is reserved for meta data which we need to
         // explicitly write (and 0 means empty metadata)
-        else if ( it == m_map.end() && m_map.size() < 254 )
+        else if ( it == m_map.end() && m_strings.size() < 254 )
         {
-            Util::uint32_t index = m_map.size();
+            Util::uint32_t index = m_strings.size();
             m_map[iStr] = index;
+            m_strings.push_back( iStr );
             return index + 1;
         }
     }
@@ -76,26 +77,16 @@ Util::uint32_t MetaDataMap::getIndex( const std::string & iStr )
 void MetaDataMap::write( Ogawa::OGroupPtr iParent )
 {
 
-    if ( m_map.empty() )
+    if ( m_strings.empty() )
     {
         iParent->addEmptyData();
         return;
     }
 
-    std::vector< std::string > mdVec;
-    mdVec.resize( m_map.size() );
-
-    // lets put each string into it's vector slot
-    std::map< std::string, Util::uint32_t >::iterator it, itEnd;
-    for ( it = m_map.begin(), itEnd = m_map.end(); it != itEnd; ++it )
-    {
-        mdVec[ it->second ] = it->first;
-    }
-
     // now place it all into one continuous buffer
     std::vector< Util::uint8_t > buf;
     std::vector< std::string >::iterator jt, jtEnd;
-    for ( jt = mdVec.begin(), jtEnd = mdVec.end(); jt != jtEnd; ++jt )
+    for ( jt = m_strings.begin(), jtEnd = m_strings.end(); jt != jtEnd; ++jt )
     {
 
         // all these strings are less than 256 chars so just push back size
@@ -107,6 +98,27 @@ void MetaDataMap::write( Ogawa::OGroupPtr iParent )
     iParent->addData( buf.size(), ( const void * )&buf.front() );
 }
 
+//-*****************************************************************************
+void MetaDataMap::seed( const std::vector< AbcA::MetaData > & iMetaDataVec )
+{
+    m_map.clear();
+    m_strings.clear();
+
+    // the first one is the implicit empty meta data at index 0
+    for ( std::size_t i = 1; i < iMetaDataVec.size(); ++i )
+    {
+        std::string str = iMetaDataVec[i].serialize();
+
+        // the same string could show up twice, the first one wins the
+        // lookups but both indices have to stay valid
+        if ( m_map.find( str ) == m_map.end() )
+        {
+            m_map[str] = m_strings.size();
+        }
+        m_strings.push_back( str );
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
@@ -56,8 +56,15 @@ public:
     // 0 will be returned if iStr is empty
     Util::uint32_t getIndex( const std::string & iStr );
     void write( Ogawa::OGroupPtr iParent );
+
+    // starts off with the indexed meta data of an archive being appended to
+    // so that its indices stay the same
+    void seed( const std::vector< AbcA::MetaData > & iMetaDataVec );
 private:
     std::map< std::string, Util::uint32_t > m_map;
+
+    // the strings in index order
+    std::vector< std::string > m_strings;
 };
 
 typedef Alembic::Util::shared_ptr<MetaDataMap> MetaDataMapPtr;
@@ -40,13 +40,16 @@
 #include <Alembic/AbcCoreOgawa/OwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
-OwData::OwData( Ogawa::OGroupPtr iGroup ) : m_group( iGroup )
+OwData::OwData( Ogawa::OGroupPtr iGroup )
+    : m_group( iGroup ), m_numExisting( 0 )
 {
     // Check validity of all inputs.
     ABCA_ASSERT( m_group, "Invalid parent group" );
@@ -55,6 +58,56 @@ OwData::OwData( Ogawa::OGroupPtr iGroup ) : m_group( iGroup )
         new CpwData( m_group->addGroup() ) );
 }
 
+//-*****************************************************************************
+OwData::OwData( Ogawa::OGroupPtr iGroup,
+                Ogawa::IGroupPtr iExisting,
+                const std::string & iFullName,
+                Alembic::Util::shared_ptr< ArImpl > iArchive )
+    : m_group( iGroup ), m_existing( iExisting )
+    , m_existingArchive( iArchive ), m_numExisting( 0 )
+{
+    ABCA_ASSERT( m_group, "Invalid parent group" );
+    ABCA_ASSERT( m_existing && m_existingArchive,
+                 "Invalid existing object: " << iFullName );
+
+    std::size_t numChildren = m_existing->getNumChildren();
+
+    if ( numChildren > 0 && m_existing->isChildGroup( 0 ) )
+    {
+        m_data = Alembic::Util::shared_ptr<CpwData>( new CpwData(
+            m_group->addGroup(), m_existing->getGroup( 0, false, 0 ),
+            m_existingArchive ) );
+    }
+    else
+    {
+        m_data = Alembic::Util::shared_ptr<CpwData>(
+            new CpwData( m_group->addGroup() ) );
+    }
+
+    if ( numChildren > 0 && m_existing->isChildData( numChildren - 1 ) )
+    {
+        ReadObjectHeaders( m_existing, numChildren - 1, 0,
+                           iFullName == "/" ? "" : iFullName,
+                           m_existingArchive->getIndexedMetaData(),
+                           m_childHeaders );
+
+        // the data hash is stored right after the headers
+        Ogawa::IDataPtr data = m_existing->getData( numChildren - 1, 0 );
+        if ( data->getSize() >= 32 )
+        {
+            data->read( 16, m_existingDataHash.d, data->getSize() - 32, 0 );
+        }
+    }
+
+    // the existing children are referenced until they are reopened
+    m_numExisting = m_childHeaders.size();
+    for ( std::size_t i = 0; i < m_numExisting; ++i )
+    {
+        m_group->addExistingGroup( m_existing->getGroup( i + 1, true, 0 ) );
+    }
+    m_hashes.resize( m_numExisting * 2, 0 );
+}
+
 //-*****************************************************************************
 OwData::~OwData()
 {
@@ -112,16 +165,30 @@ const AbcA::ObjectHeader * OwData::getChildHeader( const std::string &iName )
 }
 
 //-*****************************************************************************
-AbcA::ObjectWriterPtr OwData::getChild( const std::string &iName )
+AbcA::ObjectWriterPtr OwData::getChild( AbcA::ObjectWriterPtr iParent,
+                                        const std::string &iName )
 {
     MadeChildren::iterator fiter = m_madeChildren.find( iName );
-    if ( fiter == m_madeChildren.end() )
+    if ( fiter != m_madeChildren.end() )
     {
-        return AbcA::ObjectWriterPtr();
+        WeakOwPtr wptr = (*fiter).second;
+        return wptr.lock();
+    }
+
+    for ( size_t i = 0; i < m_numExisting; ++i )
+    {
+        if ( m_childHeaders[i]->getName() == iName )
+        {
+            Alembic::Util::shared_ptr<OwImpl> ret( new OwImpl( iParent,
+                m_group->replaceGroup( i + 1 ), m_childHeaders[i], i,
+                m_existing->getGroup( i + 1, false, 0 ) ) );
+
+            m_madeChildren[iName] = WeakOwPtr( ret );
+            return ret;
+        }
     }
 
-    WeakOwPtr wptr = (*fiter).second;
-    return wptr.lock();
+    return AbcA::ObjectWriterPtr();
 }
 
 //-*****************************************************************************
@@ -131,7 +198,8 @@ AbcA::ObjectWriterPtr OwData::createChild( AbcA::ObjectWriterPtr iParent,
 {
     std::string name = iHeader.getName();
 
-    if ( m_madeChildren.count( name ) )
+    if ( m_madeChildren.count( name ) ||
+         ( m_numExisting > 0 && getChildHeader( name ) ) )
     {
         ABCA_THROW( "Already have an Object named: "
                      << name );
@@ -172,6 +240,12 @@ AbcA::ObjectWriterPtr OwData::createChild( AbcA::ObjectWriterPtr iParent,
     return ret;
 }
 
+//-*****************************************************************************
+Ogawa::OGroupPtr OwData::getGroup()
+{
+    return m_group;
+}
+
 //-*****************************************************************************
 void OwData::writeHeaders( MetaDataMapPtr iMetaDataMap,
                            Util::SpookyHash & ioHash )
@@ -184,12 +258,30 @@ void OwData::writeHeaders( MetaDataMapPtr iMetaDataMap,
         WriteObjectHeader( data, *m_childHeaders[i], iMetaDataMap );
     }
 
-    Util::SpookyHash dataHash;
-    dataHash.Init( 0, 0 );
-    m_data->computeHash( dataHash );
+    // the existing children which weren't reopened still need their hashes
+    for ( size_t i = 0; i < m_numExisting; ++i )
+    {
+        if ( !m_madeChildren.count( m_childHeaders[i]->getName() ) )
+        {
+            HashExistingObject( m_existing->getGroup( i + 1, false, 0 ),
+                *m_childHeaders[i], *m_existingArchive, m_hashes[i * 2],
+                m_hashes[i * 2 + 1] );
+        }
+    }
 
     Util::uint64_t hashes[4];
-    dataHash.Final( &hashes[0], &hashes[1] );
+    if ( m_existing && m_data->isUnchanged() )
+    {
+        hashes[0] = m_existingDataHash.words[0];
+        hashes[1] = m_existingDataHash.words[1];
+    }
+    else
+    {
+        Util::SpookyHash dataHash;
+        dataHash.Init( 0, 0 );
+        m_data->computeHash( dataHash );
+        dataHash.Final( &hashes[0], &hashes[1] );
+    }
 
     ioHash.Init( 0, 0 );
 
@@ -234,6 +326,49 @@ void OwData::fillHash( std::size_t iIndex, Util::uint64_t iHash0,
     m_hashes[ iIndex * 2 + 1 ] = iHash1;
 }
 
+//-*****************************************************************************
+bool OwData::isDoneWriting()
+{
+    if ( !m_top.expired() )
+    {
+        return false;
+    }
+
+    MadeChildren::iterator it;
+    for ( it = m_madeChildren.begin(); it != m_madeChildren.end(); ++it )
+    {
+        Alembic::Util::shared_ptr< OwImpl > child =
+            Alembic::Util::dynamic_pointer_cast< OwImpl, AbcA::ObjectWriter >(
+                it->second.lock() );
+
+        if ( child && !child->isFinalized() )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+bool OwData::isEmpty()
+{
+    return m_childHeaders.empty() && m_data->getNumProperties() == 0;
+}
+
+//-*****************************************************************************
+void OwData::replaceChild( size_t iIndex, ObjectHeaderPtr iHeader,
+                           Ogawa::OGroupPtr iGroup )
+{
+    ABCA_ASSERT( iIndex < m_childHeaders.size() && iHeader,
+                 "Invalid child index requested in OwData::replaceChild" );
+
+    m_childHeaders[iIndex] = iHeader;
+
+    // our properties are our first group, our children come after them
+    m_group->replaceGroup( iIndex + 1, iGroup );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
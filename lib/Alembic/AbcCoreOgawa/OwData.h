@@ -47,6 +47,7 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 // Forwards
 class CpwData;
+class ArImpl;
 
 // data class owned by OwImpl, or AwImpl if it is a "top" object.
 // it owns and makes child properties
@@ -55,6 +56,14 @@ class OwData : public Alembic::Util::enable_shared_from_this<OwData>
 public:
     OwData( Ogawa::OGroupPtr iGroup );
 
+    // Reopens the existing object iExisting of the archive being appended
+    // to.  Its properties and headers are written again into iGroup, its
+    // child objects stay where they are unless they are reopened too.
+    OwData( Ogawa::OGroupPtr iGroup,
+            Ogawa::IGroupPtr iExisting,
+            const std::string & iFullName,
+            Alembic::Util::shared_ptr< ArImpl > iArchive );
+
     ~OwData();
 
     AbcA::CompoundPropertyWriterPtr getProperties(
@@ -67,7 +76,9 @@ public:
     const AbcA::ObjectHeader *
     getChildHeader( const std::string &iName );
 
-    AbcA::ObjectWriterPtr getChild( const std::string &iName );
+    // existing children are reopened the first time they are asked for
+    AbcA::ObjectWriterPtr getChild( AbcA::ObjectWriterPtr iParent,
+                                    const std::string &iName );
 
     AbcA::ObjectWriterPtr createChild( AbcA::ObjectWriterPtr iParent,
                                        const std::string & iFullName,
@@ -80,6 +91,18 @@ public:
     void fillHash( std::size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
+    // whether our properties have been let go of, and all of our children
+    // have been let go of or finalized
+    bool isDoneWriting();
+
+    // whether we have neither properties nor children
+    bool isEmpty();
+
+    // Points child iIndex, whose group has already been frozen, at the
+    // frozen group iGroup and gives it the header iHeader instead.
+    void replaceChild( size_t iIndex, ObjectHeaderPtr iHeader,
+                       Ogawa::OGroupPtr iGroup );
+
 private:
 
     // The group corresponding to the object
@@ -99,6 +122,13 @@ private:
 
     // child hashes
     std::vector< Util::uint64_t > m_hashes;
+
+    // What we reopened, if anything.  The first m_numExisting children
+    // are the existing ones.
+    Ogawa::IGroupPtr m_existing;
+    Alembic::Util::shared_ptr< ArImpl > m_existingArchive;
+    std::size_t m_numExisting;
+    Util::Digest m_existingDataHash;
 };
 
 typedef Alembic::Util::shared_ptr<OwData> OwDataPtr;
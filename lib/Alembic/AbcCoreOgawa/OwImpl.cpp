@@ -73,36 +73,156 @@ OwImpl::OwImpl( AbcA::ObjectWriterPtr iParent,
     m_data.reset( new OwData( iGroup ) );
 }
 
+//-*****************************************************************************
+OwImpl::OwImpl( AbcA::ObjectWriterPtr iParent,
+                Ogawa::OGroupPtr iGroup,
+                ObjectHeaderPtr iHeader,
+                size_t iIndex,
+                Ogawa::IGroupPtr iExisting )
+  : m_parent( iParent )
+  , m_header( iHeader )
+  , m_index( iIndex )
+{
+    ABCA_ASSERT( m_parent, "Invalid parent" );
+    ABCA_ASSERT( m_header, "Invalid header" );
+
+    m_archive = m_parent->getArchive();
+    ABCA_ASSERT( m_archive, "Invalid archive" );
+
+    Util::shared_ptr< AwImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< AwImpl,
+            AbcA::ArchiveWriter >( m_archive );
+
+    m_data.reset( new OwData( iGroup, iExisting, m_header->getFullName(),
+                              archive->getExistingArchive() ) );
+}
+
 //-*****************************************************************************
 OwImpl::~OwImpl()
 {
     // The archive is responsible for writing the MetaData
-    if ( m_parent )
+    if ( m_parent && m_data )
+    {
+        writeHeaders();
+    }
+}
+
+//-*****************************************************************************
+void OwImpl::finalize()
+{
+    // the archive writes the top object, and there is nothing left to do
+    // if we've already been finalized
+    if ( !m_parent || !m_data )
     {
-        MetaDataMapPtr mdMap = Alembic::Util::dynamic_pointer_cast<
-            AwImpl, AbcA::ArchiveWriter >( m_archive )->getMetaDataMap();
+        return;
+    }
+
+    ABCA_ASSERT( m_data->isDoneWriting(), "Can't finalize "
+                 << m_header->getFullName() << " while its properties or "
+                 << "children are still being written." );
+
+    writeHeaders();
+
+    // our header and hash live on in our parent, everything else about us
+    // (including our Ogawa group, which is frozen as it goes) can go now
+    m_data.reset();
+}
+
+//-*****************************************************************************
+void OwImpl::writeHeaders()
+{
+    Util::shared_ptr< AwImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< AwImpl,
+            AbcA::ArchiveWriter >( m_archive );
 
-        Util::SpookyHash hash;
-        hash.Init(0, 0);
+    // nothing else can be writing while we write our headers
+    archive->drainAsyncWrites();
+
+    MetaDataMapPtr mdMap = archive->getMetaDataMap();
+
+    Util::SpookyHash hash;
+    hash.Init(0, 0);
+    {
+        ProfilePhaseScope phase( archive->getWriteProfiler(),
+                                 WriteProfiler::kHeadersPhase );
         m_data->writeHeaders( mdMap, hash );
+    }
+
+    // writeHeaders bakes in the child hashes and the data hash
+    // but we still need to bake in the name and MetaData
+    std::string metaDataStr = m_header->getMetaData().serialize();
+    if ( !metaDataStr.empty() )
+    {
+        hash.Update( &( metaDataStr[0] ), metaDataStr.size() );
+    }
+
+    // an instance of another object only needs the same everything but name
+    std::string instanceSource;
+    if ( archive->instanceIdenticalObjects() && !m_data->isEmpty() &&
+         m_header->getMetaData().get( "isInstance" ) != "1" )
+    {
+        Util::Digest key;
+        hash.Final( &key.words[0], &key.words[1] );
+        instanceSource = archive->findInstanceSource( key,
+            m_header->getFullName() );
+    }
 
-        // writeHeaders bakes in the child hashes and the data hash
-        // but we still need to bake in the name and MetaData
-        std::string metaDataStr = m_header->getMetaData().serialize();
-        if ( !metaDataStr.empty() )
-        {
-            hash.Update( &( metaDataStr[0] ), metaDataStr.size() );
-        }
-
-        hash.Update( &( m_header->getName()[0] ), m_header->getName().size() );
-        Util::uint64_t hash0, hash1;
-        hash.Final( &hash0, &hash1 );
-
-        Util::shared_ptr< OwImpl > parent =
-            Alembic::Util::dynamic_pointer_cast< OwImpl,
-                AbcA::ObjectWriter > ( m_parent );
-        parent->fillHash( m_index, hash0, hash1 );
+    hash.Update( &( m_header->getName()[0] ), m_header->getName().size() );
+    Util::uint64_t hash0, hash1;
+    hash.Final( &hash0, &hash1 );
+
+    if ( !instanceSource.empty() )
+    {
+        writeInstance( instanceSource );
     }
+
+    // even as an instance we keep our hash so that our parent still hashes
+    // the same as the source of any instance of it
+    Util::shared_ptr< OwImpl > parent =
+        Alembic::Util::dynamic_pointer_cast< OwImpl,
+            AbcA::ObjectWriter > ( m_parent );
+    parent->fillHash( m_index, hash0, hash1 );
+}
+
+//-*****************************************************************************
+void OwImpl::writeInstance( const std::string & iSource )
+{
+    // written the same way as Abc::OObject::addChildInstance
+    AbcA::MetaData md;
+    md.set( "isInstance", "1" );
+    ObjectHeaderPtr header( new AbcA::ObjectHeader( m_header->getName(),
+        m_header->getFullName(), md ) );
+
+    // what we've written so far is abandoned once our parent points at the
+    // instance, so it may as well hold the instance too
+    Ogawa::OGroupPtr group = m_data->getGroup()->addGroup();
+    {
+        Util::shared_ptr< OwImpl > instance(
+            new OwImpl( m_parent, group, header, m_index ) );
+
+        AbcA::ScalarPropertyWriterPtr source =
+            instance->getProperties()->createScalarProperty(
+                ".instanceSource", AbcA::MetaData(),
+                AbcA::DataType( Util::kStringPOD, 1 ), 0 );
+        source->setSample( &iSource );
+    }
+
+    // both groups have to be frozen before one can replace the other
+    group->freeze();
+    m_data->getGroup()->freeze();
+
+    Util::shared_ptr< OwImpl > parent =
+        Alembic::Util::dynamic_pointer_cast< OwImpl,
+            AbcA::ObjectWriter > ( m_parent );
+    parent->replaceChild( m_index, header, group );
+}
+
+//-*****************************************************************************
+OwDataPtr OwImpl::getData()
+{
+    ABCA_ASSERT( m_data, "Object " << m_header->getFullName()
+                 << " has already been finalized." );
+    return m_data;
 }
 
 //-*****************************************************************************
@@ -127,37 +247,37 @@ AbcA::ObjectWriterPtr OwImpl::getParent()
 //-*****************************************************************************
 AbcA::CompoundPropertyWriterPtr OwImpl::getProperties()
 {
-    return m_data->getProperties( asObjectPtr() );
+    return getData()->getProperties( asObjectPtr() );
 }
 
 //-*****************************************************************************
 size_t OwImpl::getNumChildren()
 {
-    return m_data->getNumChildren();
+    return getData()->getNumChildren();
 }
 
 //-*****************************************************************************
 const AbcA::ObjectHeader & OwImpl::getChildHeader( size_t i )
 {
-    return m_data->getChildHeader( i );
+    return getData()->getChildHeader( i );
 }
 
 const AbcA::ObjectHeader * OwImpl::getChildHeader( const std::string &iName )
 {
-    return m_data->getChildHeader( iName );
+    return getData()->getChildHeader( iName );
 }
 
 //-*****************************************************************************
 AbcA::ObjectWriterPtr OwImpl::getChild( const std::string &iName )
 {
-    return m_data->getChild( iName );
+    return getData()->getChild( asObjectPtr(), iName );
 }
 
 //-*****************************************************************************
 AbcA::ObjectWriterPtr OwImpl::createChild( const AbcA::ObjectHeader &iHeader )
 {
-    return m_data->createChild( asObjectPtr(), m_header->getFullName(),
-                                iHeader );
+    return getData()->createChild( asObjectPtr(), m_header->getFullName(),
+                                   iHeader );
 }
 
 //-*****************************************************************************
@@ -169,7 +289,14 @@ AbcA::ObjectWriterPtr OwImpl::asObjectPtr()
 void OwImpl::fillHash( size_t iIndex, Util::uint64_t iHash0,
                        Util::uint64_t iHash1 )
 {
-    m_data->fillHash( iIndex, iHash0, iHash1 );
+    getData()->fillHash( iIndex, iHash0, iHash1 );
+}
+
+//-*****************************************************************************
+void OwImpl::replaceChild( size_t iIndex, ObjectHeaderPtr iHeader,
+                           Ogawa::OGroupPtr iGroup )
+{
+    getData()->replaceChild( iIndex, iHeader, iGroup );
 }
 
 } // End namespace ALEMBIC_VERSION_NS
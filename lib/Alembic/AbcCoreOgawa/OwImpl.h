@@ -61,6 +61,13 @@ public:
             ObjectHeaderPtr iHeader,
             size_t iIndex );
 
+    // reopens the existing object iExisting, see OwData
+    OwImpl( AbcA::ObjectWriterPtr iParent,
+            Ogawa::OGroupPtr iGroup,
+            ObjectHeaderPtr iHeader,
+            size_t iIndex,
+            Ogawa::IGroupPtr iExisting );
+
     virtual ~OwImpl();
 
     //-*************************************************************************
@@ -89,10 +96,29 @@ public:
 
     virtual AbcA::ObjectWriterPtr asObjectPtr();
 
+    virtual void finalize();
+
+    // whether our headers have already been written by finalize
+    bool isFinalized() const { return !m_data; }
+
     void fillHash( size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
+    // see OwData::replaceChild
+    void replaceChild( size_t iIndex, ObjectHeaderPtr iHeader,
+                       Ogawa::OGroupPtr iGroup );
+
 private:
+    // write our headers and hand our hash to our parent
+    void writeHeaders();
+
+    // Writes an instance of iSource and has our parent use it in place of
+    // what we've already written, called by writeHeaders.
+    void writeInstance( const std::string & iSource );
+
+    // m_data, unless we've been finalized
+    OwDataPtr getData();
+
     // The parent object, NULL if it is the "top" object
     AbcA::ObjectWriterPtr m_parent;
 
@@ -103,6 +129,7 @@ private:
     ObjectHeaderPtr m_header;
 
     // child object data, this is owned by the archive for "top" objects
+    // and is let go of once we've been finalized
     OwDataPtr m_data;
 
     size_t m_index;
@@ -1307,6 +1307,56 @@ ConvertData( Alembic::Util::PlainOldDataType fromPod,
     }
 }
 
+//-*****************************************************************************
+bool
+IsDeltaEncodedData( Ogawa::IDataPtr iData, std::size_t iNumBytes )
+{
+    // whole samples are always the key and then iNumBytes
+    return iData && iData->getSize() > 16 &&
+        iData->getSize() - 16 < iNumBytes;
+}
+
+//-*****************************************************************************
+void
+DecodeFloatDelta( const std::vector< Util::uint8_t > & iEncoded,
+                  std::vector< Util::uint8_t > & ioData )
+{
+    std::size_t numWords = ioData.size() / 4;
+    std::size_t codesSize = ( numWords + 3 ) / 4;
+    std::size_t encodedSize = iEncoded.size();
+
+    ABCA_ASSERT( encodedSize >= 4 + codesSize,
+                 "Read invalid: Delta encoded sample is too small." );
+
+    std::size_t pos = 4 + codesSize;
+    for ( std::size_t i = 0; i < numWords; ++i )
+    {
+        Util::uint8_t code = ( iEncoded[4 + i / 4] >> ( ( i % 4 ) * 2 ) ) & 3;
+        if ( code == 0 )
+        {
+            continue;
+        }
+
+        std::size_t numChanged = code == 1 ? 2 : ( code == 2 ? 3 : 4 );
+        if ( pos + numChanged > encodedSize )
+        {
+            ABCA_THROW( "Read invalid: Delta encoded sample is too small." );
+        }
+
+        Util::uint32_t changed = 0;
+        for ( std::size_t j = 0; j < numChanged; ++j )
+        {
+            changed |= ( Util::uint32_t ) iEncoded[pos + j] << ( j * 8 );
+        }
+        pos += numChanged;
+
+        Util::uint32_t word;
+        memcpy( &word, &ioData[i * 4], 4 );
+        word ^= changed;
+        memcpy( &ioData[i * 4], &word, 4 );
+    }
+}
+
 //-*****************************************************************************
 void
 ReadData( void * iIntoLocation,
@@ -1348,9 +1398,11 @@ ReadData( void * iIntoLocation,
             reinterpret_cast< std::string * > ( iIntoLocation );
 
         std::size_t numChars = dataSize - 16;
-        char * buf = new char[ numChars ];
-        iData->read( numChars, buf, 16, iThreadId );
+        std::vector< char > buf( numChars );
+        iData->read( numChars, &buf.front(), 16, iThreadId );
 
+        // we already know where each string ends, so assign each one in a
+        // single copy instead of searching for the NULL again
         std::size_t startStr = 0;
         std::size_t strPos = 0;
 
@@ -1358,13 +1410,11 @@ ReadData( void * iIntoLocation,
         {
             if ( buf[i] == 0 )
             {
-                strPtr[strPos] = buf + startStr;
+                strPtr[strPos].assign( &buf[startStr], i - startStr );
                 startStr = i + 1;
                 strPos ++;
             }
         }
-
-        delete [] buf;
     }
     else if ( curPod == Alembic::Util::kWstringPOD )
     {
@@ -1377,27 +1427,24 @@ ReadData( void * iIntoLocation,
             reinterpret_cast< std::wstring * > ( iIntoLocation );
 
         std::size_t numChars = ( dataSize - 16 ) / 4;
-        Util::uint32_t * buf = new Util::uint32_t[ numChars ];
-        iData->read( dataSize - 16, buf, 16, iThreadId );
+        std::vector< Util::uint32_t > buf( numChars );
+        iData->read( dataSize - 16, &buf.front(), 16, iThreadId );
 
+        // wchar_t isn't always 32 bits, so we can't copy directly, but we can
+        // still size each wstring once and fill it in a single pass
+        std::size_t startStr = 0;
         std::size_t strPos = 0;
 
-        // push these one at a time until we can figure out how to cast like
-        // strings above
         for ( std::size_t i = 0; i < numChars; ++i )
         {
-            std::wstring & wstr = wstrPtr[strPos];
             if ( buf[i] == 0 )
             {
+                wstrPtr[strPos].assign( buf.begin() + startStr,
+                                        buf.begin() + i );
+                startStr = i + 1;
                 strPos ++;
             }
-            else
-            {
-                wstr.push_back( buf[i] );
-            }
         }
-
-        delete [] buf;
     }
     else if ( iAsPod == curPod )
     {
@@ -1682,6 +1729,12 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
     //
     // Meta data index mask 0xff00000
     // 0000 1111 1111 0000 0000 0000 0000 0000
+    //
+    // Whether the scalar samples are packed into one block mask 0x10000000
+    // 0001 0000 0000 0000 0000 0000 0000 0000
+    //
+    // Whether the array samples may be delta encoded mask 0x20000000
+    // 0010 0000 0000 0000 0000 0000 0000 0000
 
     Ogawa::IDataPtr data = iGroup->getData( iIndex, iThreadId );
     ABCA_ASSERT( data, "ReadObjectHeaders Invalid data at index " << iIndex );
@@ -1754,6 +1807,10 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
                 ( Util::PlainOldDataType ) podt, extent ) );
 
             header->isHomogenous = ( info & 0x400 ) != 0;
+            header->isPacked = header->header.isScalar() &&
+                ( info & 0x10000000 ) != 0;
+            header->isDeltaEncoded = header->header.isArray() &&
+                ( info & 0x20000000 ) != 0;
 
             header->nextSampleIndex = GetUint32WithHint( buf, bufSize, sizeHint, pos );
 
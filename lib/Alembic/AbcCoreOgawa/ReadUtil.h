@@ -56,6 +56,29 @@ ReadDimensions( Ogawa::IDataPtr iDims,
                 const AbcA::DataType &iDataType,
                 Util::Dimensions & oDim );
 
+//-*****************************************************************************
+// Converts iSize bytes of fromPod data in fromBuffer to toPod data in
+// toBuffer, which may be the same buffer if it is big enough.
+void
+ConvertData( Alembic::Util::PlainOldDataType fromPod,
+             Alembic::Util::PlainOldDataType toPod,
+             char * fromBuffer,
+             void * toBuffer,
+             std::size_t iSize );
+
+//-*****************************************************************************
+// Whether iData of a delta encoded property holds a delta instead of the
+// whole sample, which is iNumBytes big once decoded.
+bool
+IsDeltaEncodedData( Ogawa::IDataPtr iData, std::size_t iNumBytes );
+
+//-*****************************************************************************
+// Undoes EncodeFloatDelta.  ioData starts out as the sample iEncoded (which
+// doesn't include the key) is relative to and ends up as the decoded sample.
+void
+DecodeFloatDelta( const std::vector< Util::uint8_t > & iEncoded,
+                  std::vector< Util::uint8_t > & ioData );
+
 //-*****************************************************************************
 void
 ReadData( void * iIntoLocation,
@@ -46,6 +46,76 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 WriteArchive::WriteArchive()
 {
+    m_packScalarSamples = false;
+    m_inlineSmallSamples = false;
+    m_dataAlignment = 0;
+    m_numAsyncThreads = 0;
+    m_maxAsyncBytes = 0;
+    m_numChunkedKeyThreads = 0;
+    m_instanceIdenticalObjects = false;
+    m_append = false;
+    m_deltaKeyframeInterval = 0;
+}
+
+//-*****************************************************************************
+void WriteArchive::setPackScalarSamples( bool iPack )
+{
+    m_packScalarSamples = iPack;
+}
+
+//-*****************************************************************************
+void WriteArchive::setInlineSmallSamples( bool iInline )
+{
+    m_inlineSmallSamples = iInline;
+}
+
+//-*****************************************************************************
+// a page, anything more is just wasted padding
+const Util::uint32_t kMaxDataAlignment = 4096;
+
+//-*****************************************************************************
+void WriteArchive::setDataAlignment( Util::uint32_t iAlignment )
+{
+    if ( ( iAlignment & ( iAlignment - 1 ) ) != 0 ||
+         iAlignment > kMaxDataAlignment )
+    {
+        ABCA_THROW( "Data alignment must be a power of 2 no bigger than " <<
+                    kMaxDataAlignment << ", not " << iAlignment );
+    }
+
+    m_dataAlignment = iAlignment;
+}
+
+//-*****************************************************************************
+void WriteArchive::setAsyncWrites( std::size_t iNumHashThreads,
+                                   Util::uint64_t iMaxQueuedBytes )
+{
+    m_numAsyncThreads = iNumHashThreads;
+    m_maxAsyncBytes = iMaxQueuedBytes;
+}
+
+//-*****************************************************************************
+void WriteArchive::setChunkedSampleKeys( std::size_t iNumThreads )
+{
+    m_numChunkedKeyThreads = iNumThreads;
+}
+
+//-*****************************************************************************
+void WriteArchive::setInstanceIdenticalObjects( bool iInstance )
+{
+    m_instanceIdenticalObjects = iInstance;
+}
+
+//-*****************************************************************************
+void WriteArchive::setAppend( bool iAppend )
+{
+    m_append = iAppend;
+}
+
+//-*****************************************************************************
+void WriteArchive::setFloatDeltaEncoding( Util::uint32_t iKeyframeInterval )
+{
+    m_deltaKeyframeInterval = iKeyframeInterval;
 }
 
 //-*****************************************************************************
@@ -54,7 +124,25 @@ WriteArchive::operator()( const std::string &iFileName,
                           const AbcA::MetaData &iMetaData ) const
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
-        new AwImpl( iFileName, iMetaData ) );
+        new AwImpl( iFileName, iMetaData, m_packScalarSamples,
+                    m_inlineSmallSamples, m_dataAlignment, m_append,
+                    m_deltaKeyframeInterval ) );
+
+    if ( m_numChunkedKeyThreads > 0 )
+    {
+        archivePtr->useChunkedSampleKeys( m_numChunkedKeyThreads );
+    }
+
+    if ( m_instanceIdenticalObjects )
+    {
+        archivePtr->useInstanceIdenticalObjects();
+    }
+
+    if ( m_numAsyncThreads > 0 )
+    {
+        archivePtr->enableAsyncWrites( m_numAsyncThreads, m_maxAsyncBytes );
+    }
+
     return archivePtr;
 }
 
@@ -63,8 +151,29 @@ AbcA::ArchiveWriterPtr
 WriteArchive::operator()( std::ostream * iStream,
                           const AbcA::MetaData &iMetaData ) const
 {
+    ABCA_ASSERT( !m_append,
+                 "Can only append to archives given by file name" );
+
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
-        new AwImpl( iStream, iMetaData ) );
+        new AwImpl( iStream, iMetaData, m_packScalarSamples,
+                    m_inlineSmallSamples, m_dataAlignment,
+                    m_deltaKeyframeInterval ) );
+
+    if ( m_numChunkedKeyThreads > 0 )
+    {
+        archivePtr->useChunkedSampleKeys( m_numChunkedKeyThreads );
+    }
+
+    if ( m_instanceIdenticalObjects )
+    {
+        archivePtr->useInstanceIdenticalObjects();
+    }
+
+    if ( m_numAsyncThreads > 0 )
+    {
+        archivePtr->enableAsyncWrites( m_numAsyncThreads, m_maxAsyncBytes );
+    }
+
     return archivePtr;
 }
 
@@ -73,6 +182,7 @@ ReadArchive::ReadArchive()
 {
     m_numStreams = 1;
     m_useMMap = true;
+    m_useSampleTables = false;
 }
 
 //-*****************************************************************************
@@ -80,11 +190,22 @@ ReadArchive::ReadArchive( size_t iNumStreams, bool iUseMMap )
 {
     m_numStreams = iNumStreams;
     m_useMMap = iUseMMap;
+    m_useSampleTables = false;
+}
+
+//-*****************************************************************************
+ReadArchive::ReadArchive( size_t iNumStreams, bool iUseMMap,
+                          bool iUseSampleTables )
+{
+    m_numStreams = iNumStreams;
+    m_useMMap = iUseMMap;
+    m_useSampleTables = iUseSampleTables;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
-    : m_numStreams( 1 ), m_useMMap(true), m_streams( iStreams )
+    : m_numStreams( 1 ), m_useMMap(true), m_useSampleTables( false )
+    , m_streams( iStreams )
 {
 }
 
@@ -92,7 +213,7 @@ ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
 AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
+    Alembic::Util::shared_ptr<ArImpl> archivePtr;
 
     if ( m_streams.empty() )
     {
@@ -104,6 +225,7 @@ ReadArchive::operator()( const std::string &iFileName ) const
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
             new ArImpl( m_streams ) );
     }
+    archivePtr->m_useSampleTables = m_useSampleTables;
     return archivePtr;
 }
 
@@ -113,7 +235,7 @@ AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
+    Alembic::Util::shared_ptr<ArImpl> archivePtr;
 
     if ( m_streams.empty() )
     {
@@ -125,6 +247,7 @@ ReadArchive::operator()( const std::string &iFileName,
         archivePtr = Alembic::Util::shared_ptr<ArImpl> (
             new ArImpl( m_streams ) );
     }
+    archivePtr->m_useSampleTables = m_useSampleTables;
     return archivePtr;
 }
 
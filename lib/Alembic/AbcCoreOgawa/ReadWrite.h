@@ -51,6 +51,85 @@ class ALEMBIC_EXPORT WriteArchive
 public:
     WriteArchive();
 
+    // If iPack is true, all of the samples of each scalar property with a
+    // fixed size POD are stored together in one block instead of one block
+    // per sample.  This makes heavily animated scalars smaller and much
+    // faster to read in their entirety, but archives written this way can
+    // not be read by older versions of Alembic.
+    void setPackScalarSamples( bool iPack );
+
+    // If iInline is true, scalar samples that are only a few bytes big
+    // (visibility, inherits flags, xform ops etc.) are stored directly in the
+    // Ogawa group of their property, which saves both space and a read per
+    // sample.  These archives can also not be read by older versions of
+    // Alembic.  Properties that are packed are not inlined.
+    void setInlineSmallSamples( bool iInline );
+
+    // If iAlignment is not 0, all numeric sample data is padded within the
+    // file so that it starts on a multiple of iAlignment (i.e. 16 or 64)
+    // bytes, so it can be used directly from a memory mapped archive.
+    // iAlignment must be a power of 2 no bigger than 4096.  Readers get it
+    // back from AbcA::ArchiveReader::getDataAlignment.  Archives written this
+    // way can still be read by older versions of Alembic.
+    void setDataAlignment( Util::uint32_t iAlignment );
+
+    // Hash and write samples on other threads so that setting a sample
+    // only has to copy it.  iNumHashThreads threads compute the sample keys
+    // and a single thread writes them to the archive in the order they were
+    // set.  Once more than iMaxQueuedBytes of samples are waiting to be
+    // written, setting another sample blocks until there is room.  Errors
+    // that happen while writing are thrown from ArchiveWriter::flush, which
+    // should be called before the archive is let go of, since they can not
+    // be reported from the destructor.  0 threads (the default) writes
+    // everything directly.
+    void setAsyncWrites( std::size_t iNumHashThreads,
+                         Util::uint64_t iMaxQueuedBytes = 268435456 );
+
+    // Give samples AbcA::kChunkedSampleKey keys, which hash the chunks of
+    // large samples on up to iNumThreads threads instead of hashing the
+    // whole sample on one.  The key type is recorded in the archive
+    // metadata under "_ai_SampleKeyType" so readers only compare them with
+    // keys of the same type.  Archives written this way can still be read
+    // by older versions of Alembic, but keys read from them won't match
+    // keys computed by those versions.  1 computes chunked keys on the
+    // writing thread, and 0 (the default) goes back to plain
+    // AbcA::kMurmur3SampleKey keys.
+    void setChunkedSampleKeys( std::size_t iNumThreads );
+
+    // If iInstance is true, an object whose properties, children and
+    // MetaData are identical to those of an object that has already been
+    // written is written as an instance of it (see
+    // Abc::OObject::addChildInstance) once it is finalized or let go of.
+    // The groups and headers of the object as it was written are left
+    // behind in the file but nothing refers to them anymore, so readers
+    // only ever open one copy of the hierarchy.
+    void setInstanceIdenticalObjects( bool iInstance );
+
+    // If iAppend is true, archives given by file name are opened in place
+    // instead of being truncated.  The existing hierarchy can be added to:
+    // new objects and properties can be created anywhere in it, and
+    // existing objects and properties that are asked for by name (getChild,
+    // getProperty) pick up where they left off, so more samples can be set
+    // on them.  Samples that are already in the file are shared with new
+    // samples that match them.  Everything that is not reopened stays where
+    // it is, the headers and group tables of what is reopened are written
+    // again and the old ones are left behind in the file.  The archive
+    // MetaData given to operator() is added to the existing MetaData, and
+    // the archive keeps using the sample keys and packing of the file.
+    void setAppend( bool iAppend );
+
+    // If iKeyframeInterval is bigger than 1, samples of float32 and float64
+    // array properties (positions, velocities, normals...) that are the
+    // same size as the sample before them are stored as the bits which
+    // changed since that sample, whenever that is smaller.  Every
+    // iKeyframeInterval stored samples, and whenever the size changes, a
+    // whole sample (a keyframe) is stored instead, so reading any sample
+    // never has to undo more than iKeyframeInterval - 1 deltas.  Nothing is
+    // lost, samples read back bit for bit the same and keep their keys.
+    // These archives can not be read by older versions of Alembic.  0 (the
+    // default) turns it off.
+    void setFloatDeltaEncoding( Util::uint32_t iKeyframeInterval );
+
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( const std::string &iFileName,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
@@ -58,6 +137,17 @@ public:
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( std::ostream * iStream,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+private:
+    bool m_packScalarSamples;
+    bool m_inlineSmallSamples;
+    Util::uint32_t m_dataAlignment;
+    std::size_t m_numAsyncThreads;
+    Util::uint64_t m_maxAsyncBytes;
+    std::size_t m_numChunkedKeyThreads;
+    bool m_instanceIdenticalObjects;
+    bool m_append;
+    Util::uint32_t m_deltaKeyframeInterval;
 };
 
 //-*****************************************************************************
@@ -72,6 +162,11 @@ public:
     // is true, then use memory mapped file I/O, otherwise use file streams.
     ReadArchive( size_t iNumStreams, bool iUseMMap );
 
+    // As above, but if iUseSampleTables is true each property reader will
+    // look up where all of its samples live the first time it is read from,
+    // which makes later random access to those samples cheaper.
+    ReadArchive( size_t iNumStreams, bool iUseMMap, bool iUseSampleTables );
+
     // Read from the provided streams, we do not own these, expect them
     // to remain open and all have the same data in them, and do not try to
     // delete them
@@ -90,6 +185,7 @@ public:
 private:
     size_t m_numStreams;
     bool m_useMMap;
+    bool m_useSampleTables;
     std::vector< std::istream * > m_streams;
 };
 
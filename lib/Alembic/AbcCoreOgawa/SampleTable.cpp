@@ -0,0 +1,87 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/SampleTable.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+SampleTable::SampleTable()
+  : m_loaded( false )
+{
+}
+
+//-*****************************************************************************
+Ogawa::IDataPtr SampleTable::get( Ogawa::IGroupPtr iGroup, size_t iIndex,
+                                  std::size_t iThreadId )
+{
+#if !defined(ALEMBIC_LIB_USES_TR1) && __cplusplus >= 201103L
+    // the acquire pairs with the release below, so whoever sees m_loaded
+    // also sees all of m_data
+    if ( !m_loaded.load( std::memory_order_acquire ) )
+    {
+        Alembic::Util::scoped_lock l( m_mutex );
+        if ( !m_loaded.load( std::memory_order_relaxed ) )
+        {
+            iGroup->getAllData( m_data, iThreadId );
+            m_loaded.store( true, std::memory_order_release );
+        }
+    }
+#else
+    // no portable way to publish m_data without a lock
+    {
+        Alembic::Util::scoped_lock l( m_mutex );
+        if ( !m_loaded )
+        {
+            iGroup->getAllData( m_data, iThreadId );
+            m_loaded = true;
+        }
+    }
+#endif
+
+    if ( iIndex < m_data.size() )
+    {
+        return m_data[iIndex];
+    }
+
+    return Ogawa::IDataPtr();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
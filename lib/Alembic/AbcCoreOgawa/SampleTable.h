@@ -0,0 +1,82 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_SampleTable_h
+#define Alembic_AbcCoreOgawa_SampleTable_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+#if !defined(ALEMBIC_LIB_USES_TR1) && __cplusplus >= 201103L
+#include <atomic>
+#endif
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Every data child of a property group, looked up all at once the first time
+// one of them is asked for so later reads don't have to find out where the
+// sample lives or how big it is.  Once it is built it never changes, so it is
+// read without locking.
+class SampleTable : Alembic::Util::noncopyable
+{
+public:
+    SampleTable();
+
+    // the data child of iGroup at iIndex, NULL if there is no such child
+    Ogawa::IDataPtr get( Ogawa::IGroupPtr iGroup, size_t iIndex,
+                         std::size_t iThreadId );
+
+private:
+    // set once m_data is built, everything after that only reads it
+#if !defined(ALEMBIC_LIB_USES_TR1) && __cplusplus >= 201103L
+    std::atomic< bool > m_loaded;
+#else
+    bool m_loaded;
+#endif
+    std::vector< Ogawa::IDataPtr > m_data;
+    Alembic::Util::mutex m_mutex;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
@@ -39,6 +39,8 @@
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
 #include <Alembic/AbcCoreOgawa/OrImpl.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
@@ -50,6 +52,8 @@ SprImpl::SprImpl( AbcA::CompoundPropertyReaderPtr iParent,
   : m_parent( iParent )
   , m_group( iGroup )
   , m_header( iHeader )
+  , m_useSampleTable( false )
+  , m_packedLoaded( false )
 {
     // Validate all inputs.
     ABCA_ASSERT( m_parent, "Invalid parent" );
@@ -61,6 +65,44 @@ SprImpl::SprImpl( AbcA::CompoundPropertyReaderPtr iParent,
         ABCA_THROW( "Attempted to create a ScalarPropertyReader from a "
                     "non-array property type" );
     }
+
+    m_useSampleTable = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->useSampleTables();
+}
+
+//-*****************************************************************************
+Ogawa::IDataPtr SprImpl::getData( size_t iIndex, std::size_t iThreadId )
+{
+    if ( !m_useSampleTable )
+    {
+        return m_group->getData( iIndex, iThreadId );
+    }
+
+    return m_sampleTable.get( m_group, iIndex, iThreadId );
+}
+
+//-*****************************************************************************
+void SprImpl::readPacked( std::size_t iThreadId )
+{
+    m_packedLoaded = true;
+
+    Ogawa::IDataPtr data = m_group->getData( 0, iThreadId );
+    if ( data && data->getSize() > 0 )
+    {
+        m_packedData.resize( data->getSize() );
+        data->read( data->getSize(), &( m_packedData.front() ), 0, iThreadId );
+    }
+
+    Ogawa::IDataPtr changes = m_group->getData( 1, iThreadId );
+    if ( changes && changes->getSize() > 0 )
+    {
+        ABCA_ASSERT( changes->getSize() % 4 == 0,
+                     "Invalid packed scalar property change table." );
+
+        m_packedChanges.resize( changes->getSize() / 4 );
+        changes->read( changes->getSize(), &( m_packedChanges.front() ), 0,
+                       iThreadId );
+    }
 }
 
 //-*****************************************************************************
@@ -108,9 +150,44 @@ void SprImpl::getSample( index_t iSampleIndex, void * iIntoLocation )
         AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
 
     std::size_t id = streamId->getID();
-    Ogawa::IDataPtr data = m_group->getData( index, id );
     AbcA::DataType dt = m_header->header.getDataType();
 
+    if ( m_header->isPacked )
+    {
+        Alembic::Util::scoped_lock l( m_packedMutex );
+        if ( !m_packedLoaded )
+        {
+            readPacked( id );
+        }
+
+        // find which of the packed samples this stored index uses
+        size_t slot = index;
+        if ( !m_packedChanges.empty() )
+        {
+            slot = std::upper_bound( m_packedChanges.begin(),
+                m_packedChanges.end(), ( Util::uint32_t ) index ) -
+                m_packedChanges.begin() - 1;
+        }
+
+        size_t numBytes = dt.getNumBytes();
+        ABCA_ASSERT( ( slot + 1 ) * numBytes <= m_packedData.size(),
+                     "ScalarPropertyReader::getSample packed sample "
+                     << index << " out of range" );
+
+        memcpy( iIntoLocation, &( m_packedData[slot * numBytes] ), numBytes );
+        return;
+    }
+
+    Ogawa::IDataPtr data = getData( index, id );
+
+    // small samples may have been stored inline without the data key
+    if ( dt.getPod() < Util::kStringPOD && data &&
+         data->getSize() == dt.getNumBytes() )
+    {
+        data->read( data->getSize(), iIntoLocation, 0, id );
+        return;
+    }
+
     // Check to make sure the Ogawa data size matches our expected scalar
     // property size, the + 16 is to account for the data key.
     if ( dt.getPod() < Util::kStringPOD && data &&
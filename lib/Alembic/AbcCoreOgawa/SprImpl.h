@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_SprImpl_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/SampleTable.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -72,6 +73,14 @@ public:
 
 private:
 
+    // Returns the data child at iIndex, going through our sample table
+    // if the archive asked for one.
+    Ogawa::IDataPtr getData( size_t iIndex, std::size_t iThreadId );
+
+    // Reads all of the samples of a packed property into m_packedData,
+    // expects m_packedMutex to already be locked.
+    void readPacked( std::size_t iThreadId );
+
     // Parent compound property writer. It must exist.
     AbcA::CompoundPropertyReaderPtr m_parent;
 
@@ -81,6 +90,19 @@ private:
     // Stores the PropertyHeader and other info
     PropertyHeaderPtr m_header;
 
+    // When enabled, every data child of m_group is loaded the first time
+    // a sample is read, so later reads don't have to look up where the
+    // sample lives or how big it is.
+    bool m_useSampleTable;
+    SampleTable m_sampleTable;
+
+    // For packed properties all of the samples are read in at once, along
+    // with the stored index at which each of them starts being used.
+    bool m_packedLoaded;
+    Alembic::Util::mutex m_packedMutex;
+    std::vector< Util::uint8_t > m_packedData;
+    std::vector< Util::uint32_t > m_packedChanges;
+
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/SpwImpl.h>
+#include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
@@ -46,9 +47,12 @@ namespace ALEMBIC_VERSION_NS {
 SpwImpl::SpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                   Ogawa::OGroupPtr iGroup,
                   PropertyHeaderPtr iHeader,
-                  size_t iIndex ) :
+                  size_t iIndex,
+                  Ogawa::IGroupPtr iExisting ) :
     m_parent( iParent ), m_header( iHeader ), m_group( iGroup ),
-    m_index( iIndex )
+    m_index( iIndex ), m_inlineSamples( false ),
+    m_sampleKeyType( AbcA::kMurmur3SampleKey ), m_numKeyThreads( 1 ),
+    m_bytesWritten( 0 )
 {
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_header, "Invalid property header" );
@@ -59,12 +63,111 @@ SpwImpl::SpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
         ABCA_THROW( "Attempted to create a ScalarPropertyWriter from a "
                     "non-scalar property type" );
     }
+
+    Util::shared_ptr< AwImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< AwImpl, AbcA::ArchiveWriter >(
+            m_parent->getObject()->getArchive() );
+
+    // strings don't have a fixed size so they are never packed
+    Util::PlainOldDataType pod = m_header->header.getDataType().getPod();
+    if ( pod != Alembic::Util::kStringPOD &&
+         pod != Alembic::Util::kWstringPOD )
+    {
+        // reopened properties keep storing their samples the way they were
+        if ( !iExisting )
+        {
+            m_header->isPacked = archive && archive->packScalarSamples();
+        }
+
+        m_inlineSamples = archive && !m_header->isPacked &&
+            archive->inlineSmallSamples() &&
+            m_header->header.getDataType().getNumBytes() <=
+            Ogawa::INLINE_DATA_MAX_SIZE;
+    }
+
+    if ( archive )
+    {
+        m_asyncWriter = archive->getAsyncWriter();
+        m_sampleKeyType = archive->sampleKeyType();
+        m_numKeyThreads = archive->numKeyThreads();
+        m_profiler = archive->getWriteProfiler();
+    }
+
+    if ( iExisting )
+    {
+        reopen( iExisting );
+    }
+}
+
+//-*****************************************************************************
+void SpwImpl::reopen( Ogawa::IGroupPtr iExisting )
+{
+    // the written sample map may only be touched by one thread
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->drain();
+    }
+
+    std::vector< AbcA::ArraySample::Key > keys;
+    std::vector< AbcA::Dimensions > dims;
+    ReadSampleKeys( iExisting, *m_header, m_sampleKeyType, keys, dims );
+
+    if ( keys.empty() )
+    {
+        return;
+    }
+
+    if ( m_header->isPacked )
+    {
+        // the packed samples are written out again, with the new ones
+        // added on the end
+        ReadPackedSamples( iExisting, *m_header, m_packedData,
+                           m_packedChanges );
+        m_previousWrittenSampleID.reset(
+            new WrittenSampleID( keys.back(), Ogawa::ODataPtr(), 1 ) );
+    }
+    else
+    {
+        WrittenSampleMap & sampleMap =
+            GetWrittenSampleMap( m_parent->getObject()->getArchive() );
+
+        std::size_t numChildren = iExisting->getNumChildren();
+        for ( std::size_t i = 0; i < numChildren; ++i )
+        {
+            Ogawa::IDataPtr existing = iExisting->getData( i, 0 );
+            Ogawa::ODataPtr data = m_group->addExistingData( existing );
+            if ( i >= keys.size() )
+            {
+                continue;
+            }
+
+            WrittenSampleIDPtr writeID(
+                new WrittenSampleID( keys[i], data, 1 ) );
+
+            // inline samples can't be shared, they have no key
+            if ( existing->getSize() >= 16 && !sampleMap.find( keys[i] ) )
+            {
+                sampleMap.store( writeID );
+            }
+
+            m_previousWrittenSampleID = writeID;
+        }
+    }
+
+    dims.clear();
+    m_hash = HashSampleKeys( *m_header, keys, dims );
 }
 
 
 //-*****************************************************************************
 SpwImpl::~SpwImpl()
 {
+    // everything we queued has to be written before we can finish up
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->drain();
+    }
+
     AbcA::ArchiveWriterPtr archive = m_parent->getObject()->getArchive();
 
     index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
@@ -78,6 +181,28 @@ SpwImpl::~SpwImpl()
         numSamples = 1;
     }
 
+    bool profiling = m_profiler && m_profiler->isEnabled();
+    Util::uint64_t bytesBefore = profiling ? m_profiler->getBytesWritten() : 0;
+
+    if ( m_header->isPacked && !m_packedData.empty() )
+    {
+        m_group->addData( m_packedData.size(), &( m_packedData.front() ) );
+
+        Util::uint32_t numStored = 1;
+        if ( m_header->lastChangedIndex != 0 )
+        {
+            numStored = m_header->lastChangedIndex -
+                m_header->firstChangedIndex + 2;
+        }
+
+        // no need for the change table if every stored sample is different
+        if ( m_packedChanges.size() != numStored )
+        {
+            m_group->addData( m_packedChanges.size() * 4,
+                              &( m_packedChanges.front() ) );
+        }
+    }
+
     if ( maxSamples < numSamples )
     {
         archive->setMaxNumSamplesForTimeSamplingIndex(
@@ -94,6 +219,14 @@ SpwImpl::~SpwImpl()
         hash.Update( m_hash.d, 16 );
     }
 
+    if ( profiling )
+    {
+        m_bytesWritten += m_profiler->getBytesWritten() - bytesBefore;
+        m_profiler->addPropertyBytes(
+            GetProfilePath( m_parent, m_header->header.getName() ),
+            m_bytesWritten );
+    }
+
     Util::uint64_t hash0, hash1;
     hash.Final( &hash0, &hash1 );
     Util::shared_ptr< CpwImpl > parent =
@@ -118,10 +251,28 @@ void SpwImpl::setFromPreviousSample()
     ABCA_ASSERT( m_header->nextSampleIndex > 0,
         "Can't set from previous sample before any samples have been written" );
 
+    if ( m_asyncWriter )
+    {
+        m_asyncWriter->queuePreviousSample( this );
+    }
+    else
+    {
+        writePreviousSample();
+    }
+
+    m_header->nextSampleIndex ++;
+}
+
+//-*****************************************************************************
+void SpwImpl::writePreviousSample()
+{
+    // only possible if writing the first sample failed on another thread
+    ABCA_ASSERT( m_previousWrittenSampleID,
+        "Can't set from previous sample, no sample has been written" );
+
     Util::Digest digest = m_previousWrittenSampleID->getKey().digest;
     Util::SpookyHash::ShortEnd(m_hash.words[0], m_hash.words[1],
                                digest.words[0], digest.words[1]);
-    m_header->nextSampleIndex ++;
 }
 
 //-*****************************************************************************
@@ -139,8 +290,42 @@ void SpwImpl::setSample( const void *iSamp )
     AbcA::ArraySample samp( iSamp, m_header->header.getDataType(),
                             AbcA::Dimensions(1) );
 
-     // The Key helps us analyze the sample.
-     AbcA::ArraySample::Key key = samp.getKey();
+    if ( m_asyncWriter )
+    {
+        // hashed and written later, in order, on other threads
+        m_asyncWriter->queueSample( this, samp, m_header->nextSampleIndex );
+    }
+    else
+    {
+        // The Key helps us analyze the sample.
+        // strings and wstrings are packed while hashing so that WriteData
+        // doesn't have to pack them again
+        std::vector< Util::uint8_t > packed;
+        bool profiling = m_profiler && m_profiler->isEnabled();
+        ProfileTimer timer( profiling );
+        AbcA::ArraySample::Key key = samp.getKey( packed, m_sampleKeyType,
+                                                  m_numKeyThreads );
+        if ( profiling )
+        {
+            m_profiler->addHash( timer.elapsed(), samp, packed );
+        }
+        writeSample( samp, key, packed, m_header->nextSampleIndex );
+    }
+
+    m_header->nextSampleIndex ++;
+}
+
+//-*****************************************************************************
+void SpwImpl::writeSample( const AbcA::ArraySample & iSamp,
+                           const AbcA::ArraySample::Key & iKey,
+                           const std::vector< Util::uint8_t > & iPacked,
+                           index_t iIndex )
+{
+    // whatever makes it to the stream from here on is ours
+    bool profiling = m_profiler && m_profiler->isEnabled();
+    Util::uint64_t bytesBefore = profiling ? m_profiler->getBytesWritten() : 0;
+
+    AbcA::ArraySample::Key key = iKey;
 
      // mask out the non-string POD since Ogawa can safely share the same data
      // even if it originated from a different POD
@@ -154,41 +339,85 @@ void SpwImpl::setSample( const void *iSamp )
     }
 
     // We need to write the sample
-    if ( m_header->nextSampleIndex == 0  ||
+    if ( iIndex == 0  ||
         !( m_previousWrittenSampleID &&
             key == m_previousWrittenSampleID->getKey() ) )
     {
 
-        // we only need to repeat samples if this is not the first change
-        if (m_header->firstChangedIndex != 0)
+        if ( m_header->isPacked )
         {
-            // copy the samples from after the last change to the latest index
-            for ( index_t smpI = m_header->lastChangedIndex + 1;
-                smpI < m_header->nextSampleIndex; ++smpI )
+            // repeated samples don't take up any room, the change table
+            // records which stored index this sample starts at
+            Util::uint32_t storedIndex = 0;
+            if ( m_header->firstChangedIndex != 0 )
             {
-                assert( smpI > 0 );
-                CopyWrittenData( m_group, m_previousWrittenSampleID );
+                storedIndex = iIndex - m_header->firstChangedIndex + 1;
+            }
+            else if ( iIndex != 0 )
+            {
+                storedIndex = 1;
             }
-        }
 
-        // Write this sample, which will update its internal
-        // cache of what the previously written sample was.
-        AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
+            m_packedChanges.push_back( storedIndex );
 
-        // Write the sample.
-        // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, samp, key );
+            const Util::uint8_t * bytes =
+                ( const Util::uint8_t * ) iSamp.getData();
+            m_packedData.insert( m_packedData.end(), bytes,
+                bytes + m_header->header.getDataType().getNumBytes() );
+
+            m_previousWrittenSampleID.reset(
+                new WrittenSampleID( key, Ogawa::ODataPtr(), 1 ) );
+        }
+        else
+        {
+            // we only need to repeat samples if this is not the first change
+            if (m_header->firstChangedIndex != 0)
+            {
+                // copy the samples from after the last change to the latest
+                // index
+                for ( index_t smpI = m_header->lastChangedIndex + 1;
+                    smpI < iIndex; ++smpI )
+                {
+                    assert( smpI > 0 );
+                    CopyWrittenData( m_group, m_previousWrittenSampleID );
+                }
+            }
+
+            if ( m_inlineSamples )
+            {
+                // small enough to skip the key and live in the group itself,
+                // these are kept out of the written sample map since
+                // referencing them elsewhere wouldn't save anything
+                Ogawa::ODataPtr data = m_group->addInlineData(
+                    m_header->header.getDataType().getNumBytes(),
+                    iSamp.getData() );
+                m_previousWrittenSampleID.reset(
+                    new WrittenSampleID( key, data, 1 ) );
+            }
+            else
+            {
+                // Write this sample, which will update its internal
+                // cache of what the previously written sample was.
+                AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
+
+                // Write the sample.
+                // This distinguishes between string, wstring, and regular
+                // arrays.
+                m_previousWrittenSampleID =
+                    WriteData( GetWrittenSampleMap( awp ), m_group, iSamp,
+                               key, iPacked );
+            }
+        }
 
         if (m_header->firstChangedIndex == 0)
         {
-            m_header->firstChangedIndex = m_header->nextSampleIndex;
+            m_header->firstChangedIndex = iIndex;
         }
         // this index is now the last change
-        m_header->lastChangedIndex = m_header->nextSampleIndex;
+        m_header->lastChangedIndex = iIndex;
     }
 
-    if ( m_header->nextSampleIndex == 0 )
+    if ( iIndex == 0 )
     {
         m_hash = m_previousWrittenSampleID->getKey().digest;
     }
@@ -199,7 +428,10 @@ void SpwImpl::setSample( const void *iSamp )
                                     digest.words[0], digest.words[1] );
     }
 
-    m_header->nextSampleIndex ++;
+    if ( profiling )
+    {
+        m_bytesWritten += m_profiler->getBytesWritten() - bytesBefore;
+    }
 }
 
 //-*****************************************************************************
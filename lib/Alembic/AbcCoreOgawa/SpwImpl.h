@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_SpwImpl_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/AsyncWriter.h>
 #include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
 
 namespace Alembic {
@@ -48,6 +49,7 @@ namespace ALEMBIC_VERSION_NS {
 // Scalar Property Writer.
 class SpwImpl
     : public AbcA::ScalarPropertyWriter
+    , public AsyncPropertyWriter
     , public Alembic::Util::enable_shared_from_this<SpwImpl>
 {
 protected:
@@ -57,10 +59,14 @@ protected:
     SpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
              Ogawa::OGroupPtr iGroup,
              PropertyHeaderPtr iHeader,
-             size_t iIndex );
+             size_t iIndex,
+             Ogawa::IGroupPtr iExisting = Ogawa::IGroupPtr() );
 
     AbcA::ScalarPropertyWriterPtr asScalarPtr();
 
+    // picks up where the existing property iExisting left off
+    void reopen( Ogawa::IGroupPtr iExisting );
+
 public:
     virtual ~SpwImpl();
 
@@ -76,6 +82,15 @@ public:
     virtual AbcA::CompoundPropertyWriterPtr getParent();
 
 protected:
+    // AsyncPropertyWriter overrides, these do the actual writing either
+    // directly from setSample and setFromPreviousSample or later on from
+    // the archive's AsyncWriter
+    virtual void writeSample( const AbcA::ArraySample & iSamp,
+                              const AbcA::ArraySample::Key & iKey,
+                              const std::vector< Util::uint8_t > & iPacked,
+                              index_t iIndex );
+    virtual void writePreviousSample();
+
     // Previous written array sample identifier!
     WrittenSampleIDPtr m_previousWrittenSampleID;
 
@@ -93,6 +108,28 @@ private:
     Ogawa::OGroupPtr m_group;
 
     size_t m_index;
+
+    // whether our samples are small enough to be stored inline in m_group
+    bool m_inlineSamples;
+
+    // If our header says we are packed, every new sample is appended here
+    // and everything is written as one block when we are destroyed.
+    std::vector< Util::uint8_t > m_packedData;
+
+    // The stored index at which each of the samples in m_packedData starts
+    // being used.
+    std::vector< Util::uint32_t > m_packedChanges;
+
+    // how the archive wants sample keys computed
+    AbcA::ArraySampleKeyType m_sampleKeyType;
+    std::size_t m_numKeyThreads;
+
+    // set if the archive hashes and writes samples on other threads
+    AsyncWriterPtr m_asyncWriter;
+
+    // the archive's profiler, and what we wrote while it was enabled
+    WriteProfilerPtr m_profiler;
+    Util::uint64_t m_bytesWritten;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -42,6 +42,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <vector>
 
@@ -412,6 +413,274 @@ void testIssue253(bool iUseMMap)
     TESTING_ASSERT_THROW(r( "issue253.abc" ),  Alembic::Util::Exception);
 }
 
+//-*****************************************************************************
+void writeSamplesArchive( const std::string & iName,
+                          const AO::WriteArchive & iWriter )
+{
+    ABCA::DataType ftype( Alembic::Util::kFloat32POD, 3 );
+    ABCA::DataType stype( Alembic::Util::kStringPOD );
+    ABCA::DataType itype( Alembic::Util::kInt32POD );
+
+    ABCA::ArchiveWriterPtr a = iWriter( iName, ABCA::MetaData() );
+    ABCA::ObjectWriterPtr obj = a->getTop()->createChild(
+        ABCA::ObjectHeader( "obj", ABCA::MetaData() ) );
+    ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+
+    ABCA::ArrayPropertyWriterPtr pos = props->createArrayProperty(
+        "P", ABCA::MetaData(), ftype, 0 );
+    ABCA::ArrayPropertyWriterPtr names = props->createArrayProperty(
+        "names", ABCA::MetaData(), stype, 0 );
+    ABCA::ScalarPropertyWriterPtr frame = props->createScalarProperty(
+        "frame", ABCA::MetaData(), itype, 0 );
+
+    for ( int32_t i = 0; i < 20; ++i )
+    {
+        // hold some samples so they repeat
+        std::vector< float32_t > vals( ( i % 5 + 1 ) * 30,
+                                       ( float32_t )( i / 2 ) );
+        pos->setSample( ABCA::ArraySample( &vals.front(), ftype,
+                                           Dimensions( vals.size() / 3 ) ) );
+
+        if ( i % 4 == 3 )
+        {
+            names->setFromPreviousSample();
+        }
+        else
+        {
+            std::vector< std::string > strs( i % 3 + 1, "name" );
+            strs.back() += ( char )( 'a' + i );
+            names->setSample( ABCA::ArraySample( &strs.front(), stype,
+                Dimensions( strs.size() ) ) );
+        }
+
+        int32_t f = i / 3;
+        frame->setSample( &f );
+
+        // objects that come and go while samples are being written
+        if ( i == 10 )
+        {
+            ABCA::ObjectWriterPtr child = obj->createChild(
+                ABCA::ObjectHeader( "child", ABCA::MetaData() ) );
+            ABCA::ArrayPropertyWriterPtr ids =
+                child->getProperties()->createArrayProperty(
+                    "ids", ABCA::MetaData(), itype, 0 );
+            ids->setSample( ABCA::ArraySample( &f, itype, Dimensions( 1 ) ) );
+        }
+    }
+
+    TESTING_ASSERT( pos->getNumSamples() == 20 );
+    a->flush();
+}
+
+//-*****************************************************************************
+void testAsyncWrites()
+{
+    AO::WriteArchive syncWriter;
+    writeSamplesArchive( "syncSamples.abc", syncWriter );
+
+    // small enough that setting samples has to wait on the writer
+    AO::WriteArchive asyncWriter;
+    asyncWriter.setAsyncWrites( 3, 2048 );
+    writeSamplesArchive( "asyncSamples.abc", asyncWriter );
+
+    // the samples are written in the same order so the files should match
+    std::ifstream syncFile( "syncSamples.abc", std::ios_base::binary );
+    std::ifstream asyncFile( "asyncSamples.abc", std::ios_base::binary );
+    std::string syncBytes( ( std::istreambuf_iterator< char >( syncFile ) ),
+                           std::istreambuf_iterator< char >() );
+    std::string asyncBytes( ( std::istreambuf_iterator< char >( asyncFile ) ),
+                            std::istreambuf_iterator< char >() );
+    TESTING_ASSERT( !syncBytes.empty() );
+    TESTING_ASSERT( syncBytes == asyncBytes );
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r( "asyncSamples.abc" );
+    ABCA::ArrayPropertyReaderPtr pos =
+        a->getTop()->getChild( 0 )->getProperties()->getArrayProperty( "P" );
+    TESTING_ASSERT( pos->getNumSamples() == 20 );
+    ABCA::ArraySamplePtr samp;
+    pos->getSample( 19, samp );
+    TESTING_ASSERT( samp->getDimensions().numPoints() == 50 );
+    TESTING_ASSERT( ( ( const float32_t * ) samp->getData() )[0] == 9.0f );
+
+    // errors show up when flushing, not when setting
+    {
+        AO::WriteArchive w;
+        w.setAsyncWrites( 1 );
+        ABCA::ArchiveWriterPtr aw = w( "asyncError.abc", ABCA::MetaData() );
+        ABCA::DataType stype( Alembic::Util::kStringPOD );
+        ABCA::ArrayPropertyWriterPtr names =
+            aw->getTop()->getProperties()->createArrayProperty(
+                "names", ABCA::MetaData(), stype, 0 );
+
+        std::string bad( "bad" );
+        bad[1] = 0;
+        names->setSample( ABCA::ArraySample( &bad, stype, Dimensions( 1 ) ) );
+        TESTING_ASSERT_THROW( aw->flush(), Alembic::Util::Exception );
+
+        // and are only reported once
+        aw->flush();
+    }
+}
+
+//-*****************************************************************************
+void writeAppendSamples( ABCA::ArrayPropertyWriterPtr iPos,
+                         ABCA::ScalarPropertyWriterPtr iFrame,
+                         int32_t iStart, int32_t iEnd )
+{
+    ABCA::DataType ftype( Alembic::Util::kFloat32POD );
+    for ( int32_t i = iStart; i < iEnd; ++i )
+    {
+        // later samples repeat earlier ones
+        std::vector< float32_t > vals( ( i % 3 + 1 ) * 30,
+                                       ( float32_t )( i % 6 ) );
+        iPos->setSample( ABCA::ArraySample( &vals.front(), ftype,
+                                            Dimensions( vals.size() ) ) );
+        int32_t f = i / 4;
+        iFrame->setSample( &f );
+    }
+}
+
+//-*****************************************************************************
+void writeAppendObjects( ABCA::ArchiveWriterPtr iArchive,
+                         ABCA::ArrayPropertyWriterPtr & oPos,
+                         ABCA::ScalarPropertyWriterPtr & oFrame )
+{
+    ABCA::DataType ftype( Alembic::Util::kFloat32POD );
+    ABCA::DataType itype( Alembic::Util::kInt32POD );
+
+    ABCA::ObjectWriterPtr obj = iArchive->getTop()->createChild(
+        ABCA::ObjectHeader( "obj", ABCA::MetaData() ) );
+    ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+    oPos = props->createArrayProperty( "P", ABCA::MetaData(), ftype, 0 );
+    oFrame = props->createScalarProperty( "frame", ABCA::MetaData(), itype,
+                                          0 );
+
+    ABCA::MetaData md;
+    md.set( "other", "1" );
+    ABCA::ObjectWriterPtr other = iArchive->getTop()->createChild(
+        ABCA::ObjectHeader( "other", md ) );
+    int32_t id = 7;
+    other->getProperties()->createArrayProperty(
+        "ids", md, itype, 0 )->setSample(
+            ABCA::ArraySample( &id, itype, Dimensions( 1 ) ) );
+}
+
+//-*****************************************************************************
+void testAppend( const AO::WriteArchive & iWriter )
+{
+    ABCA::DataType itype( Alembic::Util::kInt32POD );
+
+    // everything written in one go
+    {
+        ABCA::ArchiveWriterPtr a = iWriter( "appendFull.abc",
+                                            ABCA::MetaData() );
+        ABCA::ArrayPropertyWriterPtr pos;
+        ABCA::ScalarPropertyWriterPtr frame;
+        writeAppendObjects( a, pos, frame );
+        writeAppendSamples( pos, frame, 0, 20 );
+        a->getTop()->createChild(
+            ABCA::ObjectHeader( "added", ABCA::MetaData() ) );
+    }
+
+    // the first half of the samples
+    {
+        ABCA::ArchiveWriterPtr a = iWriter( "appended.abc",
+                                            ABCA::MetaData() );
+        ABCA::ArrayPropertyWriterPtr pos;
+        ABCA::ScalarPropertyWriterPtr frame;
+        writeAppendObjects( a, pos, frame );
+        writeAppendSamples( pos, frame, 0, 10 );
+    }
+
+    // and the rest
+    {
+        AO::WriteArchive w( iWriter );
+        w.setAppend( true );
+        ABCA::ArchiveWriterPtr a = w( "appended.abc", ABCA::MetaData() );
+        ABCA::ObjectWriterPtr top = a->getTop();
+        TESTING_ASSERT( top->getNumChildren() == 2 );
+        TESTING_ASSERT_THROW( top->createChild(
+            ABCA::ObjectHeader( "obj", ABCA::MetaData() ) ),
+            Alembic::Util::Exception );
+
+        ABCA::ObjectWriterPtr obj = top->getChild( "obj" );
+        TESTING_ASSERT( obj );
+        ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+        TESTING_ASSERT( props->getNumProperties() == 2 );
+        TESTING_ASSERT_THROW( props->createScalarProperty( "frame",
+            ABCA::MetaData(), itype, 0 ), Alembic::Util::Exception );
+
+        // the existing properties are reopened by asking for them
+        ABCA::ArrayPropertyWriterPtr pos =
+            Alembic::Util::dynamic_pointer_cast< ABCA::ArrayPropertyWriter >(
+                props->getProperty( "P" ) );
+        ABCA::ScalarPropertyWriterPtr frame =
+            Alembic::Util::dynamic_pointer_cast< ABCA::ScalarPropertyWriter >(
+                props->getProperty( "frame" ) );
+        TESTING_ASSERT( pos && frame );
+        TESTING_ASSERT( pos->getNumSamples() == 10 );
+
+        writeAppendSamples( pos, frame, 10, 20 );
+        top->createChild( ABCA::ObjectHeader( "added", ABCA::MetaData() ) );
+    }
+
+    // only files can be appended to
+    {
+        AO::WriteArchive w;
+        w.setAppend( true );
+        std::stringstream strStream;
+        TESTING_ASSERT_THROW( w( &strStream, ABCA::MetaData() ),
+                              Alembic::Util::Exception );
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr full = r( "appendFull.abc" );
+    ABCA::ArchiveReaderPtr appended = r( "appended.abc" );
+
+    ABCA::ObjectReaderPtr top = appended->getTop();
+    TESTING_ASSERT( top->getNumChildren() == 3 );
+    TESTING_ASSERT( top->getChild( 2 )->getName() == "added" );
+    TESTING_ASSERT( top->getChild( "other" )->getMetaData().get( "other" ) ==
+                    "1" );
+
+    ABCA::ObjectReaderPtr obj = top->getChild( "obj" );
+    ABCA::ArrayPropertyReaderPtr pos =
+        obj->getProperties()->getArrayProperty( "P" );
+    ABCA::ScalarPropertyReaderPtr frame =
+        obj->getProperties()->getScalarProperty( "frame" );
+    TESTING_ASSERT( pos->getNumSamples() == 20 );
+    TESTING_ASSERT( frame->getNumSamples() == 20 );
+    for ( int32_t i = 0; i < 20; ++i )
+    {
+        ABCA::ArraySamplePtr samp;
+        pos->getSample( i, samp );
+        TESTING_ASSERT( samp->size() == ( size_t )( i % 3 + 1 ) * 30 );
+        TESTING_ASSERT( ( ( const float32_t * ) samp->getData() )[0] ==
+                        ( float32_t )( i % 6 ) );
+
+        int32_t f = -1;
+        frame->getSample( i, &f );
+        TESTING_ASSERT( f == i / 4 );
+    }
+
+    // the samples that were added share the existing data
+    ABCA::ArraySampleKey key0, key12;
+    TESTING_ASSERT( pos->getKey( 0, key0 ) && pos->getKey( 12, key12 ) );
+    TESTING_ASSERT( key0 == key12 );
+
+    // and it all hashes the same as when written in one go
+    Alembic::Util::Digest fullDigest, appendedDigest;
+    TESTING_ASSERT( full->getTop()->getChildrenHash( fullDigest ) );
+    TESTING_ASSERT( top->getChildrenHash( appendedDigest ) );
+    TESTING_ASSERT( fullDigest == appendedDigest );
+
+    ABCA::ObjectReaderPtr fullObj = full->getTop()->getChild( "obj" );
+    TESTING_ASSERT( fullObj->getPropertiesHash( fullDigest ) );
+    TESTING_ASSERT( obj->getPropertiesHash( appendedDigest ) );
+    TESTING_ASSERT( fullDigest == appendedDigest );
+}
+
 void runTests(bool iUseMMap)
 {
     testReadWriteEmptyArchive(iUseMMap);
@@ -442,5 +711,21 @@ int main ( int argc, char *argv[] )
     readVeryEmptyArchive("testEmpty.abc", true);
     readVeryEmptyArchive("testEmpty.abc", false);
 
+    testAsyncWrites();
+
+    testAppend( AO::WriteArchive() );
+
+    AO::WriteArchive packedWriter;
+    packedWriter.setPackScalarSamples( true );
+    testAppend( packedWriter );
+
+    AO::WriteArchive inlineWriter;
+    inlineWriter.setInlineSmallSamples( true );
+    testAppend( inlineWriter );
+
+    AO::WriteArchive deltaWriter;
+    deltaWriter.setFloatDeltaEncoding( 4 );
+    testAppend( deltaWriter );
+
     return 0;
 }
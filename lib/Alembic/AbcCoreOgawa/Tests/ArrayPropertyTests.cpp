@@ -36,10 +36,14 @@
 
 #include <Alembic/AbcCoreAbstract/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Ogawa/All.h>
 #include <Alembic/Util/All.h>
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <iostream>
 #include <vector>
 
@@ -2017,6 +2021,778 @@ void testBigData(bool iUseMMap)
     }
 }
 
+void testSampleTables(bool iUseMMap)
+{
+    std::string archiveName = "sampleTableArray.abc";
+
+    ABCA::DataType dtype(Alembic::Util::kInt32POD);
+    std::size_t numSamples = 20;
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr archive = a->getTop();
+        ABCA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("a", ABCA::MetaData(), dtype, 0);
+        ABCA::ScalarPropertyWriterPtr swp =
+            parent->createScalarProperty("s", ABCA::MetaData(), dtype, 0);
+
+        // repeat a few samples at the start and end so that the stored
+        // indices don't line up with the sample indices
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            std::size_t idx = std::min(std::max(i, (std::size_t) 2),
+                                       (std::size_t) 16);
+            Alembic::Util::int32_t val = (Alembic::Util::int32_t) idx;
+
+            std::vector< Alembic::Util::int32_t > vals(idx + 1, val);
+            awp->setSample(ABCA::ArraySample(&(vals.front()), dtype,
+                Alembic::Util::Dimensions(vals.size())));
+            swp->setSample(&val);
+        }
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap, true);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyReaderPtr ap = parent->getArrayProperty("a");
+        ABCA::ScalarPropertyReaderPtr sp = parent->getScalarProperty("s");
+        TESTING_ASSERT(ap->getNumSamples() == numSamples);
+        TESTING_ASSERT(sp->getNumSamples() == numSamples);
+
+        // read out of order to exercise random access
+        for (std::size_t j = 0; j < numSamples; ++j)
+        {
+            std::size_t i = (j * 7) % numSamples;
+            std::size_t idx = std::min(std::max(i, (std::size_t) 2),
+                                       (std::size_t) 16);
+            Alembic::Util::int32_t val = (Alembic::Util::int32_t) idx;
+            std::size_t numPoints = idx + 1;
+
+            Dimensions dims;
+            ap->getDimensions(i, dims);
+            TESTING_ASSERT(dims.numPoints() == numPoints);
+
+            ABCA::ArraySampleKey key;
+            TESTING_ASSERT(ap->getKey(i, key));
+            TESTING_ASSERT(key.numBytes == numPoints * 4);
+
+            ABCA::ArraySamplePtr samp;
+            ap->getSample(i, samp);
+            TESTING_ASSERT(samp->getDimensions().numPoints() == numPoints);
+            const Alembic::Util::int32_t * data =
+                (const Alembic::Util::int32_t *)(samp->getData());
+            for (std::size_t k = 0; k < numPoints; ++k)
+            {
+                TESTING_ASSERT(data[k] == val);
+            }
+
+            std::vector< Alembic::Util::int32_t > asVals(numPoints);
+            ap->getAs(i, &(asVals.front()), Alembic::Util::kInt32POD);
+            TESTING_ASSERT(asVals[numPoints - 1] == val);
+
+            Alembic::Util::int32_t sval = -1;
+            sp->getSample(i, &sval);
+            TESTING_ASSERT(sval == val);
+        }
+    }
+}
+
+//-*****************************************************************************
+void testAlignedData(bool iUseMMap)
+{
+    std::string archiveName = "alignedArray.abc";
+
+    ABCA::DataType dtype(Alembic::Util::kFloat32POD);
+
+    {
+        // only powers of 2 up to a page make sense
+        AO::WriteArchive w;
+        TESTING_ASSERT_THROW(w.setDataAlignment(48), Alembic::Util::Exception);
+        TESTING_ASSERT_THROW(w.setDataAlignment(8192),
+                             Alembic::Util::Exception);
+    }
+
+    {
+        AO::WriteArchive w;
+        w.setDataAlignment( 64 );
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr archive = a->getTop();
+        ABCA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("a", ABCA::MetaData(), dtype, 0);
+
+        // different sizes so that the file position keeps moving around
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            std::vector< Alembic::Util::float32_t > vals(i * 13 + 1,
+                (Alembic::Util::float32_t) i);
+            awp->setSample(ABCA::ArraySample(&(vals.front()), dtype,
+                Alembic::Util::Dimensions(vals.size())));
+        }
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        TESTING_ASSERT(a->getDataAlignment() == 64);
+
+        ABCA::ArrayPropertyReaderPtr ap =
+            a->getTop()->getProperties()->getArrayProperty("a");
+        TESTING_ASSERT(ap->getNumSamples() == 10);
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            ABCA::ArraySamplePtr samp;
+            ap->getSample(i, samp);
+            TESTING_ASSERT(samp->getDimensions().numPoints() == i * 13 + 1);
+            const Alembic::Util::float32_t * data =
+                (const Alembic::Util::float32_t *)(samp->getData());
+            TESTING_ASSERT(data[i * 13] == (Alembic::Util::float32_t) i);
+        }
+    }
+
+    {
+        // go through Ogawa directly to check where the data landed, the top
+        // object's properties are its first child, and our property is the
+        // first child of that
+        Alembic::Ogawa::IArchive ia(archiveName, 1, iUseMMap);
+        Alembic::Ogawa::IGroupPtr prop = ia.getGroup()->getGroup(2, false, 0)->
+            getGroup(0, false, 0)->getGroup(0, false, 0);
+        TESTING_ASSERT(prop->getNumChildren() == 20);
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            Alembic::Ogawa::IDataPtr data = prop->getData(i * 2, 0);
+
+            // 8 bytes for the size, 16 for the key, even the smallest
+            // samples are aligned
+            TESTING_ASSERT((data->getPos() + 8 + 16) % 64 == 0);
+
+            // and since the mapping starts on a page, so is the memory
+            const char * mapped =
+                static_cast<const char *>(data->getMappedData());
+            if (iUseMMap)
+            {
+                TESTING_ASSERT(mapped != NULL);
+                TESTING_ASSERT(((std::size_t)(mapped + 16)) % 64 == 0);
+                TESTING_ASSERT(*((const Alembic::Util::float32_t *)
+                    (mapped + 16)) == (Alembic::Util::float32_t) i);
+            }
+            else
+            {
+                TESTING_ASSERT(mapped == NULL);
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void testPackedStrings(bool iUseMMap)
+{
+    std::string archiveName = "packedStrings.abc";
+
+    std::vector< std::string > strs(5);
+    strs[1] = "foo";
+    strs[3] = "a somewhat longer string";
+
+    std::vector< Alembic::Util::wstring > wstrs(5);
+    wstrs[0] = L"\u2697 potion";
+    wstrs[4] = L"bar";
+
+    ABCA::DataType sdtype(Alembic::Util::kStringPOD);
+    ABCA::DataType wdtype(Alembic::Util::kWstringPOD);
+
+    ABCA::ArraySample ssamp(&(strs.front()), sdtype,
+                            Alembic::Util::Dimensions(strs.size()));
+    ABCA::ArraySample wsamp(&(wstrs.front()), wdtype,
+                            Alembic::Util::Dimensions(wstrs.size()));
+
+    // the packed data should hash the same as always
+    std::vector< Alembic::Util::uint8_t > packed;
+    TESTING_ASSERT(ssamp.getKey(packed) == ssamp.getKey());
+    TESTING_ASSERT(packed.size() == 5 + 3 + 24);
+    TESTING_ASSERT(packed[0] == 0 && packed[4] == 0);
+    TESTING_ASSERT(wsamp.getKey(packed) == wsamp.getKey());
+    TESTING_ASSERT(packed.size() == (5 + 8 + 3) * 4);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr archive = a->getTop();
+        ABCA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr swp =
+            parent->createArrayProperty("s", ABCA::MetaData(), sdtype, 0);
+        swp->setSample(ssamp);
+
+        ABCA::ArrayPropertyWriterPtr wwp =
+            parent->createArrayProperty("w", ABCA::MetaData(), wdtype, 0);
+        wwp->setSample(wsamp);
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArraySamplePtr samp;
+        parent->getArrayProperty("s")->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == strs.size());
+        const std::string * sdata = (const std::string *)(samp->getData());
+        for (std::size_t i = 0; i < strs.size(); ++i)
+        {
+            TESTING_ASSERT(sdata[i] == strs[i]);
+        }
+
+        parent->getArrayProperty("w")->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == wstrs.size());
+        const Alembic::Util::wstring * wdata =
+            (const Alembic::Util::wstring *)(samp->getData());
+        for (std::size_t i = 0; i < wstrs.size(); ++i)
+        {
+            TESTING_ASSERT(wdata[i] == wstrs[i]);
+        }
+    }
+}
+
+//-*****************************************************************************
+void testChunkedKeys(bool iUseMMap)
+{
+    std::string archiveName = "chunkedKeys.abc";
+
+    ABCA::DataType dtype(Alembic::Util::kFloat32POD);
+
+    // a bit over 2.5 chunks worth
+    std::vector< Alembic::Util::float32_t > big(
+        (ABCA::kSampleKeyChunkSize * 5) / 8 + 3);
+    for (std::size_t i = 0; i < big.size(); ++i)
+    {
+        big[i] = (Alembic::Util::float32_t) i;
+    }
+    ABCA::ArraySample bigSamp(&(big.front()), dtype,
+                              Alembic::Util::Dimensions(big.size()));
+
+    std::vector< Alembic::Util::float32_t > small(10, 3.0f);
+    ABCA::ArraySample smallSamp(&(small.front()), dtype,
+                                Alembic::Util::Dimensions(small.size()));
+
+    // the number of threads can't change the key
+    std::vector< Alembic::Util::uint8_t > packed;
+    ABCA::ArraySampleKey bigKey =
+        bigSamp.getKey(packed, ABCA::kChunkedSampleKey, 1);
+    TESTING_ASSERT(bigKey.keyType == ABCA::kChunkedSampleKey);
+    TESTING_ASSERT(bigKey ==
+        bigSamp.getKey(packed, ABCA::kChunkedSampleKey, 4));
+    TESTING_ASSERT(bigKey ==
+        bigSamp.getKey(packed, ABCA::kChunkedSampleKey, 100));
+    TESTING_ASSERT(bigKey.digest != bigSamp.getKey().digest);
+
+    // one chunk has the original digest, but the keys still differ
+    ABCA::ArraySampleKey smallKey =
+        smallSamp.getKey(packed, ABCA::kChunkedSampleKey, 4);
+    TESTING_ASSERT(smallKey.digest == smallSamp.getKey().digest);
+    TESTING_ASSERT(smallKey != smallSamp.getKey());
+
+    {
+        AO::WriteArchive w;
+        w.setChunkedSampleKeys(4);
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr archive = a->getTop();
+        ABCA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("a", ABCA::MetaData(), dtype, 0);
+        awp->setSample(bigSamp);
+        awp->setSample(smallSamp);
+        awp->setSample(ABCA::ArraySample(NULL, dtype,
+                                         Alembic::Util::Dimensions(0)));
+
+        ABCA::ArrayPropertyWriterPtr bwp =
+            parent->createArrayProperty("b", ABCA::MetaData(), dtype, 0);
+        bwp->setSample(bigSamp);
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        TESTING_ASSERT(a->getMetaData().get("_ai_SampleKeyType") == "1");
+
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+        ABCA::ArrayPropertyReaderPtr ap = parent->getArrayProperty("a");
+        ABCA::ArrayPropertyReaderPtr bp = parent->getArrayProperty("b");
+        TESTING_ASSERT(ap->getNumSamples() == 3);
+
+        ABCA::ArraySampleKey key;
+        TESTING_ASSERT(ap->getKey(0, key));
+        TESTING_ASSERT(key == bigKey);
+        TESTING_ASSERT(bp->getKey(0, key));
+        TESTING_ASSERT(key == bigKey);
+        TESTING_ASSERT(ap->getKey(1, key));
+        TESTING_ASSERT(key == smallKey);
+
+        ABCA::ArraySamplePtr samp;
+        ap->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == big.size());
+        TESTING_ASSERT(std::equal(big.begin(), big.end(),
+            (const Alembic::Util::float32_t *)(samp->getData())));
+        ap->getSample(2, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == 0);
+    }
+
+    {
+        // both properties should share the one copy of the big sample
+        Alembic::Ogawa::IArchive ia(archiveName, 1, iUseMMap);
+        Alembic::Ogawa::IGroupPtr props = ia.getGroup()->getGroup(2, false, 0)->
+            getGroup(0, false, 0);
+        TESTING_ASSERT(props->getGroup(0, false, 0)->getData(0, 0)->getPos() ==
+                       props->getGroup(1, false, 0)->getData(0, 0)->getPos());
+    }
+
+    {
+        // 0 threads turns chunked keys back off
+        AO::WriteArchive w;
+        w.setChunkedSampleKeys(4);
+        w.setChunkedSampleKeys(0);
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ArrayPropertyWriterPtr awp = a->getTop()->getProperties()->
+            createArrayProperty("a", ABCA::MetaData(), dtype, 0);
+        awp->setSample(bigSamp);
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        TESTING_ASSERT(a->getMetaData().get("_ai_SampleKeyType") == "");
+
+        ABCA::ArraySampleKey key;
+        TESTING_ASSERT(a->getTop()->getProperties()->getArrayProperty("a")->
+                       getKey(0, key));
+        TESTING_ASSERT(key == bigSamp.getKey());
+    }
+}
+
+void testCopySamples(bool iUseMMap)
+{
+    std::string srcName = "copySamplesSrc.abc";
+    std::string dstName = "copySamplesDst.abc";
+    std::string chunkedName = "copySamplesChunked.abc";
+
+    ABCA::DataType fdtype(Alembic::Util::kFloat32POD, 3);
+    ABCA::DataType sdtype(Alembic::Util::kStringPOD);
+    ABCA::DataType wdtype(Alembic::Util::kWstringPOD);
+
+    std::vector< Alembic::Util::float32_t > floats(30);
+    for (std::size_t i = 0; i < floats.size(); ++i)
+    {
+        floats[i] = (Alembic::Util::float32_t) i * 0.5f;
+    }
+
+    std::vector< std::string > strs;
+    strs.push_back("potato");
+    strs.push_back("");
+    strs.push_back("salad");
+
+    std::vector< Alembic::Util::wstring > wstrs;
+    wstrs.push_back(L"\u00e9t\u00e9");
+    wstrs.push_back(L"hiver");
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(srcName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr fp =
+            parent->createArrayProperty("f", ABCA::MetaData(), fdtype, 0);
+        fp->setSample(ABCA::ArraySample(&floats.front(), fdtype,
+                                        Alembic::Util::Dimensions(10)));
+        fp->setSample(ABCA::ArraySample(&floats.front(), fdtype,
+                                        Alembic::Util::Dimensions(10)));
+        fp->setSample(ABCA::ArraySample(&floats.front(), fdtype,
+                                        Alembic::Util::Dimensions(4)));
+        fp->setSample(ABCA::ArraySample(NULL, fdtype,
+                                        Alembic::Util::Dimensions(0)));
+
+        ABCA::ArrayPropertyWriterPtr sp =
+            parent->createArrayProperty("s", ABCA::MetaData(), sdtype, 0);
+        sp->setSample(ABCA::ArraySample(&strs.front(), sdtype,
+                                        Alembic::Util::Dimensions(3)));
+        sp->setSample(ABCA::ArraySample(&strs.front(), sdtype,
+                                        Alembic::Util::Dimensions(1)));
+
+        ABCA::ArrayPropertyWriterPtr wp =
+            parent->createArrayProperty("w", ABCA::MetaData(), wdtype, 0);
+        wp->setSample(ABCA::ArraySample(&wstrs.front(), wdtype,
+                                        Alembic::Util::Dimensions(2)));
+
+        ABCA::ScalarPropertyWriterPtr scp =
+            parent->createScalarProperty("sc", ABCA::MetaData(), sdtype, 0);
+        scp->setSample(&strs.back());
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr src = r(srcName);
+    ABCA::CompoundPropertyReaderPtr srcProps = src->getTop()->getProperties();
+
+    // the raw copy, and the decoded copy into an archive with other keys
+    for (std::size_t chunked = 0; chunked < 2; ++chunked)
+    {
+        AO::WriteArchive w;
+        if (chunked)
+        {
+            w.setChunkedSampleKeys(2);
+        }
+        ABCA::ArchiveWriterPtr a =
+            w(chunked ? chunkedName : dstName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        for (std::size_t i = 0; i < srcProps->getNumProperties(); ++i)
+        {
+            const ABCA::PropertyHeader & header =
+                srcProps->getPropertyHeader(i);
+            if (header.isArray())
+            {
+                AO::CopyProperty(srcProps->getArrayProperty(header.getName()),
+                    parent->createArrayProperty(header.getName(),
+                        header.getMetaData(), header.getDataType(), 0));
+            }
+            else
+            {
+                AO::CopyProperty(srcProps->getScalarProperty(header.getName()),
+                    parent->createScalarProperty(header.getName(),
+                        header.getMetaData(), header.getDataType(), 0));
+            }
+        }
+
+        // the copied float samples can be shared with new ones
+        ABCA::ArrayPropertyWriterPtr gp =
+            parent->createArrayProperty("g", ABCA::MetaData(), fdtype, 0);
+        gp->setSample(ABCA::ArraySample(&floats.front(), fdtype,
+                                        Alembic::Util::Dimensions(4)));
+    }
+
+    for (std::size_t chunked = 0; chunked < 2; ++chunked)
+    {
+        ABCA::ArchiveReaderPtr dst = r(chunked ? chunkedName : dstName);
+        ABCA::CompoundPropertyReaderPtr dstProps =
+            dst->getTop()->getProperties();
+
+        const char * names[3] = { "f", "s", "w" };
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            ABCA::ArrayPropertyReaderPtr sp =
+                srcProps->getArrayProperty(names[i]);
+            ABCA::ArrayPropertyReaderPtr dp =
+                dstProps->getArrayProperty(names[i]);
+            TESTING_ASSERT(dp->getNumSamples() == sp->getNumSamples());
+            TESTING_ASSERT(dp->isConstant() == sp->isConstant());
+
+            for (std::size_t j = 0; j < sp->getNumSamples(); ++j)
+            {
+                ABCA::ArraySampleKey skey;
+                ABCA::ArraySampleKey dkey;
+                TESTING_ASSERT(sp->getKey(j, skey));
+                TESTING_ASSERT(dp->getKey(j, dkey));
+                if (chunked)
+                {
+                    TESTING_ASSERT(dkey.keyType == ABCA::kChunkedSampleKey);
+                    TESTING_ASSERT(skey != dkey);
+                }
+                else
+                {
+                    TESTING_ASSERT(skey == dkey);
+                }
+
+                ABCA::ArraySamplePtr ssamp;
+                ABCA::ArraySamplePtr dsamp;
+                sp->getSample(j, ssamp);
+                dp->getSample(j, dsamp);
+                TESTING_ASSERT(ssamp->getDimensions() ==
+                               dsamp->getDimensions());
+                TESTING_ASSERT(ssamp->getDataType() == dsamp->getDataType());
+            }
+        }
+
+        ABCA::ArraySamplePtr samp;
+        dstProps->getArrayProperty("f")->getSample(1, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == 10);
+        TESTING_ASSERT(std::equal(floats.begin(), floats.end(),
+            (const Alembic::Util::float32_t *)(samp->getData())));
+
+        dstProps->getArrayProperty("s")->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == 3);
+        TESTING_ASSERT(std::equal(strs.begin(), strs.end(),
+            (const std::string *)(samp->getData())));
+
+        dstProps->getArrayProperty("w")->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == 2);
+        TESTING_ASSERT(std::equal(wstrs.begin(), wstrs.end(),
+            (const Alembic::Util::wstring *)(samp->getData())));
+
+        std::string sc;
+        dstProps->getScalarProperty("sc")->getSample(0, &sc);
+        TESTING_ASSERT(sc == strs.back());
+    }
+
+    {
+        // the repeated float sample was only stored once and the new
+        // property shares the copied data
+        Alembic::Ogawa::IArchive ia(dstName, 1, iUseMMap);
+        Alembic::Ogawa::IGroupPtr props = ia.getGroup()->getGroup(2, false, 0)->
+            getGroup(0, false, 0);
+        Alembic::Ogawa::IGroupPtr fgroup = props->getGroup(0, false, 0);
+        TESTING_ASSERT(fgroup->getNumChildren() == 6);
+        TESTING_ASSERT(fgroup->getData(2, 0)->getPos() ==
+                       props->getGroup(4, false, 0)->getData(0, 0)->getPos());
+    }
+}
+
+//-*****************************************************************************
+void writeDeltaPositions(const std::string & iName,
+                         Alembic::Util::uint32_t iKeyframeInterval)
+{
+    ABCA::DataType dtype(Alembic::Util::kFloat32POD, 3);
+    ABCA::DataType idtype(Alembic::Util::kInt32POD);
+
+    AO::WriteArchive w;
+    w.setFloatDeltaEncoding(iKeyframeInterval);
+    ABCA::ArchiveWriterPtr a = w(iName, ABCA::MetaData());
+    ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+    ABCA::ArrayPropertyWriterPtr pp =
+        parent->createArrayProperty("P", ABCA::MetaData(), dtype, 0);
+    ABCA::ArrayPropertyWriterPtr ip =
+        parent->createArrayProperty("ids", ABCA::MetaData(), idtype, 0);
+
+    std::vector< Alembic::Util::int32_t > ids(100);
+    for (std::size_t f = 0; f < 30; ++f)
+    {
+        // the same positions twice, then a few less points, then a frame
+        // that is completely different
+        std::size_t numPoints = f < 20 ? 1000 : 900;
+        if (f == 11)
+        {
+            pp->setFromPreviousSample();
+            continue;
+        }
+
+        std::vector< Alembic::Util::float32_t > pos(numPoints * 3);
+        for (std::size_t i = 0; i < pos.size(); ++i)
+        {
+            pos[i] = (Alembic::Util::float32_t)(i % 97) +
+                0.01f * (Alembic::Util::float32_t) sin(f * 0.1 + i);
+            if (f == 25)
+            {
+                pos[i] = (Alembic::Util::float32_t) i * -3.7f;
+            }
+        }
+
+        pp->setSample(ABCA::ArraySample(&pos.front(), dtype,
+                                        Alembic::Util::Dimensions(numPoints)));
+
+        ids[f] = (Alembic::Util::int32_t) f;
+        ip->setSample(ABCA::ArraySample(&ids.front(), idtype,
+                                        Alembic::Util::Dimensions(ids.size())));
+    }
+}
+
+//-*****************************************************************************
+void testDeltaEncoding(bool iUseMMap)
+{
+    std::string plainName = "deltaPlain.abc";
+    std::string deltaName = "deltaEncoded.abc";
+
+    writeDeltaPositions(plainName, 0);
+    writeDeltaPositions(deltaName, 8);
+
+    {
+        std::ifstream plainFile(plainName.c_str(),
+            std::ios_base::binary | std::ios_base::ate);
+        std::ifstream deltaFile(deltaName.c_str(),
+            std::ios_base::binary | std::ios_base::ate);
+        TESTING_ASSERT(deltaFile.tellg() * 4 < plainFile.tellg() * 3);
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr plain = r(plainName);
+    ABCA::ArchiveReaderPtr delta = r(deltaName);
+
+    // nothing about the samples changed, so neither did the hashes
+    Alembic::Util::Digest plainHash, deltaHash;
+    TESTING_ASSERT(plain->getTop()->getPropertiesHash(plainHash));
+    TESTING_ASSERT(delta->getTop()->getPropertiesHash(deltaHash));
+    TESTING_ASSERT(plainHash == deltaHash);
+
+    const char * names[2] = { "P", "ids" };
+    for (std::size_t n = 0; n < 2; ++n)
+    {
+        ABCA::ArrayPropertyReaderPtr pp =
+            plain->getTop()->getProperties()->getArrayProperty(names[n]);
+        ABCA::ArrayPropertyReaderPtr dp =
+            delta->getTop()->getProperties()->getArrayProperty(names[n]);
+        TESTING_ASSERT(dp->getNumSamples() == pp->getNumSamples());
+
+        // backwards, then forwards, then jumping around
+        std::vector< std::size_t > order;
+        for (std::size_t i = pp->getNumSamples(); i > 0; --i)
+        {
+            order.push_back(i - 1);
+        }
+        for (std::size_t i = 0; i < pp->getNumSamples(); ++i)
+        {
+            order.push_back(i);
+            order.push_back((i * 7) % pp->getNumSamples());
+        }
+
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            ABCA::ArraySamplePtr psamp, dsamp;
+            pp->getSample(order[i], psamp);
+            dp->getSample(order[i], dsamp);
+            TESTING_ASSERT(psamp->getDimensions() == dsamp->getDimensions());
+            std::size_t numBytes = psamp->getDimensions().numPoints() *
+                psamp->getDataType().getNumBytes();
+            TESTING_ASSERT(memcmp(psamp->getData(), dsamp->getData(),
+                                  numBytes) == 0);
+
+            ABCA::ArraySampleKey pkey, dkey;
+            TESTING_ASSERT(pp->getKey(order[i], pkey));
+            TESTING_ASSERT(dp->getKey(order[i], dkey));
+            TESTING_ASSERT(pkey == dkey);
+            TESTING_ASSERT(dkey.numBytes == numBytes);
+
+            Alembic::Util::Dimensions dims;
+            dp->getDimensions(order[i], dims);
+            TESTING_ASSERT(dims == psamp->getDimensions());
+        }
+    }
+
+    ABCA::ArrayPropertyReaderPtr dp =
+        delta->getTop()->getProperties()->getArrayProperty("P");
+    ABCA::ArraySamplePtr samp;
+    dp->getSample(17, samp);
+    std::vector< Alembic::Util::float64_t > doubles(3000);
+    dp->getAs(17, &doubles.front(), Alembic::Util::kFloat64POD);
+    const Alembic::Util::float32_t * floats =
+        (const Alembic::Util::float32_t *)(samp->getData());
+    for (std::size_t i = 0; i < doubles.size(); ++i)
+    {
+        TESTING_ASSERT(doubles[i] == (Alembic::Util::float64_t) floats[i]);
+    }
+
+    {
+        // frames 1 to 7 are deltas, frame 8 is the next keyframe, the ids
+        // are never delta encoded
+        Alembic::Ogawa::IArchive ia(deltaName, 1, iUseMMap);
+        Alembic::Ogawa::IGroupPtr props = ia.getGroup()->getGroup(2, false, 0)->
+            getGroup(0, false, 0);
+        Alembic::Ogawa::IGroupPtr pgroup = props->getGroup(0, false, 0);
+        TESTING_ASSERT(pgroup->getData(0, 0)->getSize() == 16 + 12000);
+        TESTING_ASSERT(pgroup->getData(2, 0)->getSize() < 12000);
+        TESTING_ASSERT(pgroup->getData(14, 0)->getSize() < 12000);
+        TESTING_ASSERT(pgroup->getData(16, 0)->getSize() == 16 + 12000);
+        TESTING_ASSERT(props->getGroup(1, false, 0)->getData(2, 0)->getSize()
+                       == 16 + 400);
+    }
+}
+
+//-*****************************************************************************
+void testCopyDeltas(bool iUseMMap)
+{
+    std::string deltaName = "copyDeltasSrc.abc";
+    writeDeltaPositions(deltaName, 8);
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr src = r(deltaName);
+    ABCA::CompoundPropertyReaderPtr srcProps = src->getTop()->getProperties();
+
+    // a longer keyframe interval takes the deltas as they are, a shorter one
+    // needs some decoded for its keyframes, and without delta encoding they
+    // are all decoded
+    Alembic::Util::uint32_t intervals[3] = { 100, 4, 0 };
+    const char * names[3] = { "copyDeltas100.abc", "copyDeltas4.abc",
+                              "copyDeltas0.abc" };
+    for (std::size_t n = 0; n < 3; ++n)
+    {
+        AO::WriteArchive w;
+        w.setFloatDeltaEncoding(intervals[n]);
+        ABCA::ArchiveWriterPtr a = w(names[n], ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+        for (std::size_t i = 0; i < srcProps->getNumProperties(); ++i)
+        {
+            const ABCA::PropertyHeader & header =
+                srcProps->getPropertyHeader(i);
+            AO::CopyProperty(srcProps->getArrayProperty(header.getName()),
+                parent->createArrayProperty(header.getName(),
+                    header.getMetaData(), header.getDataType(), 0));
+        }
+    }
+
+    Alembic::Util::Digest srcHash;
+    TESTING_ASSERT(src->getTop()->getPropertiesHash(srcHash));
+    for (std::size_t n = 0; n < 3; ++n)
+    {
+        ABCA::ArchiveReaderPtr dst = r(names[n]);
+        Alembic::Util::Digest dstHash;
+        TESTING_ASSERT(dst->getTop()->getPropertiesHash(dstHash));
+        TESTING_ASSERT(dstHash == srcHash);
+
+        ABCA::ArrayPropertyReaderPtr sp = srcProps->getArrayProperty("P");
+        ABCA::ArrayPropertyReaderPtr dp =
+            dst->getTop()->getProperties()->getArrayProperty("P");
+        TESTING_ASSERT(dp->getNumSamples() == sp->getNumSamples());
+        for (std::size_t i = 0; i < sp->getNumSamples(); ++i)
+        {
+            ABCA::ArraySamplePtr ssamp, dsamp;
+            sp->getSample(i, ssamp);
+            dp->getSample(i, dsamp);
+            TESTING_ASSERT(ssamp->getDimensions() == dsamp->getDimensions());
+            std::size_t numBytes = ssamp->getDimensions().numPoints() *
+                ssamp->getDataType().getNumBytes();
+            TESTING_ASSERT(memcmp(ssamp->getData(), dsamp->getData(),
+                                  numBytes) == 0);
+        }
+    }
+
+    {
+        // the copied deltas are the stored ones, keyframes included, which
+        // encoding the samples again would only have written at frame 0
+        Alembic::Ogawa::IArchive sa(deltaName, 1, iUseMMap);
+        Alembic::Ogawa::IArchive da(names[0], 1, iUseMMap);
+        Alembic::Ogawa::IGroupPtr sgroup = sa.getGroup()->getGroup(2, false, 0)->
+            getGroup(0, false, 0)->getGroup(0, false, 0);
+        Alembic::Ogawa::IGroupPtr dgroup = da.getGroup()->getGroup(2, false, 0)->
+            getGroup(0, false, 0)->getGroup(0, false, 0);
+        TESTING_ASSERT(dgroup->getNumChildren() == sgroup->getNumChildren());
+        TESTING_ASSERT(dgroup->getData(16, 0)->getSize() == 16 + 12000);
+        for (std::size_t i = 0; i < sgroup->getNumChildren(); i += 2)
+        {
+            Alembic::Ogawa::IDataPtr sdata = sgroup->getData(i, 0);
+            Alembic::Ogawa::IDataPtr ddata = dgroup->getData(i, 0);
+            TESTING_ASSERT(sdata->getSize() == ddata->getSize());
+
+            std::vector< char > sbytes(sdata->getSize());
+            std::vector< char > dbytes(ddata->getSize());
+            sdata->read(sbytes.size(), &sbytes.front(), 0, 0);
+            ddata->read(dbytes.size(), &dbytes.front(), 0, 0);
+            TESTING_ASSERT(sbytes == dbytes);
+        }
+    }
+
+    {
+        // with a keyframe every 4 stored samples, frame 4 had to be decoded
+        Alembic::Ogawa::IArchive da(names[1], 1, iUseMMap);
+        Alembic::Ogawa::IGroupPtr dgroup = da.getGroup()->getGroup(2, false, 0)->
+            getGroup(0, false, 0)->getGroup(0, false, 0);
+        TESTING_ASSERT(dgroup->getData(2, 0)->getSize() < 12000);
+        TESTING_ASSERT(dgroup->getData(8, 0)->getSize() == 16 + 12000);
+        TESTING_ASSERT(dgroup->getData(10, 0)->getSize() < 12000);
+    }
+}
+
 void runTests(bool iUseMMap)
 {
     testEmptyArray(iUseMMap);
@@ -2025,6 +2801,13 @@ void runTests(bool iUseMMap)
     testExtentArrayStrings(iUseMMap);
     testArrayStringsRepeats(iUseMMap);
     testArraySamples(iUseMMap);
+    testSampleTables(iUseMMap);
+    testAlignedData(iUseMMap);
+    testPackedStrings(iUseMMap);
+    testChunkedKeys(iUseMMap);
+    testCopySamples(iUseMMap);
+    testDeltaEncoding(iUseMMap);
+    testCopyDeltas(iUseMMap);
 
     if (!iUseMMap)
     {
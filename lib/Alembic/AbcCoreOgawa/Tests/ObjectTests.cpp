@@ -301,11 +301,127 @@ void testMetaData(bool iUseMMap)
     }
 }
 
+//-*****************************************************************************
+// every object is held on to until the end, like an exporter might, and is
+// finalized as soon as it is done when iFinalize is true
+void writeFinalizeArchive(const std::string & iName, bool iFinalize)
+{
+    AO::WriteArchive w;
+    AbcA::ArchiveWriterPtr a = w(iName, AbcA::MetaData());
+    AbcA::ObjectWriterPtr archive = a->getTop();
+
+    AbcA::DataType dtype(Alembic::Util::kInt32POD);
+    AbcA::ObjectWriterPtr parent = archive->createChild(
+        AbcA::ObjectHeader("parent", AbcA::MetaData()));
+
+    std::vector< AbcA::ObjectWriterPtr > children;
+    for (Alembic::Util::int32_t i = 0; i < 3; ++i)
+    {
+        std::stringstream strm;
+        strm << i;
+        AbcA::MetaData md;
+        md.set("child", strm.str());
+        AbcA::ObjectWriterPtr child = parent->createChild(
+            AbcA::ObjectHeader(strm.str(), md));
+        children.push_back(child);
+
+        {
+            AbcA::ArrayPropertyWriterPtr awp =
+                child->getProperties()->createArrayProperty("vals",
+                    AbcA::MetaData(), dtype, 0);
+            std::vector< Alembic::Util::int32_t > vals(i + 1, i);
+            awp->setSample(AbcA::ArraySample(&(vals.front()), dtype,
+                Alembic::Util::Dimensions(vals.size())));
+        }
+
+        if (iFinalize)
+        {
+            // the parent can't be done while a child is still going
+            if (i == 0)
+            {
+                TESTING_ASSERT_THROW(parent->finalize(),
+                    Alembic::Util::Exception);
+            }
+
+            child->finalize();
+            TESTING_ASSERT_THROW(child->createChild(
+                AbcA::ObjectHeader("late", AbcA::MetaData())),
+                Alembic::Util::Exception);
+            TESTING_ASSERT_THROW(child->getProperties(),
+                Alembic::Util::Exception);
+
+            // finalizing twice is harmless
+            child->finalize();
+        }
+    }
+
+    {
+        // properties that are still around stop the object from finishing
+        AbcA::CompoundPropertyWriterPtr props = parent->getProperties();
+        if (iFinalize)
+        {
+            TESTING_ASSERT_THROW(parent->finalize(),
+                Alembic::Util::Exception);
+        }
+    }
+
+    if (iFinalize)
+    {
+        parent->finalize();
+    }
+
+    // the top object is written by the archive, so this does nothing
+    archive->finalize();
+    archive->createChild(AbcA::ObjectHeader("sibling", AbcA::MetaData()));
+}
+
+//-*****************************************************************************
+void testFinalize(bool iUseMMap)
+{
+    writeFinalizeArchive("objectKeepTest.abc", false);
+    writeFinalizeArchive("objectFinalizeTest.abc", true);
+
+    AO::ReadArchive r(1, iUseMMap);
+    AbcA::ArchiveReaderPtr keep = r("objectKeepTest.abc");
+    AbcA::ArchiveReaderPtr fin = r("objectFinalizeTest.abc");
+
+    TESTING_ASSERT(fin->getTop()->getNumChildren() == 2);
+    AbcA::ObjectReaderPtr keepParent = keep->getTop()->getChild(0);
+    AbcA::ObjectReaderPtr finParent = fin->getTop()->getChild(0);
+    TESTING_ASSERT(finParent->getNumChildren() == 3);
+
+    // finalizing changes where things end up, but not what they are
+    Alembic::Util::Digest keepHash, finHash;
+    TESTING_ASSERT(keepParent->getChildrenHash(keepHash));
+    TESTING_ASSERT(finParent->getChildrenHash(finHash));
+    TESTING_ASSERT(keepHash == finHash);
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        AbcA::ObjectReaderPtr child = finParent->getChild(i);
+        std::stringstream strm;
+        strm << i;
+        TESTING_ASSERT(child->getName() == strm.str());
+        TESTING_ASSERT(child->getMetaData().get("child") == strm.str());
+
+        AbcA::ArraySamplePtr samp;
+        child->getProperties()->getArrayProperty("vals")->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == i + 1);
+        TESTING_ASSERT(((const Alembic::Util::int32_t *)
+            samp->getData())[i] == (Alembic::Util::int32_t) i);
+
+        TESTING_ASSERT(keepParent->getChild(i)->getPropertiesHash(keepHash));
+        TESTING_ASSERT(child->getPropertiesHash(finHash));
+        TESTING_ASSERT(keepHash == finHash);
+    }
+}
+
 void runTests(bool iUseMMap)
 {
     testObjects(iUseMMap);
     testChildObjects(iUseMMap);
     testMetaData(iUseMMap);
+    testFinalize(iUseMMap);
 }
 
 int main ( int argc, char *argv[] )
@@ -837,12 +837,199 @@ void testScalarSamples(bool iUseMMap)
     }
 }
 
+//-*****************************************************************************
+void testPackedScalars(bool iUseMMap)
+{
+    std::string archiveName = "packedScalars.abc";
+
+    std::size_t numSamples = 30;
+
+    {
+        AO::WriteArchive w;
+        w.setPackScalarSamples( true );
+        AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+        AbcA::ObjectWriterPtr archive = a->getTop();
+
+        AbcA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        // every sample is different
+        AbcA::ScalarPropertyWriterPtr vals =
+            parent->createScalarProperty("vals", AbcA::MetaData(),
+                AbcA::DataType(Alembic::Util::kFloat64POD, 16), 0);
+
+        // held values, with repeats at the start, middle and end
+        AbcA::ScalarPropertyWriterPtr held =
+            parent->createScalarProperty("held", AbcA::MetaData(),
+                AbcA::DataType(Alembic::Util::kInt32POD, 1), 0);
+
+        // never changes
+        AbcA::ScalarPropertyWriterPtr vis =
+            parent->createScalarProperty("visible", AbcA::MetaData(),
+                AbcA::DataType(Alembic::Util::kInt8POD, 1), 0);
+
+        // strings are never packed
+        AbcA::ScalarPropertyWriterPtr str =
+            parent->createScalarProperty("str", AbcA::MetaData(),
+                AbcA::DataType(Alembic::Util::kStringPOD, 1), 0);
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            std::vector< Alembic::Util::float64_t > m(16, (double) i);
+            vals->setSample(&(m.front()));
+
+            Alembic::Util::int32_t h = (Alembic::Util::int32_t)(i / 7);
+            if (i > 25)
+            {
+                h = 3;
+            }
+            held->setSample(&h);
+
+            Alembic::Util::int8_t v = 1;
+            vis->setSample(&v);
+
+            Alembic::Util::string s = (i % 2) ? "odd" : "even";
+            str->setSample(&s);
+        }
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+        AbcA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+        AbcA::ScalarPropertyReaderPtr vals = parent->getScalarProperty("vals");
+        AbcA::ScalarPropertyReaderPtr held = parent->getScalarProperty("held");
+        AbcA::ScalarPropertyReaderPtr vis =
+            parent->getScalarProperty("visible");
+        AbcA::ScalarPropertyReaderPtr str = parent->getScalarProperty("str");
+
+        TESTING_ASSERT(vals->getNumSamples() == numSamples);
+        TESTING_ASSERT(held->getNumSamples() == numSamples);
+        TESTING_ASSERT(vis->getNumSamples() == numSamples);
+        TESTING_ASSERT(vis->isConstant());
+        TESTING_ASSERT(str->getNumSamples() == numSamples);
+
+        // read backwards to make sure nothing depends on read order
+        for (std::size_t j = numSamples; j > 0; --j)
+        {
+            std::size_t i = j - 1;
+
+            std::vector< Alembic::Util::float64_t > m(16, -1.0);
+            vals->getSample(i, &(m.front()));
+            for (std::size_t k = 0; k < 16; ++k)
+            {
+                TESTING_ASSERT(m[k] == (double) i);
+            }
+
+            Alembic::Util::int32_t h = -1;
+            held->getSample(i, &h);
+            TESTING_ASSERT(h == (i > 25 ? 3 : (Alembic::Util::int32_t)(i / 7)));
+
+            Alembic::Util::int8_t v = 0;
+            vis->getSample(i, &v);
+            TESTING_ASSERT(v == 1);
+
+            Alembic::Util::string s;
+            str->getSample(i, &s);
+            TESTING_ASSERT(s == ((i % 2) ? "odd" : "even"));
+        }
+    }
+}
+
+//-*****************************************************************************
+void testInlineScalars(bool iUseMMap)
+{
+    std::string archiveName = "inlineScalars.abc";
+
+    std::size_t numSamples = 12;
+
+    {
+        AO::WriteArchive w;
+        w.setInlineSmallSamples( true );
+        AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+        AbcA::ObjectWriterPtr archive = a->getTop();
+
+        AbcA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        AbcA::ScalarPropertyWriterPtr vis =
+            parent->createScalarProperty("visible", AbcA::MetaData(),
+                AbcA::DataType(Alembic::Util::kInt8POD, 1), 0);
+
+        AbcA::ScalarPropertyWriterPtr inherits =
+            parent->createScalarProperty(".inherits", AbcA::MetaData(),
+                AbcA::DataType(Alembic::Util::kBooleanPOD, 1), 0);
+
+        AbcA::ScalarPropertyWriterPtr ops =
+            parent->createScalarProperty(".ops", AbcA::MetaData(),
+                AbcA::DataType(Alembic::Util::kUint8POD, 4), 0);
+
+        // too big to be inlined
+        AbcA::ScalarPropertyWriterPtr dbl =
+            parent->createScalarProperty("double", AbcA::MetaData(),
+                AbcA::DataType(Alembic::Util::kFloat64POD, 1), 0);
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            Alembic::Util::int8_t v = -1;
+            vis->setSample(&v);
+
+            Alembic::Util::bool_t b = (i / 4) % 2 == 1;
+            inherits->setSample(&b);
+
+            Alembic::Util::uint8_t o[4] = {1, 2, 3, (Alembic::Util::uint8_t) i};
+            ops->setSample(o);
+
+            Alembic::Util::float64_t d = i * 0.5;
+            dbl->setSample(&d);
+        }
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+        AbcA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+        AbcA::ScalarPropertyReaderPtr vis =
+            parent->getScalarProperty("visible");
+        AbcA::ScalarPropertyReaderPtr inherits =
+            parent->getScalarProperty(".inherits");
+        AbcA::ScalarPropertyReaderPtr ops = parent->getScalarProperty(".ops");
+        AbcA::ScalarPropertyReaderPtr dbl =
+            parent->getScalarProperty("double");
+
+        TESTING_ASSERT(vis->isConstant());
+        TESTING_ASSERT(inherits->getNumSamples() == numSamples);
+        TESTING_ASSERT(ops->getNumSamples() == numSamples);
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            Alembic::Util::int8_t v = 0;
+            vis->getSample(i, &v);
+            TESTING_ASSERT(v == -1);
+
+            Alembic::Util::bool_t b = false;
+            inherits->getSample(i, &b);
+            TESTING_ASSERT(b == ((i / 4) % 2 == 1));
+
+            Alembic::Util::uint8_t o[4] = {0, 0, 0, 0};
+            ops->getSample(i, o);
+            TESTING_ASSERT(o[0] == 1 && o[1] == 2 && o[2] == 3 && o[3] == i);
+
+            Alembic::Util::float64_t d = -1.0;
+            dbl->getSample(i, &d);
+            TESTING_ASSERT(d == i * 0.5);
+        }
+    }
+}
+
 void runTests(bool iUseMMap)
 {
     testWeirdStringScalar(iUseMMap);
     testRepeatedScalarData(iUseMMap);
     testReadWriteScalars(iUseMMap);
     testScalarSamples(iUseMMap);
+    testPackedScalars(iUseMMap);
+    testInlineScalars(iUseMMap);
 }
 
 int main ( int argc, char *argv[] )
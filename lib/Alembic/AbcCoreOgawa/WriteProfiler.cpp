@@ -0,0 +1,267 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/WriteProfiler.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// how many properties end up in WriteProfile::largestProperties
+const std::size_t kNumLargestProperties = 10;
+
+bool LargerProperty( const AbcA::WriteProfileProperty & iA,
+                     const AbcA::WriteProfileProperty & iB )
+{
+    return iA.bytes > iB.bytes ||
+        ( iA.bytes == iB.bytes && iA.path < iB.path );
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+WriteProfiler::WriteProfiler()
+    : m_enabled( false )
+    , m_streamProfile( new Ogawa::OStreamProfile() )
+    , m_numDedupHits( 0 )
+    , m_dedupBytesSaved( 0 )
+    , m_closing( false )
+    , m_closeStart( 0.0 )
+{
+    m_phases[kHashPhase].name = "hash";
+    m_phases[kDedupLookupPhase].name = "dedupLookup";
+    m_phases[kHeadersPhase].name = "headers";
+}
+
+//-*****************************************************************************
+WriteProfiler::~WriteProfiler()
+{
+    if ( !isEnabled() || m_fileName.empty() )
+    {
+        return;
+    }
+
+    // nowhere to report anything to from here
+    try
+    {
+        std::ofstream file( m_fileName.c_str() );
+        file << getProfile().toJSON();
+    }
+    catch ( ... )
+    {
+    }
+}
+
+//-*****************************************************************************
+void WriteProfiler::enable( const std::string & iFileName )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_fileName = iFileName;
+    m_enabled = true;
+}
+
+//-*****************************************************************************
+bool WriteProfiler::isEnabled() const
+{
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+    return m_enabled;
+#else
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_enabled;
+#endif
+}
+
+//-*****************************************************************************
+void WriteProfiler::addPhase( Phase iPhase, double iSeconds,
+                              Util::uint64_t iBytes )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_phases[iPhase].seconds += iSeconds;
+    m_phases[iPhase].bytes += iBytes;
+    m_phases[iPhase].count ++;
+}
+
+//-*****************************************************************************
+void WriteProfiler::addHash( double iSeconds, const AbcA::ArraySample & iSamp,
+                             const std::vector< Util::uint8_t > & iPacked )
+{
+    // strings and wstrings are hashed once they are packed
+    Util::uint64_t bytes = iPacked.size();
+    if ( iPacked.empty() )
+    {
+        bytes = iSamp.getDataType().getNumBytes() *
+            iSamp.getDimensions().numPoints();
+    }
+
+    addPhase( kHashPhase, iSeconds, bytes );
+}
+
+//-*****************************************************************************
+void WriteProfiler::addDedupLookup( double iSeconds, bool iFound,
+                                    Util::uint64_t iBytesSaved )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_phases[kDedupLookupPhase].seconds += iSeconds;
+    m_phases[kDedupLookupPhase].count ++;
+    if ( iFound )
+    {
+        m_numDedupHits ++;
+        m_dedupBytesSaved += iBytesSaved;
+        m_phases[kDedupLookupPhase].bytes += iBytesSaved;
+    }
+}
+
+//-*****************************************************************************
+void WriteProfiler::addPropertyBytes( const std::string & iPath,
+                                      Util::uint64_t iBytes )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_propertyBytes[iPath] += iBytes;
+}
+
+//-*****************************************************************************
+Util::uint64_t WriteProfiler::getBytesWritten()
+{
+    return m_streamProfile->getWriteBytes();
+}
+
+//-*****************************************************************************
+void WriteProfiler::startClose()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_closing = true;
+    m_closeStart = Alembic::Util::Timer::now();
+}
+
+//-*****************************************************************************
+AbcA::WriteProfile WriteProfiler::getProfile()
+{
+    AbcA::WriteProfile profile;
+    if ( !isEnabled() )
+    {
+        return profile;
+    }
+
+    AbcA::WriteProfilePhase write, freeze;
+    write.name = "write";
+    freeze.name = "freeze";
+    m_streamProfile->get( write.count, write.bytes, write.seconds,
+                          freeze.count, freeze.bytes, freeze.seconds );
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    profile.phases.push_back( m_phases[kHashPhase] );
+    profile.phases.push_back( m_phases[kDedupLookupPhase] );
+    profile.phases.push_back( write );
+    profile.phases.push_back( freeze );
+    profile.phases.push_back( m_phases[kHeadersPhase] );
+
+    profile.numDedupLookups = m_phases[kDedupLookupPhase].count;
+    profile.numDedupHits = m_numDedupHits;
+    profile.dedupBytesSaved = m_dedupBytesSaved;
+
+    std::map< std::string, Util::uint64_t >::const_iterator it;
+    for ( it = m_propertyBytes.begin(); it != m_propertyBytes.end(); ++it )
+    {
+        AbcA::WriteProfileProperty prop;
+        prop.path = it->first;
+        prop.bytes = it->second;
+        profile.largestProperties.push_back( prop );
+    }
+
+    std::size_t numLargest = std::min( kNumLargestProperties,
+                                       profile.largestProperties.size() );
+    std::partial_sort( profile.largestProperties.begin(),
+                       profile.largestProperties.begin() + numLargest,
+                       profile.largestProperties.end(), LargerProperty );
+    profile.largestProperties.resize( numLargest );
+
+    if ( m_closing )
+    {
+        profile.closed = true;
+        profile.closeSeconds = Alembic::Util::Timer::now() - m_closeStart;
+    }
+
+    return profile;
+}
+
+//-*****************************************************************************
+ProfilePhaseScope::ProfilePhaseScope( WriteProfilerPtr iProfiler,
+                                      WriteProfiler::Phase iPhase )
+    : m_profiler( iProfiler && iProfiler->isEnabled() ?
+                  iProfiler : WriteProfilerPtr() )
+    , m_phase( iPhase )
+    , m_bytesBefore( m_profiler ? m_profiler->getBytesWritten() : 0 )
+    , m_timer( ( bool ) m_profiler )
+{
+}
+
+//-*****************************************************************************
+ProfilePhaseScope::~ProfilePhaseScope()
+{
+    if ( m_profiler )
+    {
+        m_profiler->addPhase( m_phase, m_timer.elapsed(),
+            m_profiler->getBytesWritten() - m_bytesBefore );
+    }
+}
+
+//-*****************************************************************************
+std::string GetProfilePath( AbcA::CompoundPropertyWriterPtr iParent,
+                            const std::string & iName )
+{
+    std::string path = iName;
+    for ( AbcA::CompoundPropertyWriterPtr parent = iParent; parent;
+          parent = parent->getParent() )
+    {
+        // the top compound of an object has no name
+        if ( !parent->getName().empty() )
+        {
+            path = parent->getName() + "/" + path;
+        }
+    }
+
+    return iParent->getObject()->getFullName() + ":" + path;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
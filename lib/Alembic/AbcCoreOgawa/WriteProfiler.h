@@ -0,0 +1,184 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_WriteProfiler_h
+#define Alembic_AbcCoreOgawa_WriteProfiler_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/Util/Timer.h>
+
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+#include <atomic>
+#endif
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Measures how long something took, in seconds.  Timers that aren't
+// running don't look at the clock at all and always give back 0.
+class ProfileTimer
+{
+public:
+    explicit ProfileTimer( bool iRun = true )
+        : m_running( iRun )
+        , m_start( iRun ? Alembic::Util::Timer::now() : 0.0 ) {}
+
+    double elapsed() const
+    {
+        return m_running ? Alembic::Util::Timer::now() - m_start : 0.0;
+    }
+
+private:
+    bool m_running;
+    double m_start;
+};
+
+//-*****************************************************************************
+// Keeps score of where the time and bytes go while an archive is written,
+// for AbcA::ArchiveWriter::getWriteProfile.  Every archive writer has one,
+// but nothing is measured until it is enabled.  It may be added to from any
+// thread.
+//
+// Writing to and freezing groups in the Ogawa stream is measured by the
+// stream itself, see Ogawa::OStreamProfile.
+class WriteProfiler : private Alembic::Util::noncopyable
+{
+public:
+    enum Phase
+    {
+        // computing sample keys
+        kHashPhase = 0,
+
+        // looking for samples among those already written
+        kDedupLookupPhase,
+
+        // writing object and property headers
+        kHeadersPhase,
+
+        kNumPhases
+    };
+
+    WriteProfiler();
+
+    // writes the JSON file if we were asked to, see startClose
+    ~WriteProfiler();
+
+    // if iFileName isn't empty the profile is written to it on destruction
+    void enable( const std::string & iFileName );
+
+    bool isEnabled() const;
+
+    Ogawa::OStreamProfilePtr getStreamProfile() const
+    {
+        return m_streamProfile;
+    }
+
+    void addPhase( Phase iPhase, double iSeconds, Util::uint64_t iBytes );
+
+    // iSamp hashed, iPacked as filled in by ArraySample::getKey
+    void addHash( double iSeconds, const AbcA::ArraySample & iSamp,
+                  const std::vector< Util::uint8_t > & iPacked );
+
+    void addDedupLookup( double iSeconds, bool iFound,
+                         Util::uint64_t iBytesSaved );
+
+    void addPropertyBytes( const std::string & iPath, Util::uint64_t iBytes );
+
+    // everything written to the Ogawa stream so far
+    Util::uint64_t getBytesWritten();
+
+    // The archive is being closed, the time from now until we are
+    // destroyed (after the Ogawa archive) is the close time.
+    void startClose();
+
+    AbcA::WriteProfile getProfile();
+
+private:
+    // without C++11 it is read under m_lock instead
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+    std::atomic< bool > m_enabled;
+#else
+    bool m_enabled;
+#endif
+    std::string m_fileName;
+
+    Ogawa::OStreamProfilePtr m_streamProfile;
+
+    mutable Alembic::Util::mutex m_lock;
+    AbcA::WriteProfilePhase m_phases[kNumPhases];
+    Util::uint64_t m_numDedupHits;
+    Util::uint64_t m_dedupBytesSaved;
+    std::map< std::string, Util::uint64_t > m_propertyBytes;
+
+    // when startClose was called
+    bool m_closing;
+    double m_closeStart;
+};
+
+typedef Alembic::Util::shared_ptr< WriteProfiler > WriteProfilerPtr;
+
+//-*****************************************************************************
+// Adds the time until it goes out of scope, and whatever was written to the
+// stream in the meantime, to a phase of the profiler, if it is enabled.
+class ProfilePhaseScope : private Alembic::Util::noncopyable
+{
+public:
+    ProfilePhaseScope( WriteProfilerPtr iProfiler,
+                       WriteProfiler::Phase iPhase );
+    ~ProfilePhaseScope();
+
+private:
+    WriteProfilerPtr m_profiler;
+    WriteProfiler::Phase m_phase;
+    Util::uint64_t m_bytesBefore;
+    ProfileTimer m_timer;
+};
+
+//-*****************************************************************************
+// The name a property is profiled under, see AbcA::WriteProfileProperty.
+std::string GetProfilePath( AbcA::CompoundPropertyWriterPtr iParent,
+                            const std::string & iName );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
@@ -36,6 +36,10 @@
 
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
+
+#include <algorithm>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -159,14 +163,15 @@ GetWrittenSampleMap( AbcA::ArchiveWriterPtr iVal )
 //-*****************************************************************************
 void WriteDimensions( Ogawa::OGroupPtr iGroup,
                       const AbcA::Dimensions & iDims,
-                      Alembic::Util::PlainOldDataType iPod )
+                      Alembic::Util::PlainOldDataType iPod,
+                      bool iAlwaysWrite )
 {
 
     size_t rank = iDims.rank();
 
     if ( iPod != Alembic::Util::kStringPOD &&
          iPod != Alembic::Util::kWstringPOD &&
-         rank <= 1 )
+         ( rank == 0 || ( rank == 1 && !iAlwaysWrite ) ) )
     {
         // we can figure out the dimensions based on the size  of the data
         // so just set empty data.
@@ -183,7 +188,8 @@ WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey )
+           const AbcA::ArraySample::Key &iKey,
+           const std::vector< Util::uint8_t > &iPacked )
 {
 
     // Okay, need to actually store it.
@@ -192,7 +198,16 @@ WriteData( WrittenSampleMap &iMap,
     const AbcA::Dimensions & dims = iSamp.getDimensions();
 
     // See whether or not we've already stored this.
+    WriteProfilerPtr profiler = iMap.getProfiler();
+    ProfileTimer timer( ( bool ) profiler );
     WrittenSampleIDPtr writeID = iMap.find( iKey );
+    if ( profiler )
+    {
+        // the key and the data are what we don't have to write
+        profiler->addDedupLookup( timer.elapsed(), ( bool ) writeID,
+                                  16 + iKey.numBytes );
+    }
+
     if ( writeID )
     {
         CopyWrittenData( iGroup, writeID );
@@ -203,58 +218,39 @@ WriteData( WrittenSampleMap &iMap,
 
     const AbcA::DataType &dataType = iSamp.getDataType();
 
-    if ( dataType.getPod() == Alembic::Util::kStringPOD )
+    if ( dataType.getPod() == Alembic::Util::kStringPOD ||
+         dataType.getPod() == Alembic::Util::kWstringPOD )
     {
+        // the packed data has one NULL seperator per string, any more than
+        // that means one of the strings had a NULL in it
         size_t numPods = dataType.getExtent() * dims.numPoints();
-        std::vector <Util::int8_t> v;
-        for ( size_t j = 0; j < numPods; ++j )
+        size_t numNulls = 0;
+        if ( dataType.getPod() == Alembic::Util::kStringPOD )
         {
-            const std::string &str =
-                static_cast<const std::string*>( iSamp.getData() )[j];
-
-            ABCA_ASSERT( str.find( '\0' ) == std::string::npos,
+            numNulls = std::count( iPacked.begin(), iPacked.end(), 0 );
+            ABCA_ASSERT( numNulls == numPods,
                      "Illegal NULL character found in string data " );
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
         }
-
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16, v.size() };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
-    }
-    else if ( dataType.getPod() == Alembic::Util::kWstringPOD )
-    {
-        size_t numPods = dataType.getExtent() * dims.numPoints();
-        std::vector <Util::int32_t> v;
-        for ( size_t j = 0; j < numPods; ++j )
+        else
         {
-            const std::wstring &str =
-                static_cast<const std::wstring*>( iSamp.getData() )[j];
-
-            wchar_t nullChar = 0;
-            ABCA_ASSERT( str.find( nullChar ) == std::wstring::npos,
-                     "Illegal NULL character found in wstring data" );
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
+            const Util::int32_t * chars = NULL;
+            if ( !iPacked.empty() )
             {
-                v.push_back(str[k]);
+                chars = reinterpret_cast< const Util::int32_t * >(
+                    &iPacked.front() );
             }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
+            numNulls = std::count( chars,
+                chars + iPacked.size() / sizeof( Util::int32_t ), 0 );
+            ABCA_ASSERT( numNulls == numPods,
+                     "Illegal NULL character found in wstring data" );
         }
 
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16,
-            v.size() * sizeof(Util::int32_t) };
+        const void * datas[2] = { &iKey.digest, NULL };
+        if ( !iPacked.empty() )
+        {
+            datas[1] = &iPacked.front();
+        }
+        Alembic::Util::uint64_t sizes[2] = { 16, iPacked.size() };
         dataPtr =  iGroup->addData( 2, sizes, datas );
     }
     else
@@ -262,7 +258,9 @@ WriteData( WrittenSampleMap &iMap,
         const void * datas[2] = { &iKey.digest, iSamp.getData() };
         Alembic::Util::uint64_t sizes[2] = { 16, iKey.numBytes };
 
-        dataPtr = iGroup->addData( 2, sizes, datas );
+        // pad (if the archive asked for it) so the data after the key is
+        // aligned
+        dataPtr = iGroup->addAlignedData( 2, sizes, datas, 1 );
     }
 
     writeID.reset( new WrittenSampleID( iKey, dataPtr,
@@ -286,11 +284,71 @@ void CopyWrittenData( Ogawa::OGroupPtr iGroup,
     iGroup->addData(iRef->getObjectLocation());
 }
 
+//-*****************************************************************************
+bool
+EncodeFloatDelta( const Util::uint8_t * iReference,
+                  const Util::uint8_t * iData,
+                  std::size_t iNumBytes,
+                  Util::uint32_t iReferenceIndex,
+                  std::vector< Util::uint8_t > & oEncoded )
+{
+    std::size_t numWords = iNumBytes / 4;
+    std::size_t codesSize = ( numWords + 3 ) / 4;
+
+    oEncoded.clear();
+    oEncoded.reserve( iNumBytes );
+    oEncoded.resize( 4 + codesSize, 0 );
+    memcpy( &( oEncoded.front() ), &iReferenceIndex, 4 );
+
+    for ( std::size_t i = 0; i < numWords; ++i )
+    {
+        Util::uint32_t ref, cur;
+        memcpy( &ref, iReference + i * 4, 4 );
+        memcpy( &cur, iData + i * 4, 4 );
+
+        // small changes to a float only touch the low bits of its mantissa
+        Util::uint32_t changed = ref ^ cur;
+        if ( changed == 0 )
+        {
+            continue;
+        }
+
+        Util::uint8_t code = 3;
+        std::size_t numChanged = 4;
+        if ( changed <= 0xffff )
+        {
+            code = 1;
+            numChanged = 2;
+        }
+        else if ( changed <= 0xffffff )
+        {
+            code = 2;
+            numChanged = 3;
+        }
+
+        oEncoded[4 + i / 4] |= code << ( ( i % 4 ) * 2 );
+        for ( std::size_t j = 0; j < numChanged; ++j )
+        {
+            oEncoded.push_back( ( changed >> ( j * 8 ) ) & 0xff );
+        }
+
+        if ( oEncoded.size() >= iNumBytes )
+        {
+            oEncoded.clear();
+            return false;
+        }
+    }
+
+    return oEncoded.size() < iNumBytes;
+}
+
 //-*****************************************************************************
 void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                     const AbcA::PropertyHeader &iHeader,
                     bool isScalarLike,
                     bool isHomogenous,
+                    bool isPacked,
+                    bool isDeltaEncoded,
                     Util::uint32_t iTimeSamplingIndex,
                     Util::uint32_t iNumSamples,
                     Util::uint32_t iFirstChangedIndex,
@@ -345,6 +403,12 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
     //
     // Meta data index mask 0xff00000
     // 0000 1111 1111 0000 0000 0000 0000 0000
+    //
+    // Whether the scalar samples are packed into one block mask 0x10000000
+    // 0001 0000 0000 0000 0000 0000 0000 0000
+    //
+    // Whether the array samples may be delta encoded mask 0x20000000
+    // 0010 0000 0000 0000 0000 0000 0000 0000
 
     std::string metaData = iHeader.getMetaData().serialize();
     Util::uint32_t metaDataSize = metaData.size();
@@ -429,6 +493,16 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
             info |= 0x400;
         }
 
+        if ( isPacked )
+        {
+            info |= 0x10000000;
+        }
+
+        if ( isDeltaEncoded )
+        {
+            info |= 0x20000000;
+        }
+
         ABCA_ASSERT( iFirstChangedIndex <= iNumSamples &&
             iLastChangedIndex <= iNumSamples &&
             iFirstChangedIndex <= iLastChangedIndex,
@@ -536,6 +610,299 @@ void WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
 
 }
 
+//-*****************************************************************************
+void
+ReadPackedSamples( Ogawa::IGroupPtr iGroup,
+                   PropertyHeaderAndFriends & iHeader,
+                   std::vector< Util::uint8_t > & oData,
+                   std::vector< Util::uint32_t > & oChanges )
+{
+    oData.clear();
+    oChanges.clear();
+
+    if ( iHeader.nextSampleIndex == 0 )
+    {
+        return;
+    }
+
+    Ogawa::IDataPtr data = iGroup->getData( 0, 0 );
+    if ( data && data->getSize() > 0 )
+    {
+        oData.resize( data->getSize() );
+        data->read( data->getSize(), &( oData.front() ), 0, 0 );
+    }
+
+    Ogawa::IDataPtr changes = iGroup->getData( 1, 0 );
+    if ( changes && changes->getSize() > 0 )
+    {
+        ABCA_ASSERT( changes->getSize() % 4 == 0,
+                     "Invalid packed scalar property change table." );
+
+        oChanges.resize( changes->getSize() / 4 );
+        changes->read( changes->getSize(), &( oChanges.front() ), 0, 0 );
+    }
+    else
+    {
+        // every stored sample is different
+        std::size_t numStored =
+            iHeader.verifyIndex( iHeader.nextSampleIndex - 1 ) + 1;
+        for ( std::size_t i = 0; i < numStored; ++i )
+        {
+            oChanges.push_back( ( Util::uint32_t ) i );
+        }
+    }
+}
+
+//-*****************************************************************************
+void
+ReadSampleKeys( Ogawa::IGroupPtr iGroup,
+                PropertyHeaderAndFriends & iHeader,
+                AbcA::ArraySampleKeyType iKeyType,
+                std::vector< AbcA::ArraySample::Key > & oKeys,
+                std::vector< AbcA::Dimensions > & oDims )
+{
+    oKeys.clear();
+    oDims.clear();
+
+    if ( iHeader.nextSampleIndex == 0 )
+    {
+        return;
+    }
+
+    std::size_t numStored =
+        iHeader.verifyIndex( iHeader.nextSampleIndex - 1 ) + 1;
+    const AbcA::DataType & dataType = iHeader.header.getDataType();
+    Util::PlainOldDataType pod = dataType.getPod();
+    bool isArray = iHeader.header.isArray();
+    std::vector< Util::uint8_t > unused;
+
+    if ( iHeader.isPacked )
+    {
+        std::vector< Util::uint8_t > packed;
+        std::vector< Util::uint32_t > changes;
+        ReadPackedSamples( iGroup, iHeader, packed, changes );
+
+        std::size_t numBytes = dataType.getNumBytes();
+        ABCA_ASSERT( changes.size() * numBytes <= packed.size(),
+                     "Invalid packed scalar property samples." );
+
+        std::size_t slot = 0;
+        for ( std::size_t i = 0; i < numStored; ++i )
+        {
+            while ( slot + 1 < changes.size() && changes[slot + 1] <= i )
+            {
+                ++slot;
+            }
+
+            AbcA::ArraySample samp( &( packed[slot * numBytes] ), dataType,
+                                    AbcA::Dimensions( 1 ) );
+            oKeys.push_back( samp.getKey( unused, iKeyType, 1 ) );
+        }
+    }
+    else
+    {
+        std::vector< Ogawa::IDataPtr > datas;
+        iGroup->getAllData( datas, 0 );
+
+        for ( std::size_t i = 0; i < numStored; ++i )
+        {
+            std::size_t index = isArray ? i * 2 : i;
+            ABCA_ASSERT( index < datas.size() && datas[index],
+                         "Invalid stored sample " << i << " of property "
+                         << iHeader.header.getName() );
+
+            Ogawa::IDataPtr data = datas[index];
+            AbcA::Dimensions dims( 1 );
+            if ( isArray )
+            {
+                Ogawa::IDataPtr dimsData;
+                if ( index + 1 < datas.size() )
+                {
+                    dimsData = datas[index + 1];
+                }
+                ReadDimensions( dimsData, data, 0, dataType, dims );
+                oDims.push_back( dims );
+            }
+
+            // small scalar samples stored inline don't have a key
+            if ( !isArray && pod < Util::kStringPOD &&
+                 data->getSize() == dataType.getNumBytes() )
+            {
+                std::vector< Util::uint8_t > bytes( data->getSize() );
+                data->read( data->getSize(), &( bytes.front() ), 0, 0 );
+                AbcA::ArraySample samp( &( bytes.front() ), dataType, dims );
+                oKeys.push_back( samp.getKey( unused, iKeyType, 1 ) );
+            }
+            else
+            {
+                AbcA::ArraySample::Key key;
+                key.numBytes = dataType.getNumBytes() * dims.numPoints();
+                key.origPOD = pod;
+                key.readPOD = pod;
+                key.keyType = iKeyType;
+
+                // empty samples don't store a key
+                if ( data->getSize() >= 16 )
+                {
+                    data->read( 16, key.digest.d, 0, 0 );
+                }
+                oKeys.push_back( key );
+            }
+        }
+    }
+
+    if ( pod != Util::kStringPOD && pod != Util::kWstringPOD )
+    {
+        for ( std::size_t i = 0; i < oKeys.size(); ++i )
+        {
+            oKeys[i].origPOD = Util::kInt8POD;
+            oKeys[i].readPOD = Util::kInt8POD;
+        }
+    }
+}
+
+//-*****************************************************************************
+Util::Digest
+HashSampleKeys( PropertyHeaderAndFriends & iHeader,
+                const std::vector< AbcA::ArraySample::Key > & iKeys,
+                const std::vector< AbcA::Dimensions > & iDims )
+{
+    Util::Digest hash;
+    for ( Util::uint32_t i = 0; i < iHeader.nextSampleIndex; ++i )
+    {
+        std::size_t stored = iHeader.verifyIndex( i );
+        ABCA_ASSERT( stored < iKeys.size(), "Missing key for stored sample "
+                     << stored << " of property "
+                     << iHeader.header.getName() );
+
+        Util::Digest digest = iKeys[stored].digest;
+        if ( !iDims.empty() )
+        {
+            HashDimensions( iDims[stored], digest );
+        }
+
+        if ( i == 0 )
+        {
+            hash = digest;
+        }
+        else
+        {
+            Util::SpookyHash::ShortEnd( hash.words[0], hash.words[1],
+                                        digest.words[0], digest.words[1] );
+        }
+    }
+    return hash;
+}
+
+//-*****************************************************************************
+void
+HashExistingProperty( Ogawa::IGroupPtr iGroup,
+                      PropertyHeaderAndFriends & iHeader,
+                      ArImpl & iArchive,
+                      Util::uint64_t & oHash0,
+                      Util::uint64_t & oHash1 )
+{
+    ABCA_ASSERT( iGroup, "Invalid group for existing property "
+                 << iHeader.header.getName() );
+
+    Util::SpookyHash hash;
+    hash.Init( 0, 0 );
+
+    if ( iHeader.header.isCompound() )
+    {
+        PropertyHeaderPtrs headers;
+        std::size_t numChildren = iGroup->getNumChildren();
+        if ( numChildren > 0 && iGroup->isChildData( numChildren - 1 ) )
+        {
+            ReadPropertyHeaders( iGroup, numChildren - 1, 0, iArchive,
+                                 iArchive.getIndexedMetaData(), headers );
+        }
+
+        std::vector< Util::uint64_t > hashes( headers.size() * 2 );
+        for ( std::size_t i = 0; i < headers.size(); ++i )
+        {
+            HashExistingProperty( iGroup->getGroup( i, false, 0 ),
+                                  *headers[i], iArchive, hashes[i * 2],
+                                  hashes[i * 2 + 1] );
+        }
+
+        if ( !hashes.empty() )
+        {
+            hash.Update( &hashes.front(), hashes.size() * 8 );
+        }
+        HashPropertyHeader( iHeader.header, hash );
+    }
+    else
+    {
+        HashPropertyHeader( iHeader.header, hash );
+
+        if ( iHeader.nextSampleIndex != 0 )
+        {
+            std::vector< AbcA::ArraySample::Key > keys;
+            std::vector< AbcA::Dimensions > dims;
+            ReadSampleKeys( iGroup, iHeader, iArchive.sampleKeyType(), keys,
+                            dims );
+            Util::Digest digest = HashSampleKeys( iHeader, keys, dims );
+            hash.Update( digest.d, 16 );
+        }
+    }
+
+    hash.Final( &oHash0, &oHash1 );
+}
+
+//-*****************************************************************************
+void
+HashExistingObject( Ogawa::IGroupPtr iGroup,
+                    const AbcA::ObjectHeader & iHeader,
+                    ArImpl & iArchive,
+                    Util::uint64_t & oHash0,
+                    Util::uint64_t & oHash1 )
+{
+    ABCA_ASSERT( iGroup, "Invalid group for existing object "
+                 << iHeader.getFullName() );
+
+    std::size_t numChildren = iGroup->getNumChildren();
+    ABCA_ASSERT( numChildren > 0 && iGroup->isChildData( numChildren - 1 ),
+                 "Invalid group for existing object "
+                 << iHeader.getFullName() );
+
+    std::vector< ObjectHeaderPtr > headers;
+    ReadObjectHeaders( iGroup, numChildren - 1, 0, iHeader.getFullName(),
+                       iArchive.getIndexedMetaData(), headers );
+
+    // the data hash is stored right after the headers
+    Util::Digest dataHash;
+    Ogawa::IDataPtr data = iGroup->getData( numChildren - 1, 0 );
+    if ( data->getSize() >= 32 )
+    {
+        data->read( 16, dataHash.d, data->getSize() - 32, 0 );
+    }
+
+    Util::SpookyHash hash;
+    hash.Init( 0, 0 );
+
+    std::vector< Util::uint64_t > hashes( headers.size() * 2 );
+    for ( std::size_t i = 0; i < headers.size(); ++i )
+    {
+        HashExistingObject( iGroup->getGroup( i + 1, false, 0 ), *headers[i],
+                            iArchive, hashes[i * 2], hashes[i * 2 + 1] );
+    }
+
+    if ( !hashes.empty() )
+    {
+        hash.Update( &hashes.front(), hashes.size() * 8 );
+    }
+    hash.Update( dataHash.d, 16 );
+
+    std::string metaDataStr = iHeader.getMetaData().serialize();
+    if ( !metaDataStr.empty() )
+    {
+        hash.Update( &( metaDataStr[0] ), metaDataStr.size() );
+    }
+    hash.Update( &( iHeader.getName()[0] ), iHeader.getName().size() );
+    hash.Final( &oHash0, &oHash1 );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
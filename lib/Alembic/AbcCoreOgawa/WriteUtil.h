@@ -45,6 +45,8 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
+
 //-*****************************************************************************
 void HashPropertyHeader( const AbcA::PropertyHeader & iHeader,
                          Util::SpookyHash & ioHash );
@@ -60,10 +62,13 @@ WrittenSampleMap& GetWrittenSampleMap(
     AbcA::ArchiveWriterPtr iArchive );
 
 //-*****************************************************************************
+// Rank 1 dimensions of fixed size PODs are left empty, since readers can
+// figure them out from the size of the data, unless iAlwaysWrite is true.
 void
 WriteDimensions( Ogawa::OGroupPtr iGroup,
                  const AbcA::Dimensions & iDims,
-                 Alembic::Util::PlainOldDataType iPod );
+                 Alembic::Util::PlainOldDataType iPod,
+                 bool iAlwaysWrite = false );
 
 //-*****************************************************************************
 void
@@ -71,11 +76,29 @@ CopyWrittenData( Ogawa::OGroupPtr iParent,
                  WrittenSampleIDPtr iRef );
 
 //-*****************************************************************************
+// iPacked is the string or wstring data packed by ArraySample::getKey, it is
+// ignored for all other PODs.
 WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey );
+           const AbcA::ArraySample::Key &iKey,
+           const std::vector< Util::uint8_t > &iPacked );
+
+//-*****************************************************************************
+// Delta encodes the iNumBytes (a multiple of 4) of iData against iReference,
+// which is stored sample iReferenceIndex of the same property.  The encoded
+// sample is iReferenceIndex as a uint32, then a 2 bit code per 32 bit word
+// (4 to a byte) saying how many of the low bytes of that word XORed with the
+// same word of iReference are stored (0, 2, 3 or 4), and then those bytes.
+// Returns false, leaving oEncoded empty, if that isn't smaller than
+// iNumBytes.  See DecodeFloatDelta.
+bool
+EncodeFloatDelta( const Util::uint8_t * iReference,
+                  const Util::uint8_t * iData,
+                  std::size_t iNumBytes,
+                  Util::uint32_t iReferenceIndex,
+                  std::vector< Util::uint8_t > & oEncoded );
 
 //-*****************************************************************************
 void
@@ -83,6 +106,8 @@ WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                    const AbcA::PropertyHeader &iHeader,
                    bool isScalarLike,
                    bool isHomogenous,
+                   bool isPacked,
+                   bool isDeltaEncoded,
                    Util::uint32_t iTimeSamplingIndex,
                    Util::uint32_t iNumSamples,
                    Util::uint32_t iFirstChangedIndex,
@@ -101,6 +126,60 @@ WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
                    Util::uint32_t  iMaxSample,
                    const AbcA::TimeSampling &iTsmp );
 
+//-*****************************************************************************
+// The rest are for appending to existing archives, iArchive is the archive as
+// it was before anything was appended to it.
+//-*****************************************************************************
+
+//-*****************************************************************************
+// Reads all of the samples of the existing packed scalar property in iGroup
+// and which stored index each of them starts being used at.
+void
+ReadPackedSamples( Ogawa::IGroupPtr iGroup,
+                   PropertyHeaderAndFriends & iHeader,
+                   std::vector< Util::uint8_t > & oData,
+                   std::vector< Util::uint32_t > & oChanges );
+
+//-*****************************************************************************
+// Reads the keys of the stored samples of the existing scalar or array
+// property in iGroup, masked the way the property writers mask them, and for
+// array properties the dimensions of those samples.  Only the keys are read
+// unless the samples were stored inline or packed without them.
+void
+ReadSampleKeys( Ogawa::IGroupPtr iGroup,
+                PropertyHeaderAndFriends & iHeader,
+                AbcA::ArraySampleKeyType iKeyType,
+                std::vector< AbcA::ArraySample::Key > & oKeys,
+                std::vector< AbcA::Dimensions > & oDims );
+
+//-*****************************************************************************
+// The hash the property writers accumulate over all of iHeader's samples from
+// the keys and dimensions (empty for scalar properties) read by
+// ReadSampleKeys.
+Util::Digest
+HashSampleKeys( PropertyHeaderAndFriends & iHeader,
+                const std::vector< AbcA::ArraySample::Key > & iKeys,
+                const std::vector< AbcA::Dimensions > & iDims );
+
+//-*****************************************************************************
+// The hash the existing property in iGroup got when it was written.
+void
+HashExistingProperty( Ogawa::IGroupPtr iGroup,
+                      PropertyHeaderAndFriends & iHeader,
+                      ArImpl & iArchive,
+                      Util::uint64_t & oHash0,
+                      Util::uint64_t & oHash1 );
+
+//-*****************************************************************************
+// The hash the existing object in iGroup got when it was written, which only
+// needs the object headers of everything underneath it.
+void
+HashExistingObject( Ogawa::IGroupPtr iGroup,
+                    const AbcA::ObjectHeader & iHeader,
+                    ArImpl & iArchive,
+                    Util::uint64_t & oHash0,
+                    Util::uint64_t & oHash1 );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreAbstract/ArraySampleKey.h>
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/WriteProfiler.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -127,9 +128,22 @@ public:
         m_map.clear();
     }
 
+    // NULL unless lookups are to be profiled
+    WriteProfilerPtr getProfiler() const
+    {
+        return m_profiler;
+    }
+
 protected:
+    void setProfiler( WriteProfilerPtr iProfiler )
+    {
+        m_profiler = iProfiler;
+    }
+
     typedef AbcA::UnorderedMapUtil<WrittenSampleIDPtr>::umap_type Map;
     Map m_map;
+
+    WriteProfilerPtr m_profiler;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -38,6 +38,7 @@
 #define Alembic_AbcGeom_All_h
 
 #include <Alembic/AbcGeom/ArchiveBounds.h>
+#include <Alembic/AbcGeom/ArraySampleMemo.h>
 
 #include <Alembic/AbcGeom/GeometryScope.h>
 
@@ -45,6 +46,7 @@
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcGeom/OCurves.h>
 #include <Alembic/AbcGeom/ICurves.h>
+#include <Alembic/AbcGeom/CurvesBatch.h>
 
 #include <Alembic/AbcGeom/OFaceSet.h>
 #include <Alembic/AbcGeom/IFaceSet.h>
@@ -78,7 +80,10 @@
 #include <Alembic/AbcGeom/XformOp.h>
 #include <Alembic/AbcGeom/XformSample.h>
 #include <Alembic/AbcGeom/OXform.h>
+#include <Alembic/AbcGeom/CompiledXformOps.h>
 #include <Alembic/AbcGeom/IXform.h>
+#include <Alembic/AbcGeom/XformHierarchy.h>
+#include <Alembic/AbcGeom/BoundsQuery.h>
 
 #include <Alembic/AbcGeom/Visibility.h>
 
@@ -35,6 +35,15 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcGeom/ArchiveBounds.h>
+#include <Alembic/AbcGeom/OXform.h>
+
+#include <ImathBoxAlgo.h>
+
+#include <map>
+
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+#include <atomic>
+#endif
 
 namespace Alembic {
 namespace AbcGeom {
@@ -61,6 +70,426 @@ Abc::OBox3dProperty CreateOArchiveBounds( OArchive & iArchive,
 
 }
 
+//-*****************************************************************************
+class OChildBoundsWriter::Data
+{
+public:
+    static const size_t kNoParent;
+
+    struct Node
+    {
+        std::string name;
+        size_t parent;
+        std::vector< size_t > children;
+
+        // only set for xforms, just what is needed to add the .childBnds
+        AbcA::CompoundPropertyWriterPtr xform;
+        std::vector< Abc::M44d > matrices;
+        std::vector< char > inherits;
+
+        std::vector< Abc::Box3d > bounds;
+
+        // that of whichever of the above this node has
+        AbcA::TimeSamplingPtr timeSampling;
+    };
+
+    Data( Abc::OArchive & iArchive, Space iSpace )
+      : archive( iArchive )
+      , space( iSpace )
+    {
+        findNode( "/" );
+    }
+
+    size_t findNode( const std::string & iFullName );
+
+    // the sample index of iNode at time iTime
+    size_t sampleIndex( size_t iNode, size_t iNumSamples,
+                        chrono_t iTime ) const;
+
+    // the matrix that takes the local space of iNode to that of the node
+    // iAncestor, or to world space for kNoParent
+    Abc::M44d relativeMatrix( size_t iNode, size_t iAncestor,
+                              chrono_t iTime ) const;
+
+    // the self bounds underneath iNode, and the node with the most samples
+    // underneath it, itself included
+    void collect( size_t iNode, std::vector< size_t > & oGeoms,
+                  size_t & ioDensest ) const;
+
+    size_t numSamples( size_t iNode ) const
+    {
+        return std::max( nodes[iNode].matrices.size(),
+                         nodes[iNode].bounds.size() );
+    }
+
+    void writeBounds( size_t iNode, Abc::OBox3dProperty & iProp,
+                      size_t iAncestor );
+
+    Abc::OArchive archive;
+    Space space;
+
+    std::vector< Node > nodes;
+    std::map< std::string, size_t > names;
+};
+
+const size_t OChildBoundsWriter::Data::kNoParent = ( size_t ) -1;
+
+namespace {
+
+//-*****************************************************************************
+// the writer collecting for each archive
+typedef std::map< const AbcA::ArchiveWriter *, OChildBoundsWriter * >
+    WriterMap;
+
+Alembic::Util::mutex g_writersMutex;
+WriterMap g_writers;
+
+//-*****************************************************************************
+// Writing a sample checks this before taking g_writersMutex, so that nothing
+// is locked when there are no writers, which is almost always.  Without
+// std::atomic we have to lock to find out.
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+std::atomic< size_t > g_numWriters( 0 );
+
+bool MaybeAnyWriters()
+{
+    return g_numWriters.load( std::memory_order_relaxed ) != 0;
+}
+#else
+size_t g_numWriters = 0;
+
+bool MaybeAnyWriters()
+{
+    return true;
+}
+#endif
+
+//-*****************************************************************************
+// needs g_writersMutex
+OChildBoundsWriter * FindWriter( const AbcA::ArchiveWriterPtr & iArchive )
+{
+    WriterMap::iterator it = g_writers.find( iArchive.get() );
+    return it == g_writers.end() ? NULL : it->second;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+size_t OChildBoundsWriter::Data::findNode( const std::string & iFullName )
+{
+    std::map< std::string, size_t >::iterator it = names.find( iFullName );
+    if ( it != names.end() )
+    {
+        return it->second;
+    }
+
+    size_t parent = kNoParent;
+    if ( iFullName != "/" )
+    {
+        size_t slash = iFullName.rfind( '/' );
+        parent = findNode( slash == 0 ? std::string( "/" ) :
+                           iFullName.substr( 0, slash ) );
+    }
+
+    size_t index = nodes.size();
+    nodes.push_back( Node() );
+    nodes[index].name = iFullName;
+    nodes[index].parent = parent;
+    if ( parent != kNoParent )
+    {
+        nodes[parent].children.push_back( index );
+    }
+
+    names[iFullName] = index;
+    return index;
+}
+
+//-*****************************************************************************
+size_t OChildBoundsWriter::Data::sampleIndex( size_t iNode,
+                                              size_t iNumSamples,
+                                              chrono_t iTime ) const
+{
+    const AbcA::TimeSamplingPtr & ts = nodes[iNode].timeSampling;
+    if ( !ts || iNumSamples < 2 )
+    {
+        return 0;
+    }
+
+    return ts->getFloorIndex( iTime, iNumSamples ).first;
+}
+
+//-*****************************************************************************
+Abc::M44d OChildBoundsWriter::Data::relativeMatrix( size_t iNode,
+                                                    size_t iAncestor,
+                                                    chrono_t iTime ) const
+{
+    Abc::M44d ret;
+    for ( size_t n = iNode; n != iAncestor && n != kNoParent;
+          n = nodes[n].parent )
+    {
+        const Node & node = nodes[n];
+        if ( node.matrices.empty() )
+        {
+            continue;
+        }
+
+        size_t index = sampleIndex( n, node.matrices.size(), iTime );
+        ret = ret * node.matrices[index];
+
+        if ( !node.inherits[index] )
+        {
+            // nothing above this applies, so ret is the world matrix
+            if ( iAncestor != kNoParent )
+            {
+                ret = ret * relativeMatrix( iAncestor, kNoParent,
+                                            iTime ).inverse();
+            }
+            break;
+        }
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+void OChildBoundsWriter::Data::collect( size_t iNode,
+                                        std::vector< size_t > & oGeoms,
+                                        size_t & ioDensest ) const
+{
+    if ( !nodes[iNode].bounds.empty() )
+    {
+        oGeoms.push_back( iNode );
+    }
+
+    if ( numSamples( iNode ) > numSamples( ioDensest ) )
+    {
+        ioDensest = iNode;
+    }
+
+    for ( size_t i = 0; i < nodes[iNode].children.size(); ++i )
+    {
+        collect( nodes[iNode].children[i], oGeoms, ioDensest );
+    }
+}
+
+//-*****************************************************************************
+void OChildBoundsWriter::Data::writeBounds( size_t iNode,
+                                            Abc::OBox3dProperty & iProp,
+                                            size_t iAncestor )
+{
+    std::vector< size_t > geoms;
+    size_t densest = iNode;
+    for ( size_t i = 0; i < nodes[iNode].children.size(); ++i )
+    {
+        collect( nodes[iNode].children[i], geoms, densest );
+    }
+
+    // in world space the bounds move with every animated xform above us too
+    if ( iAncestor == kNoParent )
+    {
+        for ( size_t n = nodes[iNode].parent; n != kNoParent;
+              n = nodes[n].parent )
+        {
+            if ( numSamples( n ) > numSamples( densest ) )
+            {
+                densest = n;
+            }
+        }
+    }
+
+    size_t numSamps = std::max( numSamples( densest ), ( size_t ) 1 );
+    const AbcA::TimeSamplingPtr & ts = nodes[densest].timeSampling;
+    if ( ts )
+    {
+        iProp.setTimeSampling( ts );
+    }
+
+    for ( size_t s = 0; s < numSamps; ++s )
+    {
+        chrono_t time = ts ? ts->getSampleTime( s ) : 0.0;
+
+        Abc::Box3d bounds;
+        for ( size_t i = 0; i < geoms.size(); ++i )
+        {
+            const Node & geom = nodes[geoms[i]];
+            const Abc::Box3d & self = geom.bounds[
+                sampleIndex( geoms[i], geom.bounds.size(), time )];
+            if ( !self.isEmpty() )
+            {
+                bounds.extendBy( Imath::transform( self,
+                    relativeMatrix( geoms[i], iAncestor, time ) ) );
+            }
+        }
+
+        iProp.set( bounds );
+    }
+}
+
+//-*****************************************************************************
+OChildBoundsWriter::OChildBoundsWriter( Abc::OArchive & iArchive,
+                                        Space iSpace )
+  : m_data( NULL )
+{
+    ABCA_ASSERT( iArchive.valid(), "Invalid archive" );
+
+    Alembic::Util::scoped_lock l( g_writersMutex );
+
+    const AbcA::ArchiveWriter * key = iArchive.getPtr().get();
+    ABCA_ASSERT( g_writers.find( key ) == g_writers.end(),
+                 "Archive " << iArchive.getName() <<
+                 " already has an OChildBoundsWriter" );
+
+    m_data = new Data( iArchive, iSpace );
+    g_writers[key] = this;
+    ++g_numWriters;
+}
+
+//-*****************************************************************************
+OChildBoundsWriter::~OChildBoundsWriter()
+{
+    try
+    {
+        close();
+    }
+    catch ( ... )
+    {
+        // nothing can be done about it here
+    }
+}
+
+//-*****************************************************************************
+void OChildBoundsWriter::close()
+{
+    if ( !m_data )
+    {
+        return;
+    }
+
+    // stop collecting first, what we write here mustn't come back to us
+    Data * data = m_data;
+    m_data = NULL;
+    {
+        Alembic::Util::scoped_lock l( g_writersMutex );
+        g_writers.erase( data->archive.getPtr().get() );
+        --g_numWriters;
+    }
+
+    try
+    {
+        for ( size_t i = 0; i < data->nodes.size(); ++i )
+        {
+            AbcA::CompoundPropertyWriterPtr xform = data->nodes[i].xform;
+            if ( !xform || xform->getPropertyHeader( ".childBnds" ) )
+            {
+                continue;
+            }
+
+            Abc::OBox3dProperty prop( xform, ".childBnds" );
+            data->writeBounds( i, prop, data->space == kLocalSpace ?
+                               i : Data::kNoParent );
+        }
+
+        Abc::OCompoundProperty top = data->archive.getTop().getProperties();
+        if ( !top.getPtr()->getPropertyHeader( ".childBnds" ) )
+        {
+            Abc::OBox3dProperty prop = CreateOArchiveBounds( data->archive );
+            data->writeBounds( 0, prop, Data::kNoParent );
+        }
+    }
+    catch ( ... )
+    {
+        delete data;
+        throw;
+    }
+
+    delete data;
+}
+
+//-*****************************************************************************
+void OChildBoundsWriter::RecordSelfBounds( Abc::OBox3dProperty & iSelfBounds,
+                                           const Abc::Box3d * iBounds )
+{
+    if ( !MaybeAnyWriters() )
+    {
+        return;
+    }
+
+    Alembic::Util::scoped_lock l( g_writersMutex );
+
+    if ( g_writers.empty() )
+    {
+        return;
+    }
+
+    OChildBoundsWriter * writer = FindWriter(
+        iSelfBounds.getPtr()->getObject()->getArchive() );
+    if ( !writer )
+    {
+        return;
+    }
+
+    Data * data = writer->m_data;
+
+    Data::Node & node = data->nodes[data->findNode(
+        iSelfBounds.getObject().getFullName() )];
+    node.timeSampling = iSelfBounds.getTimeSampling();
+    if ( iBounds )
+    {
+        node.bounds.push_back( *iBounds );
+    }
+    else
+    {
+        node.bounds.push_back( node.bounds.empty() ? Abc::Box3d() :
+                               node.bounds.back() );
+    }
+}
+
+//-*****************************************************************************
+void OChildBoundsWriter::RecordXform( const OXformSchema & iSchema,
+                                      const XformSample * iSample )
+{
+    if ( !MaybeAnyWriters() )
+    {
+        return;
+    }
+
+    Alembic::Util::scoped_lock l( g_writersMutex );
+
+    if ( g_writers.empty() )
+    {
+        return;
+    }
+
+    OChildBoundsWriter * writer = FindWriter(
+        iSchema.getPtr()->getObject()->getArchive() );
+    if ( !writer )
+    {
+        return;
+    }
+
+    Data * data = writer->m_data;
+
+    Data::Node & node = data->nodes[data->findNode(
+        iSchema.getObject().getFullName() )];
+    if ( !node.xform )
+    {
+        node.xform = iSchema.getPtr();
+    }
+    node.timeSampling = iSchema.getTimeSampling();
+    if ( iSample )
+    {
+        node.matrices.push_back( iSample->getMatrix() );
+        node.inherits.push_back( iSample->getInheritsXforms() );
+    }
+    else
+    {
+        node.matrices.push_back( node.matrices.empty() ? Abc::M44d() :
+                                 node.matrices.back() );
+        node.inherits.push_back( node.inherits.empty() ? 1 :
+                                 node.inherits.back() );
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -60,6 +60,58 @@ CreateOArchiveBounds( OArchive & iArchive,
                       const Argument &iArg1 = Argument(),
                       const Argument &iArg2 = Argument() );
 
+class OXformSchema;
+class XformSample;
+
+//-*****************************************************************************
+//! OChildBoundsWriter fills in the .childBnds of every xform in an archive
+//! being written, and the archive bounds, so readers can cull whole subtrees
+//! without descending to the leaves.
+//!
+//! While one exists for an archive, the geometric schemas hand it every self
+//! bounds sample they write and OXformSchema every matrix.  When it is
+//! closed (or destroyed, which must happen before the archive is) each xform
+//! gets the union of the self bounds of everything underneath it, in its own
+//! local space (the space its children are in) or in world space, and the
+//! top of the archive gets the world space union of all of them.
+//!
+//! Those are sampled like whatever underneath them has the most samples,
+//! each sample taking the samples of the others at or just before its time.
+//! Xforms or archives that already have a .childBnds are left alone.  Until
+//! it is closed it keeps the compound property of each xform it has seen
+//! open, to add the .childBnds to, but only its matrices are copied.
+class ALEMBIC_EXPORT OChildBoundsWriter : private Alembic::Util::noncopyable
+{
+public:
+    enum Space
+    {
+        kLocalSpace,
+        kWorldSpace
+    };
+
+    explicit OChildBoundsWriter( Abc::OArchive & iArchive,
+                                 Space iSpace = kLocalSpace );
+
+    ~OChildBoundsWriter();
+
+    //! Writes out the bounds, after which nothing else is collected.
+    void close();
+
+    //! Called by the schemas with each self bounds sample they write,
+    //! NULL when it is the same as the previous one.
+    static void RecordSelfBounds( Abc::OBox3dProperty & iSelfBounds,
+                                  const Abc::Box3d * iBounds );
+
+    //! Called by OXformSchema with each sample it writes, NULL when it is
+    //! the same as the previous one.
+    static void RecordXform( const OXformSchema & iSchema,
+                             const XformSample * iSample );
+
+private:
+    class Data;
+    Data * m_data;
+};
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -0,0 +1,131 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_ArraySampleMemo_h
+#define Alembic_AbcGeom_ArraySampleMemo_h
+
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! ArraySampleMemo remembers the last sample read from an array property, so
+//! that schemas can hand the same sample back for data that rarely changes,
+//! like the topology of a mesh whose points are animated.  A sample is only
+//! read again if its key differs from the remembered one, and keys aren't
+//! even looked at if the same sample index is asked for again.
+//!
+//! Copies start out empty, since the schema being copied into will usually
+//! read from different properties.
+template <class PROP>
+class ArraySampleMemo
+{
+public:
+    typedef typename PROP::sample_ptr_type sample_ptr_type;
+
+    ArraySampleMemo() : m_index( -1 ) {}
+
+    ArraySampleMemo( const ArraySampleMemo & ) : m_index( -1 ) {}
+
+    ArraySampleMemo & operator=( const ArraySampleMemo & )
+    {
+        reset();
+        return *this;
+    }
+
+    //! The same as iProp.get( oSample, iSS ), but sharing the remembered
+    //! sample if it is the same one.
+    void get( const PROP & iProp, sample_ptr_type & oSample,
+              const Abc::ISampleSelector & iSS )
+    {
+        AbcA::index_t index = iSS.getIndex( iProp.getTimeSampling(),
+                                            iProp.getNumSamples() );
+
+        {
+            Alembic::Util::scoped_lock l( m_mutex );
+            if ( m_sample && m_index == index )
+            {
+                oSample = m_sample;
+                return;
+            }
+        }
+
+        AbcA::ArraySampleKey key;
+        bool keyed = iProp.getKey( key, Abc::ISampleSelector( index ) );
+        if ( keyed )
+        {
+            Alembic::Util::scoped_lock l( m_mutex );
+            if ( m_sample && key == m_key )
+            {
+                m_index = index;
+                oSample = m_sample;
+                return;
+            }
+        }
+
+        iProp.get( oSample, Abc::ISampleSelector( index ) );
+
+        Alembic::Util::scoped_lock l( m_mutex );
+        m_index = index;
+        m_key = key;
+        m_sample = oSample;
+    }
+
+    void reset()
+    {
+        Alembic::Util::scoped_lock l( m_mutex );
+        m_index = -1;
+        m_key = AbcA::ArraySampleKey();
+        m_sample.reset();
+    }
+
+private:
+    Alembic::Util::mutex m_mutex;
+    AbcA::index_t m_index;
+    AbcA::ArraySampleKey m_key;
+    sample_ptr_type m_sample;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
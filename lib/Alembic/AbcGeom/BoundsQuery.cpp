@@ -0,0 +1,360 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/BoundsQuery.h>
+
+#include <ImathBoxAlgo.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// leaves with this many items or fewer aren't split any further
+const size_t kMaxLeafItems = 4;
+
+//-*****************************************************************************
+// orders items by the center of their bounds along one axis
+struct CenterLess
+{
+    const std::vector< Abc::Box3d > * bounds;
+    size_t axis;
+
+    bool operator()( size_t iA, size_t iB ) const
+    {
+        const Abc::Box3d & a = ( *bounds )[iA];
+        const Abc::Box3d & b = ( *bounds )[iB];
+        return a.min[axis] + a.max[axis] < b.min[axis] + b.max[axis];
+    }
+};
+
+//-*****************************************************************************
+struct BoxTest
+{
+    const Abc::Box3d * box;
+
+    bool operator()( const Abc::Box3d & iBounds ) const
+    {
+        return box->intersects( iBounds );
+    }
+};
+
+//-*****************************************************************************
+// bounds are outside of a plane if the corner furthest along its normal is
+struct PlanesTest
+{
+    const std::vector< Imath::V4d > * planes;
+
+    bool operator()( const Abc::Box3d & iBounds ) const
+    {
+        for ( size_t i = 0; i < planes->size(); ++i )
+        {
+            const Imath::V4d & p = ( *planes )[i];
+            double dist = p[3];
+            for ( size_t j = 0; j < 3; ++j )
+            {
+                dist += p[j] * ( p[j] > 0.0 ? iBounds.max[j] :
+                                 iBounds.min[j] );
+            }
+
+            if ( dist < 0.0 )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+IBoundsQuery::IBoundsQuery( const Abc::IObject & iTop )
+  : m_hierarchy( iTop )
+{
+    for ( size_t i = 0; i < m_hierarchy.getNumNodes(); ++i )
+    {
+        addItems( i );
+    }
+
+    m_self.resize( m_items.size() );
+    m_world.resize( m_items.size() );
+
+    evaluate( Abc::ISampleSelector() );
+    build();
+}
+
+//-*****************************************************************************
+void IBoundsQuery::addItems( size_t iNode )
+{
+    Abc::ICompoundProperty props = m_hierarchy.getObject( iNode ).
+        getProperties();
+
+    const AbcA::PropertyHeader * geomHeader =
+        props.getPropertyHeader( ".geom" );
+    if ( !geomHeader || !geomHeader->isCompound() )
+    {
+        return;
+    }
+
+    Abc::ICompoundProperty geom( props, ".geom" );
+    const AbcA::PropertyHeader * boundsHeader =
+        geom.getPropertyHeader( ".selfBnds" );
+    if ( !boundsHeader || !Abc::IBox3dProperty::matches( *boundsHeader ) )
+    {
+        return;
+    }
+
+    Item item;
+    item.node = iNode;
+    item.selfBounds = Abc::IBox3dProperty( geom, ".selfBnds" );
+    item.sampleIndex = -1;
+    m_items.push_back( item );
+}
+
+//-*****************************************************************************
+Abc::IObject IBoundsQuery::getObject( size_t iItem ) const
+{
+    ABCA_ASSERT( iItem < m_items.size(), "Invalid item: " << iItem );
+    return m_hierarchy.getObject( m_items[iItem].node );
+}
+
+//-*****************************************************************************
+const Abc::Box3d & IBoundsQuery::getWorldBounds( size_t iItem ) const
+{
+    ABCA_ASSERT( iItem < m_items.size(), "Invalid item: " << iItem );
+    return m_world[iItem];
+}
+
+//-*****************************************************************************
+Abc::Box3d IBoundsQuery::getBounds() const
+{
+    return m_tree.empty() ? Abc::Box3d() : m_tree[0].bounds;
+}
+
+//-*****************************************************************************
+void IBoundsQuery::evaluate( const Abc::ISampleSelector & iSS )
+{
+    m_hierarchy.evaluate( iSS );
+
+    bool changed = false;
+    for ( size_t i = 0; i < m_items.size(); ++i )
+    {
+        Item & item = m_items[i];
+        bool itemChanged = item.sampleIndex < 0 ||
+            m_hierarchy.hasChanged( item.node );
+
+        index_t index = iSS.getIndex( item.selfBounds.getTimeSampling(),
+                                      item.selfBounds.getNumSamples() );
+        if ( index != item.sampleIndex )
+        {
+            m_self[i] = Abc::Box3d();
+            if ( item.selfBounds.getNumSamples() > 0 )
+            {
+                m_self[i] = item.selfBounds.getValue(
+                    Abc::ISampleSelector( index ) );
+            }
+            item.sampleIndex = index;
+            itemChanged = true;
+        }
+
+        if ( !itemChanged )
+        {
+            continue;
+        }
+
+        Abc::Box3d world = m_self[i];
+        if ( !world.isEmpty() )
+        {
+            world = Imath::transform( world,
+                m_hierarchy.getWorldMatrix( item.node ) );
+        }
+
+        if ( world != m_world[i] )
+        {
+            m_world[i] = world;
+            changed = true;
+        }
+    }
+
+    if ( changed && !m_tree.empty() )
+    {
+        build();
+    }
+}
+
+//-*****************************************************************************
+void IBoundsQuery::build()
+{
+    m_order.clear();
+    m_tree.clear();
+    for ( size_t i = 0; i < m_items.size(); ++i )
+    {
+        if ( !m_world[i].isEmpty() )
+        {
+            m_order.push_back( i );
+        }
+    }
+
+    // an empty tree is a single empty leaf
+    m_tree.resize( 1 );
+    buildNode( 0, 0, m_order.size() );
+}
+
+//-*****************************************************************************
+void IBoundsQuery::buildNode( size_t iIndex, size_t iBegin, size_t iEnd )
+{
+    Abc::Box3d bounds;
+    Abc::Box3d centers;
+    for ( size_t i = iBegin; i < iEnd; ++i )
+    {
+        const Abc::Box3d & b = m_world[m_order[i]];
+        bounds.extendBy( b );
+        centers.extendBy( b.center() );
+    }
+
+    m_tree[iIndex].bounds = bounds;
+
+    if ( iEnd - iBegin <= kMaxLeafItems )
+    {
+        m_tree[iIndex].first = iBegin;
+        m_tree[iIndex].count = iEnd - iBegin;
+        return;
+    }
+
+    // split at the median center along the axis the centers spread most on
+    CenterLess less;
+    less.bounds = &m_world;
+    less.axis = centers.majorAxis();
+
+    size_t mid = iBegin + ( iEnd - iBegin ) / 2;
+    std::nth_element( m_order.begin() + iBegin, m_order.begin() + mid,
+                      m_order.begin() + iEnd, less );
+
+    size_t children = m_tree.size();
+    m_tree.resize( children + 2 );
+    m_tree[iIndex].first = children;
+    m_tree[iIndex].count = 0;
+
+    buildNode( children, iBegin, mid );
+    buildNode( children + 1, mid, iEnd );
+}
+
+//-*****************************************************************************
+template < class TEST >
+void IBoundsQuery::intersect( const TEST & iTest,
+                              std::vector< size_t > & oItems ) const
+{
+    if ( m_tree.empty() || m_tree[0].bounds.isEmpty() )
+    {
+        return;
+    }
+
+    std::vector< size_t > stack( 1, 0 );
+    while ( !stack.empty() )
+    {
+        const TreeNode & node = m_tree[stack.back()];
+        stack.pop_back();
+
+        if ( !iTest( node.bounds ) )
+        {
+            continue;
+        }
+
+        if ( node.count == 0 )
+        {
+            stack.push_back( node.first );
+            stack.push_back( node.first + 1 );
+            continue;
+        }
+
+        for ( size_t i = node.first; i < node.first + node.count; ++i )
+        {
+            if ( iTest( m_world[m_order[i]] ) )
+            {
+                oItems.push_back( m_order[i] );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void IBoundsQuery::intersect( const Abc::Box3d & iBox,
+                              std::vector< size_t > & oItems ) const
+{
+    BoxTest test;
+    test.box = &iBox;
+    intersect( test, oItems );
+}
+
+//-*****************************************************************************
+void IBoundsQuery::intersect( const std::vector< Imath::V4d > & iPlanes,
+                              std::vector< size_t > & oItems ) const
+{
+    PlanesTest test;
+    test.planes = &iPlanes;
+    intersect( test, oItems );
+}
+
+//-*****************************************************************************
+void IBoundsQuery::GetFrustumPlanes( const Abc::M44d & iWorldToClip,
+                                     std::vector< Imath::V4d > & oPlanes )
+{
+    // points are row vectors, so clip space x, y, z and w are dot products
+    // with the columns of the matrix
+    Imath::V4d cols[4];
+    for ( size_t j = 0; j < 4; ++j )
+    {
+        cols[j] = Imath::V4d( iWorldToClip[0][j], iWorldToClip[1][j],
+                            iWorldToClip[2][j], iWorldToClip[3][j] );
+    }
+
+    // w + x >= 0, w - x >= 0 and the same for y and z
+    oPlanes.clear();
+    for ( size_t j = 0; j < 3; ++j )
+    {
+        oPlanes.push_back( cols[3] + cols[j] );
+        oPlanes.push_back( cols[3] - cols[j] );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
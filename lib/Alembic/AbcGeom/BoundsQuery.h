@@ -0,0 +1,152 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_BoundsQuery_h
+#define Alembic_AbcGeom_BoundsQuery_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/XformHierarchy.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! IBoundsQuery finds the objects underneath an object (usually the top of an
+//! archive) whose world space bounds intersect a box or a frustum, without
+//! reading any geometry.  Every object with a .selfBnds property (all of the
+//! geometric schemas) is an item, with its world bounds being its self bounds
+//! transformed by its world matrix from an IXformHierarchy.
+//!
+//! The items are kept in a bounding volume hierarchy, which evaluate rebuilds
+//! only if the world bounds of an item actually changed, and self bounds
+//! are only re-read when their sample index changes, so static environments
+//! are only read once.
+//!
+//! An IBoundsQuery is not safe to evaluate from several threads at once, but
+//! the intersect calls can be.
+class ALEMBIC_EXPORT IBoundsQuery
+{
+public:
+    IBoundsQuery() {}
+
+    //! Walks iTop and everything underneath it, and evaluates it at the
+    //! default sample selector.
+    explicit IBoundsQuery( const Abc::IObject & iTop );
+
+    size_t getNumItems() const { return m_items.size(); }
+
+    Abc::IObject getObject( size_t iItem ) const;
+
+    //! Brings the world bounds of every item up to date for iSS.
+    void evaluate( const Abc::ISampleSelector & iSS );
+
+    //! The world bounds of iItem as of the last evaluate.
+    const Abc::Box3d & getWorldBounds( size_t iItem ) const;
+
+    //! The world bounds of all of the items as of the last evaluate.
+    Abc::Box3d getBounds() const;
+
+    //! Appends the items whose world bounds intersect iBox to oItems.
+    void intersect( const Abc::Box3d & iBox,
+                    std::vector< size_t > & oItems ) const;
+
+    //! Appends the items whose world bounds are at least partly on the
+    //! inside of every one of iPlanes to oItems.  A plane (a, b, c, d) has
+    //! a * x + b * y + c * z + d >= 0 on the inside, see GetFrustumPlanes.
+    void intersect( const std::vector< Imath::V4d > & iPlanes,
+                    std::vector< size_t > & oItems ) const;
+
+    //! The planes of the view frustum of iWorldToClip, the product of a
+    //! camera's inverse world matrix and its projection matrix, taking clip
+    //! space to be -w <= x, y, z <= w.
+    static void GetFrustumPlanes( const Abc::M44d & iWorldToClip,
+                                  std::vector< Imath::V4d > & oPlanes );
+
+private:
+    struct Item
+    {
+        // the node in m_hierarchy
+        size_t node;
+
+        Abc::IBox3dProperty selfBounds;
+
+        // the sample of selfBounds that m_self holds, -1 until it has been
+        // read
+        index_t sampleIndex;
+    };
+
+    // a node of the tree, the leaves have the items m_order[first, first +
+    // count) and the inner nodes have count 0 and their children at
+    // first and first + 1
+    struct TreeNode
+    {
+        Abc::Box3d bounds;
+        size_t first;
+        size_t count;
+    };
+
+    void addItems( size_t iNode );
+
+    void build();
+
+    void buildNode( size_t iIndex, size_t iBegin, size_t iEnd );
+
+    template < class TEST >
+    void intersect( const TEST & iTest, std::vector< size_t > & oItems ) const;
+
+    IXformHierarchy m_hierarchy;
+
+    std::vector< Item > m_items;
+
+    // per item
+    std::vector< Abc::Box3d > m_self;
+    std::vector< Abc::Box3d > m_world;
+
+    // the items that aren't empty, in tree order
+    std::vector< size_t > m_order;
+    std::vector< TreeNode > m_tree;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
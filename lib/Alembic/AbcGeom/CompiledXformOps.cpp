@@ -0,0 +1,253 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/CompiledXformOps.h>
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#define ABCGEOM_XFORM_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// oRow = sum of iCoeffs[k] * ioMatrix[k] over the first iNumRows rows, which
+// is a row of iCoeffMatrix * ioMatrix.
+inline void CombineRows( const double * iCoeffs, std::size_t iNumRows,
+                         const double ioMatrix[4][4], double oRow[4] )
+{
+#ifdef ABCGEOM_XFORM_SSE2
+    __m128d lo = _mm_setzero_pd();
+    __m128d hi = _mm_setzero_pd();
+    for ( std::size_t k = 0; k < iNumRows; ++k )
+    {
+        __m128d c = _mm_set1_pd( iCoeffs[k] );
+        lo = _mm_add_pd( lo, _mm_mul_pd( c, _mm_loadu_pd( ioMatrix[k] ) ) );
+        hi = _mm_add_pd( hi,
+                         _mm_mul_pd( c, _mm_loadu_pd( ioMatrix[k] + 2 ) ) );
+    }
+    _mm_storeu_pd( oRow, lo );
+    _mm_storeu_pd( oRow + 2, hi );
+#else
+    for ( std::size_t j = 0; j < 4; ++j )
+    {
+        double sum = 0.0;
+        for ( std::size_t k = 0; k < iNumRows; ++k )
+        {
+            sum += iCoeffs[k] * ioMatrix[k][j];
+        }
+        oRow[j] = sum;
+    }
+#endif
+}
+
+//-*****************************************************************************
+// ioMatrix = iRot * ioMatrix, where iRot is a rotation, so only the upper
+// left 3x3 of it is used and the last row of ioMatrix stays as it is.
+inline void Rotate( const double iRot[3][3], double ioMatrix[4][4] )
+{
+    double rows[3][4];
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        CombineRows( iRot[i], 3, ioMatrix, rows[i] );
+    }
+
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        for ( std::size_t j = 0; j < 4; ++j )
+        {
+            ioMatrix[i][j] = rows[i][j];
+        }
+    }
+}
+
+//-*****************************************************************************
+// The rotation M44d::setAxisAngle makes, iAngle is in degrees.
+void AxisAngle( const Abc::V3d & iAxis, double iAngle, double oRot[3][3] )
+{
+    Abc::V3d u = iAxis.normalized();
+    double s = std::sin( DegreesToRadians( iAngle ) );
+    double c = std::cos( DegreesToRadians( iAngle ) );
+    double t = 1.0 - c;
+
+    oRot[0][0] = u[0] * u[0] * t + c;
+    oRot[0][1] = u[0] * u[1] * t + u[2] * s;
+    oRot[0][2] = u[0] * u[2] * t - u[1] * s;
+    oRot[1][0] = u[0] * u[1] * t - u[2] * s;
+    oRot[1][1] = u[1] * u[1] * t + c;
+    oRot[1][2] = u[1] * u[2] * t + u[0] * s;
+    oRot[2][0] = u[0] * u[2] * t + u[1] * s;
+    oRot[2][1] = u[1] * u[2] * t - u[0] * s;
+    oRot[2][2] = u[2] * u[2] * t + c;
+}
+
+//-*****************************************************************************
+// The rotation about a single axis, without the normalizing and the 0s of
+// the general case.
+void SingleAxisRotate( std::size_t iAxis, double iAngle,
+                       double ioMatrix[4][4] )
+{
+    double s = std::sin( DegreesToRadians( iAngle ) );
+    double c = std::cos( DegreesToRadians( iAngle ) );
+
+    // the two rows the rotation mixes, x leaves 1 and 2, y 2 and 0 and
+    // z 0 and 1
+    std::size_t a = ( iAxis + 1 ) % 3;
+    std::size_t b = ( iAxis + 2 ) % 3;
+
+    for ( std::size_t j = 0; j < 4; ++j )
+    {
+        double ra = ioMatrix[a][j];
+        double rb = ioMatrix[b][j];
+        ioMatrix[a][j] = c * ra + s * rb;
+        ioMatrix[b][j] = c * rb - s * ra;
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+CompiledXformOps::CompiledXformOps( const XformSample & iSample )
+  : m_numChannels( 0 )
+{
+    m_ops.resize( iSample.getNumOps() );
+    for ( std::size_t i = 0; i < m_ops.size(); ++i )
+    {
+        const XformOp & op = iSample[i];
+        m_ops[i].type = op.getType();
+        m_ops[i].channel = m_numChannels;
+        m_numChannels += op.getNumChannels();
+    }
+}
+
+//-*****************************************************************************
+Abc::M44d CompiledXformOps::evaluate( const double * iChannels ) const
+{
+    Abc::M44d ret;
+    evaluate( iChannels, 0, 1, &ret );
+    return ret;
+}
+
+//-*****************************************************************************
+void CompiledXformOps::evaluate( const double * iChannels,
+                                 std::size_t iStride,
+                                 std::size_t iCount,
+                                 Abc::M44d * oMatrices ) const
+{
+    for ( std::size_t n = 0; n < iCount; ++n, iChannels += iStride )
+    {
+        double ( &m )[4][4] = oMatrices[n].x;
+        oMatrices[n].makeIdentity();
+
+        // like XformSample::getMatrix, every op is multiplied on the left
+        // of what came before it
+        for ( std::size_t i = 0; i < m_ops.size(); ++i )
+        {
+            const double * vals = iChannels + m_ops[i].channel;
+            switch ( m_ops[i].type )
+            {
+                case kScaleOperation:
+                {
+                    for ( std::size_t j = 0; j < 3; ++j )
+                    {
+                        for ( std::size_t k = 0; k < 4; ++k )
+                        {
+                            m[j][k] *= vals[j];
+                        }
+                    }
+                }
+                break;
+
+                case kTranslateOperation:
+                {
+                    double coeffs[4] = { vals[0], vals[1], vals[2], 1.0 };
+                    CombineRows( coeffs, 4, m, m[3] );
+                }
+                break;
+
+                case kRotateOperation:
+                {
+                    double rot[3][3];
+                    AxisAngle( Abc::V3d( vals[0], vals[1], vals[2] ),
+                               vals[3], rot );
+                    Rotate( rot, m );
+                }
+                break;
+
+                case kRotateXOperation:
+                    SingleAxisRotate( 0, vals[0], m );
+                break;
+
+                case kRotateYOperation:
+                    SingleAxisRotate( 1, vals[0], m );
+                break;
+
+                case kRotateZOperation:
+                    SingleAxisRotate( 2, vals[0], m );
+                break;
+
+                case kMatrixOperation:
+                {
+                    double rows[4][4];
+                    for ( std::size_t j = 0; j < 4; ++j )
+                    {
+                        CombineRows( vals + j * 4, 4, m, rows[j] );
+                    }
+
+                    for ( std::size_t j = 0; j < 4; ++j )
+                    {
+                        for ( std::size_t k = 0; k < 4; ++k )
+                        {
+                            m[j][k] = rows[j][k];
+                        }
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
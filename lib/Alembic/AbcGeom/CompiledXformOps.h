@@ -0,0 +1,98 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_CompiledXformOps_h
+#define Alembic_AbcGeom_CompiledXformOps_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/XformSample.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! CompiledXformOps is the op stack of an XformSample boiled down to what
+//! XformSample::getMatrix needs to know about it: the type of every op and
+//! where its channels start.  Matrices are then evaluated straight from
+//! channel values laid out the way the .vals property stores them (every
+//! channel of every op, in op order), without filling in XformOps, and each
+//! op is applied to the matrix built so far with a kernel that only touches
+//! the rows it changes.
+//!
+//! IXformSchema compiles its op stack once, see IXformSchema::getMatrix and
+//! IXformSchema::getMatrices.
+class ALEMBIC_EXPORT CompiledXformOps
+{
+public:
+    CompiledXformOps() : m_numChannels( 0 ) {}
+
+    //! Compiles the op stack of iSample, its channel values are ignored.
+    explicit CompiledXformOps( const XformSample & iSample );
+
+    //! How many channel values evaluate expects per matrix.
+    std::size_t getNumChannels() const { return m_numChannels; }
+
+    std::size_t getNumOps() const { return m_ops.size(); }
+
+    //! The same matrix XformSample::getMatrix gives for these channel values.
+    Abc::M44d evaluate( const double * iChannels ) const;
+
+    //! Evaluates iCount matrices, the channels of matrix i starting at
+    //! iChannels + i * iStride.
+    void evaluate( const double * iChannels, std::size_t iStride,
+                   std::size_t iCount, Abc::M44d * oMatrices ) const;
+
+private:
+    struct Op
+    {
+        XformOperationType type;
+        std::size_t channel;
+    };
+
+    std::vector< Op > m_ops;
+    std::size_t m_numChannels;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,766 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/CurvesBatch.h>
+#include <Alembic/Util/Threads.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// below this many vertices per thread, starting a thread costs more than it
+// saves
+const size_t kMinVerticesPerThread = 1 << 16;
+
+//-*****************************************************************************
+enum Pass
+{
+    kSumVertices,
+    kWriteOffsets,
+    kExpandWidths,
+    kResample,
+    kPadBounds
+};
+
+//-*****************************************************************************
+// adds the key of the sample of iProp at iSS to ioKeys, false if the sample
+// has no key, an invalid property has nothing to add
+bool AppendKey( const Abc::IArrayProperty & iProp,
+                const Abc::ISampleSelector & iSS,
+                std::vector< AbcA::ArraySampleKey > & ioKeys )
+{
+    if ( !iProp.valid() )
+    {
+        return true;
+    }
+
+    AbcA::ArraySampleKey key;
+    if ( !iProp.getKey( key, iSS ) )
+    {
+        return false;
+    }
+
+    ioKeys.push_back( key );
+    return true;
+}
+
+//-*****************************************************************************
+enum WidthsLayout
+{
+    kConstantWidths,
+    kUniformWidths,
+    kVaryingWidths
+};
+
+//-*****************************************************************************
+// what every pass reads and writes, not all of it is set for every pass
+struct Curves
+{
+    Curves()
+      : nVertices( NULL ), offsets( NULL ), positions( NULL ),
+        periodic( false ), widthsLayout( kConstantWidths ), widthVals( NULL ),
+        varyingOffsets( NULL ), widths( NULL ), resampleCount( 0 ),
+        resampledOffsets( NULL ), resampledPositions( NULL ),
+        sourceWidths( NULL ), resampledWidths( NULL ), outOffsets( NULL ),
+        outWidths( NULL ), bounds( NULL ) {}
+
+    const Alembic::Util::int32_t * nVertices;
+    uint64_t * offsets;
+    const Abc::V3f * positions;
+    bool periodic;
+
+    WidthsLayout widthsLayout;
+    const float * widthVals;
+    const uint64_t * varyingOffsets;
+    float * widths;
+
+    size_t resampleCount;
+    uint64_t * resampledOffsets;
+    Abc::V3f * resampledPositions;
+    const float * sourceWidths;
+    float * resampledWidths;
+
+    const uint64_t * outOffsets;
+    const float * outWidths;
+    Abc::Box3f * bounds;
+};
+
+//-*****************************************************************************
+// widths iVals of a curve of iNumVertices vertices, with one value for each
+// of its varying points, spread over its vertices
+void SpreadVarying( const float * iVals, size_t iNumVals, size_t iNumVertices,
+                    float * oWidths )
+{
+    if ( iNumVals == 0 )
+    {
+        std::fill( oWidths, oWidths + iNumVertices, 0.0f );
+        return;
+    }
+
+    for ( size_t j = 0; j < iNumVertices; ++j )
+    {
+        float t = iNumVertices > 1 ?
+            ( float ) j * ( iNumVals - 1 ) / ( iNumVertices - 1 ) : 0.0f;
+        size_t k = std::min( ( size_t ) t, iNumVals - 1 );
+        if ( k + 1 < iNumVals )
+        {
+            float f = t - k;
+            oWidths[j] = iVals[k] + f * ( iVals[k + 1] - iVals[k] );
+        }
+        else
+        {
+            oWidths[j] = iVals[k];
+        }
+    }
+}
+
+//-*****************************************************************************
+// curves [begin, end) for one pass, each on its own thread
+struct CurveWorker
+{
+    const Curves * curves;
+    Pass pass;
+    size_t begin;
+    size_t end;
+
+    // the number of vertices of the curves after kSumVertices, and where
+    // they start for kWriteOffsets
+    uint64_t sum;
+    bool negative;
+
+    // the length along a curve up to each of its vertices, when resampling
+    std::vector< float > lengths;
+
+    void run()
+    {
+        switch ( pass )
+        {
+            case kSumVertices: sumVertices(); break;
+            case kWriteOffsets: writeOffsets(); break;
+            case kExpandWidths: expandWidths(); break;
+            case kResample: resample(); break;
+            case kPadBounds: padBounds(); break;
+        }
+    }
+
+    void sumVertices()
+    {
+        sum = 0;
+        negative = false;
+        for ( size_t i = begin; i < end; ++i )
+        {
+            Alembic::Util::int32_t n = curves->nVertices[i];
+            negative = negative || n < 0;
+            sum += n > 0 ? n : 0;
+        }
+    }
+
+    void writeOffsets()
+    {
+        uint64_t offset = sum;
+        for ( size_t i = begin; i < end; ++i )
+        {
+            curves->offsets[i] = offset;
+            offset += std::max( curves->nVertices[i], 0 );
+        }
+
+        if ( curves->resampledOffsets )
+        {
+            for ( size_t i = begin; i < end; ++i )
+            {
+                curves->resampledOffsets[i] = i * curves->resampleCount;
+            }
+        }
+    }
+
+    void expandWidths()
+    {
+        const float * vals = curves->widthVals;
+        for ( size_t i = begin; i < end; ++i )
+        {
+            float * first = curves->widths + curves->offsets[i];
+            float * last = curves->widths + curves->offsets[i + 1];
+            switch ( curves->widthsLayout )
+            {
+                case kConstantWidths:
+                    std::fill( first, last, vals[0] );
+                break;
+                case kUniformWidths:
+                    std::fill( first, last, vals[i] );
+                break;
+                case kVaryingWidths:
+                {
+                    const uint64_t * varying = curves->varyingOffsets;
+                    SpreadVarying( vals + varying[i],
+                                   varying[i + 1] - varying[i],
+                                   last - first, first );
+                }
+                break;
+            }
+        }
+    }
+
+    void resample()
+    {
+        size_t count = curves->resampleCount;
+        for ( size_t i = begin; i < end; ++i )
+        {
+            size_t first = curves->offsets[i];
+            size_t numVertices = curves->offsets[i + 1] - first;
+            const Abc::V3f * p = curves->positions + first;
+            const float * w = curves->sourceWidths ?
+                curves->sourceWidths + first : NULL;
+            Abc::V3f * outP = curves->resampledPositions + i * count;
+            float * outW = curves->resampledWidths ?
+                curves->resampledWidths + i * count : NULL;
+
+            if ( numVertices == 0 )
+            {
+                std::fill( outP, outP + count, Abc::V3f( 0.0f, 0.0f, 0.0f ) );
+                if ( outW ) { std::fill( outW, outW + count, 0.0f ); }
+                continue;
+            }
+
+            // periodic curves come back around to their first vertex
+            size_t numSegments = numVertices - 1;
+            if ( curves->periodic && numVertices > 1 )
+            {
+                numSegments = numVertices;
+            }
+
+            lengths.resize( numSegments + 1 );
+            lengths[0] = 0.0f;
+            for ( size_t s = 0; s < numSegments; ++s )
+            {
+                lengths[s + 1] = lengths[s] +
+                    ( p[( s + 1 ) % numVertices] - p[s] ).length();
+            }
+
+            float length = lengths[numSegments];
+            size_t steps = curves->periodic ? count : count - 1;
+            size_t s = 0;
+            for ( size_t r = 0; r < count; ++r )
+            {
+                if ( numSegments == 0 )
+                {
+                    outP[r] = p[0];
+                    if ( outW ) { outW[r] = w ? w[0] : 0.0f; }
+                    continue;
+                }
+
+                float target = length * r / steps;
+                while ( s + 1 < numSegments && lengths[s + 1] < target )
+                {
+                    ++s;
+                }
+
+                float segment = lengths[s + 1] - lengths[s];
+                float f = segment > 0.0f ?
+                    std::min( ( target - lengths[s] ) / segment, 1.0f ) :
+                    0.0f;
+                size_t a = s;
+                size_t b = ( s + 1 ) % numVertices;
+                outP[r] = p[a] + f * ( p[b] - p[a] );
+                if ( outW )
+                {
+                    outW[r] = w[a] + f * ( w[b] - w[a] );
+                }
+            }
+        }
+    }
+
+    void padBounds()
+    {
+        for ( size_t i = begin; i < end; ++i )
+        {
+            Abc::Box3f & box = curves->bounds[i];
+            if ( box.isEmpty() )
+            {
+                continue;
+            }
+
+            float widest = 0.0f;
+            for ( uint64_t j = curves->outOffsets[i];
+                  j < curves->outOffsets[i + 1]; ++j )
+            {
+                widest = std::max( widest, std::abs( curves->outWidths[j] ) );
+            }
+
+            Abc::V3f pad( widest * 0.5f );
+            box.min -= pad;
+            box.max += pad;
+        }
+    }
+};
+
+//-*****************************************************************************
+// Splits iNumCurves curves with iNumVertices vertices between them over
+// workers.
+void SplitCurves( const Curves & iCurves, size_t iNumCurves,
+                  size_t iNumVertices, size_t iNumThreads,
+                  std::vector< CurveWorker > & oWorkers )
+{
+    size_t numThreads = std::min( Util::NumThreadsFor( iNumVertices,
+        kMinVerticesPerThread, iNumThreads ), std::max( iNumCurves,
+        ( size_t ) 1 ) );
+
+    oWorkers.resize( numThreads );
+    for ( size_t i = 0; i < numThreads; ++i )
+    {
+        oWorkers[i].curves = &iCurves;
+        oWorkers[i].begin = ( iNumCurves * i ) / numThreads;
+        oWorkers[i].end = ( iNumCurves * ( i + 1 ) ) / numThreads;
+        oWorkers[i].sum = 0;
+        oWorkers[i].negative = false;
+    }
+}
+
+//-*****************************************************************************
+void RunPass( Pass iPass, std::vector< CurveWorker > & ioWorkers )
+{
+    for ( size_t i = 0; i < ioWorkers.size(); ++i )
+    {
+        ioWorkers[i].pass = iPass;
+    }
+
+    Util::RunWorkers( ioWorkers );
+}
+
+//-*****************************************************************************
+// The number of varying values of a curve, one at each end of each of its
+// segments, shared by neighbouring segments.
+size_t NumVarying( size_t iNumVertices, CurveType iType,
+                   CurvePeriodicity iWrap, size_t iStep, size_t iOrder )
+{
+    if ( iType == kLinear )
+    {
+        return iNumVertices;
+    }
+
+    if ( iWrap == kPeriodic )
+    {
+        return iType == kCubic ? iNumVertices / iStep : iNumVertices;
+    }
+
+    size_t numSegments = 0;
+    if ( iNumVertices >= iOrder )
+    {
+        numSegments = iType == kCubic ? ( iNumVertices - iOrder ) / iStep + 1 :
+            iNumVertices - iOrder + 1;
+    }
+
+    return numSegments + 1;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+ICurvesBatch::ICurvesBatch( const ICurvesSchema & iSchema,
+                            size_t iResampleCount, size_t iNumThreads )
+  : m_schema( iSchema )
+  , m_numThreads( iNumThreads )
+  , m_resampleCount( 0 )
+  , m_sourceWidths( NULL )
+  , m_topologyChanged( false )
+  , m_changed( false )
+{
+    if ( m_schema.valid() &&
+         m_schema.getPropertyHeader( "curveBasisAndType" ) != NULL )
+    {
+        m_basisAndTypeProperty = Abc::IScalarProperty( m_schema,
+                                                       "curveBasisAndType" );
+    }
+
+    setResampleCount( iResampleCount );
+    load( Abc::ISampleSelector() );
+}
+
+//-*****************************************************************************
+void ICurvesBatch::setResampleCount( size_t iResampleCount )
+{
+    ABCA_ASSERT( iResampleCount != 1,
+                 "Curves can't be resampled to a single vertex" );
+
+    if ( iResampleCount != m_resampleCount )
+    {
+        m_resampleCount = iResampleCount;
+
+        // start over
+        m_offsets.clear();
+    }
+}
+
+//-*****************************************************************************
+size_t ICurvesBatch::getNumCurves() const
+{
+    return m_sample.getNumCurves();
+}
+
+//-*****************************************************************************
+size_t ICurvesBatch::getNumVertices() const
+{
+    const std::vector< uint64_t > & offsets = getVertexOffsets();
+    return offsets.empty() ? 0 : ( size_t ) offsets.back();
+}
+
+//-*****************************************************************************
+const std::vector< Alembic::Util::uint64_t > &
+ICurvesBatch::getVertexOffsets() const
+{
+    return m_resampleCount > 0 ? m_resampledOffsets : m_offsets;
+}
+
+//-*****************************************************************************
+const Abc::V3f * ICurvesBatch::getPositions() const
+{
+    if ( m_resampleCount > 0 )
+    {
+        return m_resampledPositions.empty() ? NULL : &m_resampledPositions[0];
+    }
+
+    return m_sample.getPositions() ? m_sample.getPositions()->get() : NULL;
+}
+
+//-*****************************************************************************
+const float * ICurvesBatch::getWidths() const
+{
+    if ( m_resampleCount > 0 && m_sourceWidths )
+    {
+        return m_resampledWidths.empty() ? NULL : &m_resampledWidths[0];
+    }
+
+    return m_sourceWidths;
+}
+
+//-*****************************************************************************
+void ICurvesBatch::load( const Abc::ISampleSelector & iSS )
+{
+    IFloatGeomParam widthsParam = m_schema.getWidthsParam();
+    bool hasWidths = widthsParam && widthsParam.getNumSamples() > 0;
+
+    // anything without a key is always read again
+    std::vector< AbcA::ArraySampleKey > topologyKeys;
+    std::vector< AbcA::ArraySampleKey > positionsKeys;
+    std::vector< AbcA::ArraySampleKey > widthsKeys;
+    bool keyed =
+        AppendKey( m_schema.getNumVerticesProperty(), iSS, topologyKeys ) &&
+        AppendKey( m_schema.getOrdersProperty(), iSS, topologyKeys ) &&
+        AppendKey( m_schema.getPositionsProperty(), iSS, positionsKeys );
+    if ( keyed && hasWidths )
+    {
+        keyed = AppendKey( widthsParam.getValueProperty(), iSS,
+                           widthsKeys ) &&
+            ( !widthsParam.isIndexed() ||
+              AppendKey( widthsParam.getIndexProperty(), iSS, widthsKeys ) );
+    }
+
+    Alembic::Util::uint8_t basisAndType[4] = { 0, 0, 0, 0 };
+    if ( m_basisAndTypeProperty )
+    {
+        m_basisAndTypeProperty.get( basisAndType, iSS );
+    }
+
+    m_topologyChanged = !keyed || m_offsets.empty() ||
+        topologyKeys != m_topologyKeys ||
+        memcmp( basisAndType, m_basisAndType, sizeof( basisAndType ) ) != 0;
+    bool widthsChanged = m_topologyChanged || widthsKeys != m_widthsKeys;
+    bool positionsChanged = m_topologyChanged ||
+        positionsKeys != m_positionsKeys;
+
+    m_changed = widthsChanged || positionsChanged;
+    if ( !m_changed )
+    {
+        return;
+    }
+
+    m_topologyKeys.swap( topologyKeys );
+    m_positionsKeys.swap( positionsKeys );
+    m_widthsKeys.swap( widthsKeys );
+    memcpy( m_basisAndType, basisAndType, sizeof( basisAndType ) );
+
+    m_schema.get( m_sample, iSS );
+
+    GeometryScope widthScope = kUnknownScope;
+    if ( widthsChanged )
+    {
+        m_widthVals.reset();
+        if ( hasWidths )
+        {
+            IFloatGeomParam::Sample widths;
+            widthsParam.getExpanded( widths, iSS );
+            m_widthVals = widths.getVals();
+            widthScope = widths.getScope();
+            if ( m_widthVals && m_widthVals->size() == 0 )
+            {
+                m_widthVals.reset();
+            }
+        }
+    }
+
+    if ( m_topologyChanged )
+    {
+        computeOffsets();
+    }
+
+    if ( widthsChanged )
+    {
+        expandWidths( widthScope );
+    }
+
+    if ( m_resampleCount > 0 )
+    {
+        resample();
+    }
+    computeBounds();
+}
+
+//-*****************************************************************************
+void ICurvesBatch::computeOffsets()
+{
+    size_t numCurves = m_sample.getNumCurves();
+    size_t numPositions = m_sample.getPositions() ?
+        m_sample.getPositions()->size() : 0;
+
+    m_offsets.resize( numCurves + 1 );
+    m_offsets[0] = 0;
+    m_varyingOffsets.clear();
+
+    if ( m_resampleCount > 0 )
+    {
+        m_resampledOffsets.resize( numCurves + 1 );
+        m_resampledOffsets[numCurves] = numCurves * m_resampleCount;
+    }
+    else
+    {
+        m_resampledOffsets.clear();
+    }
+
+    if ( numCurves == 0 )
+    {
+        return;
+    }
+
+    Curves curves;
+    curves.nVertices = m_sample.getCurvesNumVertices()->get();
+    curves.offsets = &m_offsets[0];
+    curves.resampleCount = m_resampleCount;
+    curves.resampledOffsets = m_resampleCount > 0 ?
+        &m_resampledOffsets[0] : NULL;
+
+    std::vector< CurveWorker > workers;
+    SplitCurves( curves, numCurves, numPositions, m_numThreads, workers );
+    RunPass( kSumVertices, workers );
+
+    // where the vertices of each worker start
+    uint64_t numVertices = 0;
+    bool negative = false;
+    for ( size_t i = 0; i < workers.size(); ++i )
+    {
+        uint64_t sum = workers[i].sum;
+        workers[i].sum = numVertices;
+        numVertices += sum;
+        negative = negative || workers[i].negative;
+    }
+
+    ABCA_ASSERT( !negative, "Curves with a negative number of vertices" );
+    ABCA_ASSERT( numVertices == numPositions,
+                 "The curves have " << numVertices << " vertices but there "
+                 "are " << numPositions << " positions" );
+
+    RunPass( kWriteOffsets, workers );
+    m_offsets[numCurves] = numVertices;
+}
+
+//-*****************************************************************************
+void ICurvesBatch::computeVaryingOffsets()
+{
+    size_t numCurves = m_sample.getNumCurves();
+    CurveType type = m_sample.getType();
+    size_t step = GetStepFromBasisType( m_sample.getBasis() );
+
+    Abc::UcharArraySamplePtr orders = m_sample.getOrders();
+    ABCA_ASSERT( type != kVariableOrder ||
+                 ( orders && orders->size() == numCurves ),
+                 "Variable order curves need an order for every curve" );
+
+    m_varyingOffsets.resize( numCurves + 1 );
+    m_varyingOffsets[0] = 0;
+    for ( size_t i = 0; i < numCurves; ++i )
+    {
+        size_t order = type == kVariableOrder ? ( *orders )[i] : 4;
+        m_varyingOffsets[i + 1] = m_varyingOffsets[i] +
+            NumVarying( m_offsets[i + 1] - m_offsets[i], type,
+                        m_sample.getWrap(), step, order );
+    }
+}
+
+//-*****************************************************************************
+void ICurvesBatch::expandWidths( GeometryScope iScope )
+{
+    m_sourceWidths = NULL;
+    if ( !m_widthVals )
+    {
+        m_expandedWidths.clear();
+        return;
+    }
+
+    size_t numCurves = m_sample.getNumCurves();
+    size_t numVertices = m_offsets.back();
+    size_t numVals = m_widthVals->size();
+
+    Curves curves;
+    curves.offsets = &m_offsets[0];
+    curves.widthVals = m_widthVals->get();
+
+    if ( numVals == 1 )
+    {
+        curves.widthsLayout = kConstantWidths;
+    }
+    else if ( iScope == kUniformScope && numVals == numCurves )
+    {
+        curves.widthsLayout = kUniformWidths;
+    }
+    else if ( numVals == numVertices )
+    {
+        // nothing to expand
+        m_sourceWidths = m_widthVals->get();
+        m_expandedWidths.clear();
+        return;
+    }
+    else if ( iScope == kVaryingScope )
+    {
+        if ( m_varyingOffsets.empty() )
+        {
+            computeVaryingOffsets();
+        }
+
+        ABCA_ASSERT( numVals == m_varyingOffsets.back(),
+                     "The curves have " << m_varyingOffsets.back() <<
+                     " varying points but there are " << numVals <<
+                     " widths" );
+        curves.widthsLayout = kVaryingWidths;
+        curves.varyingOffsets = &m_varyingOffsets[0];
+    }
+    else
+    {
+        ABCA_ASSERT( numVals == numCurves,
+                     "There are " << numVals << " widths for " <<
+                     numCurves << " curves with " << numVertices <<
+                     " vertices" );
+        curves.widthsLayout = kUniformWidths;
+    }
+
+    m_expandedWidths.resize( numVertices );
+    m_sourceWidths = m_expandedWidths.empty() ? NULL : &m_expandedWidths[0];
+    if ( numVertices == 0 )
+    {
+        return;
+    }
+
+    curves.widths = &m_expandedWidths[0];
+
+    std::vector< CurveWorker > workers;
+    SplitCurves( curves, numCurves, numVertices, m_numThreads, workers );
+    RunPass( kExpandWidths, workers );
+}
+
+//-*****************************************************************************
+void ICurvesBatch::resample()
+{
+    size_t numCurves = m_sample.getNumCurves();
+    size_t numResampled = numCurves * m_resampleCount;
+
+    m_resampledPositions.resize( numResampled );
+    m_resampledWidths.resize( m_sourceWidths ? numResampled : 0 );
+    if ( numCurves == 0 )
+    {
+        return;
+    }
+
+    Curves curves;
+    curves.offsets = &m_offsets[0];
+    curves.positions = m_sample.getPositions()->get();
+    curves.periodic = m_sample.getWrap() == kPeriodic;
+    curves.resampleCount = m_resampleCount;
+    curves.resampledPositions = &m_resampledPositions[0];
+    curves.sourceWidths = m_sourceWidths;
+    curves.resampledWidths = m_sourceWidths ? &m_resampledWidths[0] : NULL;
+
+    std::vector< CurveWorker > workers;
+    SplitCurves( curves, numCurves, m_offsets.back(), m_numThreads, workers );
+    RunPass( kResample, workers );
+}
+
+//-*****************************************************************************
+void ICurvesBatch::computeBounds()
+{
+    size_t numCurves = m_sample.getNumCurves();
+    m_bounds.resize( numCurves );
+    if ( numCurves == 0 )
+    {
+        return;
+    }
+
+    const std::vector< uint64_t > & offsets = getVertexOffsets();
+    ComputeBoundsOfRanges( getPositions(), &offsets[0], numCurves,
+                           &m_bounds[0], m_numThreads );
+
+    const float * widths = getWidths();
+    if ( !widths )
+    {
+        return;
+    }
+
+    Curves curves;
+    curves.outOffsets = &offsets[0];
+    curves.outWidths = widths;
+    curves.bounds = &m_bounds[0];
+
+    std::vector< CurveWorker > workers;
+    SplitCurves( curves, numCurves, offsets.back(), m_numThreads, workers );
+    RunPass( kPadBounds, workers );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,177 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_CurvesBatch_h
+#define Alembic_AbcGeom_CurvesBatch_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/ICurves.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! ICurvesBatch turns the samples of an ICurvesSchema into the flat arrays a
+//! renderer wants for millions of curves, like hair and fur:
+//!  - the offset of the first vertex of every curve, the running sum of the
+//!    nVertices, with one more at the end for the number of vertices,
+//!  - the bounds of every curve, grown by half of its widest width,
+//!  - the widths, expanded to one per vertex whatever their GeometryScope,
+//!  - and optionally every curve resampled to the same number of vertices,
+//!    evenly spaced along the lines between its vertices.
+//!
+//! The work is split over threads by curve, and the bounds are computed a
+//! few points at a time with SIMD instructions where they are available.
+//! Loading another sample first compares the keys of its nVertices, orders,
+//! positions and width values and indices, and its basis and type, with
+//! those of the sample loaded last.  If none of them changed, nothing is
+//! read or redone at all.  Otherwise the whole sample is read, but the
+//! offsets are only recomputed if the nVertices, orders, basis or type
+//! changed, and the widths only expanded again if they or the topology
+//! did.  Samples without keys are always treated as changed.
+//!
+//! An ICurvesBatch is not safe to load from several threads at once.
+class ALEMBIC_EXPORT ICurvesBatch
+{
+public:
+    ICurvesBatch()
+      : m_numThreads( 0 )
+      , m_resampleCount( 0 )
+      , m_sourceWidths( NULL )
+      , m_topologyChanged( false )
+      , m_changed( false ) {}
+
+    //! Loads iSchema at the default sample selector.  iResampleCount is the
+    //! number of vertices to resample every curve to, 0 for none.  The work
+    //! is split over up to iNumThreads threads, 0 picks how many from the
+    //! number of vertices and processors.
+    explicit ICurvesBatch( const ICurvesSchema & iSchema,
+                           size_t iResampleCount = 0,
+                           size_t iNumThreads = 0 );
+
+    //! Brings everything up to date for iSS.
+    void load( const Abc::ISampleSelector & iSS );
+
+    //! Changes the number of vertices every curve is resampled to, 0 for
+    //! none, as of the next load.
+    void setResampleCount( size_t iResampleCount );
+
+    size_t getResampleCount() const { return m_resampleCount; }
+
+    //! The sample of the schema as of the last load.
+    const ICurvesSchema::Sample & getSample() const { return m_sample; }
+
+    size_t getNumCurves() const;
+
+    size_t getNumVertices() const;
+
+    //! Where the vertices of each curve start, and after the last one, the
+    //! number of vertices.
+    const std::vector< Alembic::Util::uint64_t > & getVertexOffsets() const;
+
+    //! The positions of the vertices, resampled if asked to.
+    const Abc::V3f * getPositions() const;
+
+    //! One width per vertex, NULL if the curves don't have widths.
+    const float * getWidths() const;
+
+    //! The bounds of every curve.
+    const std::vector< Abc::Box3f > & getCurveBounds() const
+    { return m_bounds; }
+
+    //! Whether the last load had to work out the offsets again.
+    bool topologyChanged() const { return m_topologyChanged; }
+
+    //! Whether the last load found anything different from the one before,
+    //! going by the sample keys.  If not, it didn't read or compute anything
+    //! and everything above is just as it was.
+    bool changed() const { return m_changed; }
+
+private:
+    void computeOffsets();
+
+    void computeVaryingOffsets();
+
+    void expandWidths( GeometryScope iScope );
+
+    void resample();
+
+    void computeBounds();
+
+    ICurvesSchema m_schema;
+    Abc::IScalarProperty m_basisAndTypeProperty;
+    size_t m_numThreads;
+    size_t m_resampleCount;
+
+    ICurvesSchema::Sample m_sample;
+    Abc::FloatArraySamplePtr m_widthVals;
+
+    // the keys of what the last load read, compared to skip what is the same
+    std::vector< AbcA::ArraySampleKey > m_topologyKeys;
+    std::vector< AbcA::ArraySampleKey > m_positionsKeys;
+    std::vector< AbcA::ArraySampleKey > m_widthsKeys;
+    Alembic::Util::uint8_t m_basisAndType[4];
+
+    // running sums of the nVertices, and, only if the widths are varying, of
+    // the varying values of every curve
+    std::vector< Alembic::Util::uint64_t > m_offsets;
+    std::vector< Alembic::Util::uint64_t > m_varyingOffsets;
+
+    // one per vertex of m_sample, either m_widthVals itself or
+    // m_expandedWidths
+    const float * m_sourceWidths;
+    std::vector< float > m_expandedWidths;
+
+    std::vector< Alembic::Util::uint64_t > m_resampledOffsets;
+    std::vector< Abc::V3f > m_resampledPositions;
+    std::vector< float > m_resampledWidths;
+
+    std::vector< Abc::Box3f > m_bounds;
+
+    bool m_topologyChanged;
+    bool m_changed;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
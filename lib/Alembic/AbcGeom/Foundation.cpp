@@ -0,0 +1,581 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/Util/Threads.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#define ABCGEOM_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// below this many points per thread, starting a thread costs more than it
+// saves
+const std::size_t kMinPointsPerThread = 1 << 20;
+
+// the same for gathered elements, which are mostly a load and a store each
+const std::size_t kMinElementsPerThread = 1 << 19;
+
+//-*****************************************************************************
+// The plain min and max of points [begin, end), comparing the same way
+// Box3d::extendBy does so that NaNs are skipped.
+template < class T >
+void ExtendBounds( const T * iData, std::size_t iBegin, std::size_t iEnd,
+                   T * ioMin, T * ioMax )
+{
+    for ( std::size_t i = iBegin * 3; i < iEnd * 3; i += 3 )
+    {
+        for ( std::size_t j = 0; j < 3; ++j )
+        {
+            if ( iData[i + j] < ioMin[j] ) { ioMin[j] = iData[i + j]; }
+            if ( iData[i + j] > ioMax[j] ) { ioMax[j] = iData[i + j]; }
+        }
+    }
+}
+
+#ifdef ABCGEOM_SSE2
+//-*****************************************************************************
+// _mm_min_ps( a, b ) is a < b ? a : b, so with the new points as a a NaN
+// never replaces what we already have.
+void ExtendBoundsSIMD( const float * iData, std::size_t iBegin,
+                       std::size_t iEnd, float * ioMin, float * ioMax )
+{
+    // 4 points are 3 registers worth of floats:
+    // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+    std::size_t numBlocks = ( iEnd - iBegin ) / 4;
+    if ( numBlocks > 0 )
+    {
+        // every lane starts out with the bounds of its own axis
+        float mins[12], maxs[12];
+        for ( std::size_t i = 0; i < 12; ++i )
+        {
+            mins[i] = ioMin[i % 3];
+            maxs[i] = ioMax[i % 3];
+        }
+        __m128 min0 = _mm_loadu_ps( mins );
+        __m128 min1 = _mm_loadu_ps( mins + 4 );
+        __m128 min2 = _mm_loadu_ps( mins + 8 );
+        __m128 max0 = _mm_loadu_ps( maxs );
+        __m128 max1 = _mm_loadu_ps( maxs + 4 );
+        __m128 max2 = _mm_loadu_ps( maxs + 8 );
+
+        const float * data = iData + iBegin * 3;
+        for ( std::size_t i = 0; i < numBlocks; ++i, data += 12 )
+        {
+            __m128 v0 = _mm_loadu_ps( data );
+            __m128 v1 = _mm_loadu_ps( data + 4 );
+            __m128 v2 = _mm_loadu_ps( data + 8 );
+            min0 = _mm_min_ps( v0, min0 );
+            min1 = _mm_min_ps( v1, min1 );
+            min2 = _mm_min_ps( v2, min2 );
+            max0 = _mm_max_ps( v0, max0 );
+            max1 = _mm_max_ps( v1, max1 );
+            max2 = _mm_max_ps( v2, max2 );
+        }
+
+        _mm_storeu_ps( mins, min0 );
+        _mm_storeu_ps( mins + 4, min1 );
+        _mm_storeu_ps( mins + 8, min2 );
+        _mm_storeu_ps( maxs, max0 );
+        _mm_storeu_ps( maxs + 4, max1 );
+        _mm_storeu_ps( maxs + 8, max2 );
+
+        // lanes can't hold NaNs, so there is nothing left to skip
+        for ( std::size_t i = 0; i < 12; ++i )
+        {
+            ioMin[i % 3] = std::min( ioMin[i % 3], mins[i] );
+            ioMax[i % 3] = std::max( ioMax[i % 3], maxs[i] );
+        }
+    }
+
+    ExtendBounds( iData, iBegin + numBlocks * 4, iEnd, ioMin, ioMax );
+}
+
+//-*****************************************************************************
+void ExtendBoundsSIMD( const double * iData, std::size_t iBegin,
+                       std::size_t iEnd, double * ioMin, double * ioMax )
+{
+    // 2 points are 3 registers worth of doubles: x0 y0 | z0 x1 | y1 z1
+    std::size_t numBlocks = ( iEnd - iBegin ) / 2;
+    if ( numBlocks > 0 )
+    {
+        double mins[6], maxs[6];
+        for ( std::size_t i = 0; i < 6; ++i )
+        {
+            mins[i] = ioMin[i % 3];
+            maxs[i] = ioMax[i % 3];
+        }
+        __m128d min0 = _mm_loadu_pd( mins );
+        __m128d min1 = _mm_loadu_pd( mins + 2 );
+        __m128d min2 = _mm_loadu_pd( mins + 4 );
+        __m128d max0 = _mm_loadu_pd( maxs );
+        __m128d max1 = _mm_loadu_pd( maxs + 2 );
+        __m128d max2 = _mm_loadu_pd( maxs + 4 );
+
+        const double * data = iData + iBegin * 3;
+        for ( std::size_t i = 0; i < numBlocks; ++i, data += 6 )
+        {
+            __m128d v0 = _mm_loadu_pd( data );
+            __m128d v1 = _mm_loadu_pd( data + 2 );
+            __m128d v2 = _mm_loadu_pd( data + 4 );
+            min0 = _mm_min_pd( v0, min0 );
+            min1 = _mm_min_pd( v1, min1 );
+            min2 = _mm_min_pd( v2, min2 );
+            max0 = _mm_max_pd( v0, max0 );
+            max1 = _mm_max_pd( v1, max1 );
+            max2 = _mm_max_pd( v2, max2 );
+        }
+
+        _mm_storeu_pd( mins, min0 );
+        _mm_storeu_pd( mins + 2, min1 );
+        _mm_storeu_pd( mins + 4, min2 );
+        _mm_storeu_pd( maxs, max0 );
+        _mm_storeu_pd( maxs + 2, max1 );
+        _mm_storeu_pd( maxs + 4, max2 );
+
+        for ( std::size_t i = 0; i < 6; ++i )
+        {
+            ioMin[i % 3] = std::min( ioMin[i % 3], mins[i] );
+            ioMax[i % 3] = std::max( ioMax[i % 3], maxs[i] );
+        }
+    }
+
+    ExtendBounds( iData, iBegin + numBlocks * 2, iEnd, ioMin, ioMax );
+}
+#else
+//-*****************************************************************************
+template < class T >
+void ExtendBoundsSIMD( const T * iData, std::size_t iBegin, std::size_t iEnd,
+                       T * ioMin, T * ioMax )
+{
+    ExtendBounds( iData, iBegin, iEnd, ioMin, ioMax );
+}
+#endif
+
+//-*****************************************************************************
+// the bounds of points [begin, end), each on its own thread
+template < class T >
+struct BoundsComputer
+{
+    const T * data;
+    std::size_t begin;
+    std::size_t end;
+    T min[3];
+    T max[3];
+
+    void run()
+    {
+        for ( std::size_t i = 0; i < 3; ++i )
+        {
+            min[i] = std::numeric_limits< T >::infinity();
+            max[i] = -std::numeric_limits< T >::infinity();
+        }
+        ExtendBoundsSIMD( data, begin, end, min, max );
+    }
+};
+
+//-*****************************************************************************
+// the bounds of each of the runs [begin, end), each on its own thread
+struct RangeBoundsComputer
+{
+    const float * data;
+    const Alembic::Util::uint64_t * offsets;
+    std::size_t begin;
+    std::size_t end;
+    Abc::Box3f * bounds;
+
+    void run()
+    {
+        for ( std::size_t i = begin; i < end; ++i )
+        {
+            Abc::Box3f & box = bounds[i];
+            box.makeEmpty();
+            ExtendBoundsSIMD( data, ( std::size_t ) offsets[i],
+                              ( std::size_t ) offsets[i + 1],
+                              &( box.min.x ), &( box.max.x ) );
+        }
+    }
+};
+
+//-*****************************************************************************
+template < class T >
+Abc::Box3d ComputeBounds( const T * iData, std::size_t iNumPoints,
+                          std::size_t iNumThreads )
+{
+    std::size_t numThreads = Util::NumThreadsFor( iNumPoints,
+                                                  kMinPointsPerThread,
+                                                  iNumThreads );
+
+    std::vector< BoundsComputer< T > > computers( numThreads );
+    for ( std::size_t i = 0; i < numThreads; ++i )
+    {
+        computers[i].data = iData;
+        computers[i].begin = ( iNumPoints * i ) / numThreads;
+        computers[i].end = ( iNumPoints * ( i + 1 ) ) / numThreads;
+    }
+
+    Util::RunWorkers( computers );
+
+    // an axis of a range with nothing but NaNs on it never got any bounds,
+    // just like it wouldn't have with Box3d::extendBy
+    Abc::Box3d ret;
+    for ( std::size_t i = 0; i < numThreads; ++i )
+    {
+        for ( std::size_t j = 0; j < 3; ++j )
+        {
+            if ( computers[i].min[j] <= computers[i].max[j] )
+            {
+                ret.min[j] = std::min( ret.min[j],
+                                       ( double ) computers[i].min[j] );
+                ret.max[j] = std::max( ret.max[j],
+                                       ( double ) computers[i].max[j] );
+            }
+        }
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+// Copying elements as a fixed size struct lets the compiler move each one
+// with a couple of (vector) loads and stores instead of calling memcpy.
+template < std::size_t N >
+struct Element
+{
+    Alembic::Util::uint8_t bytes[N];
+};
+
+template < std::size_t N >
+void GatherElements( const void * iVals,
+                     const Alembic::Util::uint32_t * iIndices,
+                     std::size_t iBegin, std::size_t iEnd, void * oData )
+{
+    const Element< N > * vals = static_cast< const Element< N > * >( iVals );
+    Element< N > * data = static_cast< Element< N > * >( oData );
+    for ( std::size_t i = iBegin; i < iEnd; ++i )
+    {
+        data[i] = vals[iIndices[i]];
+    }
+}
+
+//-*****************************************************************************
+// elements [begin, end) of a gather, each on its own thread
+struct Gatherer
+{
+    const void * vals;
+    std::size_t elementBytes;
+    const Alembic::Util::uint32_t * indices;
+    std::size_t begin;
+    std::size_t end;
+    void * data;
+
+    void run()
+    {
+        switch ( elementBytes )
+        {
+            case 4: GatherElements< 4 >( vals, indices, begin, end, data );
+            break;
+            case 8: GatherElements< 8 >( vals, indices, begin, end, data );
+            break;
+            case 12: GatherElements< 12 >( vals, indices, begin, end, data );
+            break;
+            case 16: GatherElements< 16 >( vals, indices, begin, end, data );
+            break;
+            case 24: GatherElements< 24 >( vals, indices, begin, end, data );
+            break;
+            default:
+            {
+                const char * src = static_cast< const char * >( vals );
+                char * dst = static_cast< char * >( data );
+                for ( std::size_t i = begin; i < end; ++i )
+                {
+                    memcpy( dst + i * elementBytes,
+                            src + indices[i] * elementBytes, elementBytes );
+                }
+            }
+            break;
+        }
+    }
+};
+
+//-*****************************************************************************
+// A new positions or velocities sample of iSize points.
+template < class SAMP >
+Alembic::Util::shared_ptr< SAMP > AllocateVectors( std::size_t iSize,
+                                                   float *& oData )
+{
+    Abc::V3f * data = new Abc::V3f[iSize];
+    oData = &( data->x );
+    return Alembic::Util::shared_ptr< SAMP >(
+        new SAMP( data, Alembic::Util::Dimensions( iSize ) ),
+        AbcA::TArrayDeleter< Abc::V3f >() );
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+Abc::Box3d ComputeBoundsFromPositions( const Abc::V3f * iPositions,
+                                       std::size_t iNumPoints,
+                                       std::size_t iNumThreads )
+{
+    if ( iNumPoints == 0 || !iPositions )
+    {
+        return Abc::Box3d();
+    }
+
+    return ComputeBounds( &( iPositions->x ), iNumPoints, iNumThreads );
+}
+
+//-*****************************************************************************
+Abc::Box3d ComputeBoundsFromPositions( const Abc::V3d * iPositions,
+                                       std::size_t iNumPoints,
+                                       std::size_t iNumThreads )
+{
+    if ( iNumPoints == 0 || !iPositions )
+    {
+        return Abc::Box3d();
+    }
+
+    return ComputeBounds( &( iPositions->x ), iNumPoints, iNumThreads );
+}
+
+//-*****************************************************************************
+void ComputeBoundsOfRanges( const Abc::V3f * iPositions,
+                            const Alembic::Util::uint64_t * iOffsets,
+                            std::size_t iNumRanges, Abc::Box3f * oBounds,
+                            std::size_t iNumThreads )
+{
+    if ( iNumRanges == 0 )
+    {
+        return;
+    }
+
+    // split by points, as runs can be of any length
+    std::size_t numPoints = iOffsets[iNumRanges] - iOffsets[0];
+    std::size_t numThreads = std::min( Util::NumThreadsFor( numPoints,
+        kMinPointsPerThread, iNumThreads ), iNumRanges );
+
+    std::vector< RangeBoundsComputer > computers( numThreads );
+    for ( std::size_t i = 0; i < numThreads; ++i )
+    {
+        computers[i].data = reinterpret_cast< const float * >( iPositions );
+        computers[i].offsets = iOffsets;
+        computers[i].begin = ( iNumRanges * i ) / numThreads;
+        computers[i].end = ( iNumRanges * ( i + 1 ) ) / numThreads;
+        computers[i].bounds = oBounds;
+    }
+
+    Util::RunWorkers( computers );
+}
+
+//-*****************************************************************************
+void GatherIndexed( const void * iVals, std::size_t iElementBytes,
+                    const Alembic::Util::uint32_t * iIndices,
+                    std::size_t iNumIndices, void * oData,
+                    std::size_t iNumThreads )
+{
+    if ( iNumIndices == 0 )
+    {
+        return;
+    }
+
+    std::size_t numThreads = Util::NumThreadsFor( iNumIndices,
+                                                  kMinElementsPerThread,
+                                                  iNumThreads );
+
+    std::vector< Gatherer > gatherers( numThreads );
+    for ( std::size_t i = 0; i < numThreads; ++i )
+    {
+        gatherers[i].vals = iVals;
+        gatherers[i].elementBytes = iElementBytes;
+        gatherers[i].indices = iIndices;
+        gatherers[i].begin = ( iNumIndices * i ) / numThreads;
+        gatherers[i].end = ( iNumIndices * ( i + 1 ) ) / numThreads;
+        gatherers[i].data = oData;
+    }
+
+    Util::RunWorkers( gatherers );
+}
+
+//-*****************************************************************************
+void LerpFloats( const float * iA, const float * iB, float iT,
+                 std::size_t iNumFloats, float * oData )
+{
+    std::size_t i = 0;
+#ifdef ABCGEOM_SSE2
+    __m128 t = _mm_set1_ps( iT );
+    for ( ; i + 4 <= iNumFloats; i += 4 )
+    {
+        __m128 a = _mm_loadu_ps( iA + i );
+        __m128 b = _mm_loadu_ps( iB + i );
+        _mm_storeu_ps( oData + i,
+            _mm_add_ps( a, _mm_mul_ps( t, _mm_sub_ps( b, a ) ) ) );
+    }
+#endif
+    for ( ; i < iNumFloats; ++i )
+    {
+        oData[i] = iA[i] + iT * ( iB[i] - iA[i] );
+    }
+}
+
+//-*****************************************************************************
+void MulAddFloats( const float * iA, const float * iB, float iScale,
+                   std::size_t iNumFloats, float * oData )
+{
+    std::size_t i = 0;
+#ifdef ABCGEOM_SSE2
+    __m128 scale = _mm_set1_ps( iScale );
+    for ( ; i + 4 <= iNumFloats; i += 4 )
+    {
+        _mm_storeu_ps( oData + i,
+            _mm_add_ps( _mm_loadu_ps( iA + i ),
+                        _mm_mul_ps( scale, _mm_loadu_ps( iB + i ) ) ) );
+    }
+#endif
+    for ( ; i < iNumFloats; ++i )
+    {
+        oData[i] = iA[i] + iScale * iB[i];
+    }
+}
+
+//-*****************************************************************************
+void InterpolatePositions( const Abc::IP3fArrayProperty & iPositions,
+                           const Abc::IV3fArrayProperty & iVelocities,
+                           chrono_t iTime,
+                           Abc::P3fArraySamplePtr & ioPositions,
+                           Abc::V3fArraySamplePtr & ioVelocities )
+{
+    AbcA::index_t numSamples = iPositions.getNumSamples();
+    if ( numSamples == 0 )
+    {
+        return;
+    }
+
+    AbcA::TimeSamplingPtr ts = iPositions.getTimeSampling();
+    std::pair< AbcA::index_t, chrono_t > floorIndex =
+        ts->getFloorIndex( iTime, numSamples );
+    std::pair< AbcA::index_t, chrono_t > ceilIndex =
+        ts->getCeilIndex( iTime, numSamples );
+
+    if ( !ioPositions )
+    {
+        iPositions.get( ioPositions, floorIndex.first );
+    }
+
+    std::size_t numPoints = ioPositions->size();
+    if ( numPoints == 0 )
+    {
+        return;
+    }
+
+    bool hasVelocities = ioVelocities && ioVelocities->size() == numPoints;
+
+    if ( floorIndex.first != ceilIndex.first &&
+         ceilIndex.second > floorIndex.second )
+    {
+        // the same data on both sides doesn't need blending
+        AbcA::ArraySampleKey floorKey;
+        AbcA::ArraySampleKey ceilKey;
+        if ( iPositions.getKey( floorKey, floorIndex.first ) &&
+             iPositions.getKey( ceilKey, ceilIndex.first ) &&
+             floorKey == ceilKey )
+        {
+            return;
+        }
+
+        Abc::P3fArraySamplePtr ceilPositions;
+        iPositions.get( ceilPositions, ceilIndex.first );
+
+        if ( ceilPositions->size() == numPoints )
+        {
+            float t = ( float )( ( iTime - floorIndex.second ) /
+                                 ( ceilIndex.second - floorIndex.second ) );
+
+            float * data = NULL;
+            Abc::P3fArraySamplePtr positions =
+                AllocateVectors< Abc::P3fArraySample >( numPoints, data );
+            LerpFloats( &( ioPositions->get()->x ),
+                        &( ceilPositions->get()->x ), t, numPoints * 3,
+                        data );
+            ioPositions = positions;
+
+            Abc::V3fArraySamplePtr ceilVelocities;
+            if ( hasVelocities )
+            {
+                iVelocities.get( ceilVelocities, ceilIndex.first );
+            }
+
+            if ( ceilVelocities && ceilVelocities->size() == numPoints )
+            {
+                Abc::V3fArraySamplePtr velocities =
+                    AllocateVectors< Abc::V3fArraySample >( numPoints, data );
+                LerpFloats( &( ioVelocities->get()->x ),
+                            &( ceilVelocities->get()->x ), t, numPoints * 3,
+                            data );
+                ioVelocities = velocities;
+            }
+            return;
+        }
+    }
+
+    // the point counts differ, or there is nothing to blend with
+    if ( hasVelocities && iTime != floorIndex.second )
+    {
+        float * data = NULL;
+        Abc::P3fArraySamplePtr positions =
+            AllocateVectors< Abc::P3fArraySample >( numPoints, data );
+        MulAddFloats( &( ioPositions->get()->x ), &( ioVelocities->get()->x ),
+                      ( float )( iTime - floorIndex.second ), numPoints * 3,
+                      data );
+        ioPositions = positions;
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -37,6 +37,7 @@
 #ifndef Alembic_AbcGeom_Foundation_h
 #define Alembic_AbcGeom_Foundation_h
 
+#include <Alembic/Util/Export.h>
 #include <Alembic/Abc/All.h>
 
 #include <ImathMatrixAlgo.h>
@@ -105,6 +106,18 @@ inline void SetPropUsePrevIfNull( PROP iProp, SAMP iSamp )
     }
 }
 
+//-*****************************************************************************
+//! As above, but iOwned, which is either NULL or the sample iSamp was set
+//! from, is handed to the property instead of iSamp when both are set, so
+//! the archive can keep it rather than copy it.
+template <class PROP, class SAMP, class SAMP_PTR>
+inline void SetPropUsePrevIfNull( PROP iProp, const SAMP &iSamp,
+                                  const SAMP_PTR &iOwned )
+{
+    if ( iProp && iOwned && iSamp ) { iProp.set( iOwned ); }
+    else { SetPropUsePrevIfNull( iProp, iSamp ); }
+}
+
 template <>
 inline void SetPropUsePrevIfNull<Abc::OStringProperty, std::string>(
     Abc::OStringProperty iProp, std::string iSamp )
@@ -132,22 +145,99 @@ inline void SetPropUsePrevIfNull<Abc::OBox3dProperty, Abc::Box3d>(
     else { iProp.setFromPrevious(); }
 }
 
+//-*****************************************************************************
+//! These utility functions compute an axis-aligned bounding box from
+//! iNumPoints positions, a few at a time with SIMD instructions where they
+//! are available.  Large arrays of positions are split up over up to
+//! iNumThreads threads, 0 picks how many from the number of points and
+//! processors.  Like Box3d::extendBy, NaNs are ignored.
+ALEMBIC_EXPORT Abc::Box3d
+ComputeBoundsFromPositions( const Abc::V3f * iPositions,
+                            std::size_t iNumPoints,
+                            std::size_t iNumThreads = 0 );
+
+ALEMBIC_EXPORT Abc::Box3d
+ComputeBoundsFromPositions( const Abc::V3d * iPositions,
+                            std::size_t iNumPoints,
+                            std::size_t iNumThreads = 0 );
+
+//! The bounds of each of iNumRanges runs of iPositions, run i being points
+//! iOffsets[i] up to iOffsets[i + 1], into oBounds[i].  Empty runs get empty
+//! bounds.  The runs are split over up to iNumThreads threads the same way.
+ALEMBIC_EXPORT void
+ComputeBoundsOfRanges( const Abc::V3f * iPositions,
+                       const Alembic::Util::uint64_t * iOffsets,
+                       std::size_t iNumRanges, Abc::Box3f * oBounds,
+                       std::size_t iNumThreads = 0 );
+
+//! As above, for positions of any other type, one point at a time.
+template <class T>
+Abc::Box3d ComputeBoundsFromPositions( const T * iPositions,
+                                       std::size_t iNumPoints,
+                                       std::size_t /* iNumThreads */ = 0 )
+{
+    Abc::Box3d ret;
+    for ( size_t i = 0 ; i < iNumPoints ; ++i )
+    {
+        ret.extendBy( iPositions[i] );
+    }
+
+    return ret;
+}
+
 //-*****************************************************************************
 //! This utility function computes an axis-aligned bounding box from a
 //! positions sample
 template <class ARRAYSAMP>
 static Abc::Box3d ComputeBoundsFromPositions( const ARRAYSAMP &iSamp )
 {
-    Abc::Box3d ret;
     size_t size = iSamp.size();
-    for ( size_t i = 0 ; i < size ; ++i )
+    if ( size == 0 )
     {
-        ret.extendBy( iSamp[i] );
+        return Abc::Box3d();
     }
 
-    return ret;
+    return ComputeBoundsFromPositions( &iSamp[0], size );
 }
 
+//-*****************************************************************************
+//! oData[i] = iVals[iIndices[i]] for each of the iNumIndices indices, where
+//! the elements are iElementBytes bytes of plain old data each.  Big gathers
+//! are split over up to iNumThreads threads, 0 picks how many from the number
+//! of indices and processors.  The indices aren't checked.
+ALEMBIC_EXPORT void
+GatherIndexed( const void * iVals, std::size_t iElementBytes,
+               const Alembic::Util::uint32_t * iIndices,
+               std::size_t iNumIndices, void * oData,
+               std::size_t iNumThreads = 0 );
+
+//-*****************************************************************************
+//! oData[i] = iA[i] + iT * ( iB[i] - iA[i] ) for iNumFloats floats.
+ALEMBIC_EXPORT void
+LerpFloats( const float * iA, const float * iB, float iT,
+            std::size_t iNumFloats, float * oData );
+
+//! oData[i] = iA[i] + iScale * iB[i] for iNumFloats floats.
+ALEMBIC_EXPORT void
+MulAddFloats( const float * iA, const float * iB, float iScale,
+              std::size_t iNumFloats, float * oData );
+
+//-*****************************************************************************
+//! Replaces ioPositions and ioVelocities, the samples of iPositions and
+//! iVelocities at the floor index of iTime, with what they are at iTime.
+//! Between two samples with as many points as each other the positions, and
+//! the velocities if there are as many of those, are blended linearly.  If
+//! the point counts differ, or iTime is before the first or after the last
+//! sample, the positions are moved along the velocities instead, which are
+//! taken to be in units per second (per unit of chrono_t).  Without usable
+//! velocities ioPositions is left as it is.
+ALEMBIC_EXPORT void
+InterpolatePositions( const Abc::IP3fArrayProperty & iPositions,
+                      const Abc::IV3fArrayProperty & iVelocities,
+                      chrono_t iTime,
+                      Abc::P3fArraySamplePtr & ioPositions,
+                      Abc::V3fArraySamplePtr & ioVelocities );
+
 //-*****************************************************************************
 //! used in xform rotation conversion
 inline double DegreesToRadians( double iDegrees )
@@ -148,7 +148,9 @@ void ICurvesSchema::get( ICurvesSchema::Sample &oSample,
     if ( ! valid() ) { return; }
 
     m_positionsProperty.get( oSample.m_positions, iSS );
-    m_nVerticesProperty.get( oSample.m_nVertices, iSS );
+
+    // the topology of homogenous curves is shared across samples
+    m_nVerticesMemo.get( m_nVerticesProperty, oSample.m_nVertices, iSS );
 
     Alembic::Util::uint8_t basisAndType[4];
     m_basisAndTypeProperty.get( basisAndType, iSS );
@@ -165,12 +167,12 @@ void ICurvesSchema::get( ICurvesSchema::Sample &oSample,
 
     if ( m_ordersProperty )
     {
-        m_ordersProperty.get( oSample.m_orders, iSS );
+        m_ordersMemo.get( m_ordersProperty, oSample.m_orders, iSS );
     }
 
     if ( m_knotsProperty )
     {
-        m_knotsProperty.get( oSample.m_knots, iSS );
+        m_knotsMemo.get( m_knotsProperty, oSample.m_knots, iSS );
     }
 
     if ( m_selfBoundsProperty )
@@ -186,6 +188,22 @@ void ICurvesSchema::get( ICurvesSchema::Sample &oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void ICurvesSchema::getInterpolated( ICurvesSchema::Sample &oSample,
+                                     chrono_t iTime ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ICurvesSchema::getInterpolated()" );
+
+    oSample.reset();
+    get( oSample, Abc::ISampleSelector( iTime,
+                                        Abc::ISampleSelector::kFloorIndex ) );
+
+    InterpolatePositions( m_positionsProperty, m_velocitiesProperty, iTime,
+                          oSample.m_positions, oSample.m_velocities );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -42,6 +42,7 @@
 #include <Alembic/AbcGeom/Basis.h>
 #include <Alembic/AbcGeom/CurveType.h>
 #include <Alembic/AbcGeom/SchemaInfoDeclarations.h>
+#include <Alembic/AbcGeom/ArraySampleMemo.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
 
@@ -214,6 +215,11 @@ public:
         return smp;
     }
 
+    //! The sample at iTime, which needn't be one of the sampled times.
+    //! Everything but the positions and velocities is that of the sample at
+    //! or before iTime, see InterpolatePositions for those.
+    void getInterpolated( sample_type &oSample, chrono_t iTime ) const;
+
     Abc::IV3fArrayProperty getVelocitiesProperty() const
     {
         return m_velocitiesProperty;
@@ -277,6 +283,9 @@ public:
         m_positionWeightsProperty.reset();
         m_ordersProperty.reset();
         m_knotsProperty.reset();
+        m_nVerticesMemo.reset();
+        m_ordersMemo.reset();
+        m_knotsMemo.reset();
 
         m_uvsParam.reset();
         m_normalsParam.reset();
@@ -317,6 +326,10 @@ protected:
     Abc::IFloatArrayProperty m_positionWeightsProperty;
     Abc::IUcharArrayProperty m_ordersProperty;
     Abc::IFloatArrayProperty m_knotsProperty;
+
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_nVerticesMemo;
+    mutable ArraySampleMemo<Abc::IUcharArrayProperty> m_ordersMemo;
+    mutable ArraySampleMemo<Abc::IFloatArrayProperty> m_knotsMemo;
 };
 
 //-*****************************************************************************
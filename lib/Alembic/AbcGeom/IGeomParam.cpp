@@ -0,0 +1,217 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/IGeomParam.h>
+
+#include <algorithm>
+#include <map>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+struct ExpandedKey
+{
+    // type_info can't be copied, and the same type may have more than one
+    // type_info across shared libraries so they're compared, not the pointers
+    const std::type_info * traits;
+    AbcA::ArraySampleKey valsKey;
+    AbcA::ArraySampleKey indicesKey;
+
+    bool operator<( const ExpandedKey & iRhs ) const
+    {
+        if ( *traits != *iRhs.traits )
+        {
+            return traits->before( *iRhs.traits );
+        }
+
+        if ( valsKey != iRhs.valsKey )
+        {
+            return valsKey < iRhs.valsKey;
+        }
+
+        return indicesKey < iRhs.indicesKey;
+    }
+};
+
+typedef Alembic::Util::weak_ptr< AbcA::ArraySample > WeakSamplePtr;
+typedef std::map< Alembic::Util::uint32_t, WeakSamplePtr > IdentityMap;
+typedef std::map< ExpandedKey, WeakSamplePtr > ExpandedMap;
+
+//-*****************************************************************************
+// Both maps only hold on to samples weakly, entries whose samples are gone
+// are swept out whenever a map has doubled in size since the last sweep.
+template < class MAP >
+struct SampleCache
+{
+    SampleCache() : sweepSize( 16 ) {}
+
+    Alembic::Util::mutex lock;
+    MAP samples;
+    std::size_t sweepSize;
+
+    void sweep()
+    {
+        if ( samples.size() < sweepSize )
+        {
+            return;
+        }
+
+        typename MAP::iterator it = samples.begin();
+        while ( it != samples.end() )
+        {
+            if ( it->second.expired() )
+            {
+                samples.erase( it++ );
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        sweepSize = std::max( samples.size() * 2, ( std::size_t ) 16 );
+    }
+};
+
+//-*****************************************************************************
+// Constructed on first use so that these are around for GeomParams read while
+// other statics are being constructed or destroyed.
+SampleCache< IdentityMap > & GetIdentityCache()
+{
+    static SampleCache< IdentityMap > * cache =
+        new SampleCache< IdentityMap >();
+    return *cache;
+}
+
+SampleCache< ExpandedMap > & GetExpandedCache()
+{
+    static SampleCache< ExpandedMap > * cache =
+        new SampleCache< ExpandedMap >();
+    return *cache;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+Abc::UInt32ArraySamplePtr
+GetIdentityIndices( Alembic::Util::uint32_t iSize )
+{
+    SampleCache< IdentityMap > & cache = GetIdentityCache();
+    Alembic::Util::scoped_lock l( cache.lock );
+
+    Abc::UInt32ArraySamplePtr ret =
+        Alembic::Util::static_pointer_cast< Abc::UInt32ArraySample >(
+            cache.samples[iSize].lock() );
+
+    if ( ret )
+    {
+        return ret;
+    }
+
+    Alembic::Util::uint32_t *v = new Alembic::Util::uint32_t[iSize];
+
+    for ( Alembic::Util::uint32_t i = 0 ; i < iSize ; ++i )
+    {
+        v[i] = i;
+    }
+
+    const Alembic::Util::Dimensions dims( iSize );
+
+    ret.reset( new Abc::UInt32ArraySample( v, dims ),
+               AbcA::TArrayDeleter<Alembic::Util::uint32_t>() );
+
+    cache.sweep();
+    cache.samples[iSize] = ret;
+    return ret;
+}
+
+//-*****************************************************************************
+AbcA::ArraySamplePtr
+FindExpandedSample( const std::type_info & iTraits,
+                    const AbcA::ArraySampleKey & iValsKey,
+                    const AbcA::ArraySampleKey & iIndicesKey )
+{
+    ExpandedKey key;
+    key.traits = &iTraits;
+    key.valsKey = iValsKey;
+    key.indicesKey = iIndicesKey;
+
+    SampleCache< ExpandedMap > & cache = GetExpandedCache();
+    Alembic::Util::scoped_lock l( cache.lock );
+
+    ExpandedMap::iterator it = cache.samples.find( key );
+    if ( it == cache.samples.end() )
+    {
+        return AbcA::ArraySamplePtr();
+    }
+
+    return it->second.lock();
+}
+
+//-*****************************************************************************
+AbcA::ArraySamplePtr
+AddExpandedSample( const std::type_info & iTraits,
+                   const AbcA::ArraySampleKey & iValsKey,
+                   const AbcA::ArraySampleKey & iIndicesKey,
+                   AbcA::ArraySamplePtr iSample )
+{
+    ExpandedKey key;
+    key.traits = &iTraits;
+    key.valsKey = iValsKey;
+    key.indicesKey = iIndicesKey;
+
+    SampleCache< ExpandedMap > & cache = GetExpandedCache();
+    Alembic::Util::scoped_lock l( cache.lock );
+
+    WeakSamplePtr & entry = cache.samples[key];
+    AbcA::ArraySamplePtr existing = entry.lock();
+    if ( existing )
+    {
+        return existing;
+    }
+
+    entry = iSample;
+    cache.sweep();
+    return iSample;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
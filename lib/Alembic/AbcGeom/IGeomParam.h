@@ -40,10 +40,43 @@
 #include <Alembic/AbcGeom/Foundation.h>
 #include <Alembic/AbcGeom/GeometryScope.h>
 
+#include <typeinfo>
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+//! The indices 0 to iSize - 1, which getIndexed hands back for GeomParams that
+//! have no indices.  There is only ever one such buffer of any size alive,
+//! shared by everything holding on to it.
+ALEMBIC_EXPORT Abc::UInt32ArraySamplePtr
+GetIdentityIndices( Alembic::Util::uint32_t iSize );
+
+//-*****************************************************************************
+//! Expanded GeomParam samples are shared the same way, keyed on the traits
+//! type of the GeomParam and the keys of its values and indices so that
+//! expanding the same data again just hands back the same sample.  The traits
+//! type, rather than its data type and interpretation which several traits
+//! can have in common, makes sure the sample is a TypedArraySample of the
+//! traits it is looked up for.
+//! Like the identity indices, samples are only kept for as long as somebody
+//! holds on to them.
+//!
+//! FindExpandedSample returns NULL if there is no such sample alive.
+ALEMBIC_EXPORT AbcA::ArraySamplePtr
+FindExpandedSample( const std::type_info & iTraits,
+                    const AbcA::ArraySampleKey & iValsKey,
+                    const AbcA::ArraySampleKey & iIndicesKey );
+
+//! Shares iSample, unless somebody else already shared a sample with the
+//! same keys in the meantime, in which case that is returned instead.
+ALEMBIC_EXPORT AbcA::ArraySamplePtr
+AddExpandedSample( const std::type_info & iTraits,
+                   const AbcA::ArraySampleKey & iValsKey,
+                   const AbcA::ArraySampleKey & iIndicesKey,
+                   AbcA::ArraySamplePtr iSample );
+
 //-*****************************************************************************
 template <class TRAITS>
 class ITypedGeomParam
@@ -326,19 +359,8 @@ ITypedGeomParam<TRAITS>::getIndexed( typename ITypedGeomParam<TRAITS>::Sample &o
     if ( m_indicesProperty ) { m_indicesProperty.get( oSamp.m_indices, iSS ); }
     else
     {
-        uint32_t size = static_cast< uint32_t > ( oSamp.m_vals->size() );
-
-        uint32_t *v = new uint32_t[size];
-
-        for ( uint32_t i = 0 ; i < size ; ++i )
-        {
-            v[i] = i;
-        }
-
-        const Alembic::Util::Dimensions dims( size );
-
-        oSamp.m_indices.reset( new Abc::UInt32ArraySample( v, dims ),
-                               AbcA::TArrayDeleter<uint32_t>() );
+        oSamp.m_indices = GetIdentityIndices(
+            static_cast< uint32_t > ( oSamp.m_vals->size() ) );
     }
 
     oSamp.m_scope = this->getScope();
@@ -361,6 +383,34 @@ ITypedGeomParam<TRAITS>::getExpanded( typename ITypedGeomParam<TRAITS>::Sample &
     }
     else
     {
+        typedef Abc::TypedArraySample<TRAITS> samp_type;
+
+        // the same values and indices expand to the same thing, so if we can
+        // key both, see if somebody already has the expansion
+        AbcA::ArraySampleKey valsKey;
+        AbcA::ArraySampleKey idxKey;
+        bool keyed = m_indicesProperty.getKey( idxKey, iSS ) &&
+            m_valProp.getKey( valsKey, iSS );
+
+        if ( keyed )
+        {
+            // no indices?  just return what we have in our values
+            if ( idxKey.numBytes == 0 )
+            {
+                m_valProp.get( oSamp.m_vals, iSS );
+                return;
+            }
+
+            AbcA::ArraySamplePtr found = FindExpandedSample(
+                typeid( TRAITS ), valsKey, idxKey );
+            if ( found )
+            {
+                oSamp.m_vals =
+                    Alembic::Util::static_pointer_cast< samp_type >( found );
+                return;
+            }
+        }
+
         Abc::UInt32ArraySamplePtr idxPtr = m_indicesProperty.getValue( iSS );
 
         size_t size = idxPtr->size();
@@ -372,27 +422,38 @@ ITypedGeomParam<TRAITS>::getExpanded( typename ITypedGeomParam<TRAITS>::Sample &
             return;
         }
 
-        Alembic::Util::shared_ptr< Abc::TypedArraySample<TRAITS> > valPtr = \
+        Alembic::Util::shared_ptr< samp_type > valPtr = \
             m_valProp.getValue( iSS );
 
         typename TRAITS::value_type *v = new typename TRAITS::value_type[size];
 
-        for ( size_t i = 0 ; i < size ; ++i )
+        Alembic::Util::PlainOldDataType pod = TRAITS::dataType().getPod();
+        if ( pod == Alembic::Util::kStringPOD ||
+             pod == Alembic::Util::kWstringPOD )
         {
-            v[i] = (*valPtr)[ (*idxPtr)[i] ];
+            for ( size_t i = 0 ; i < size ; ++i )
+            {
+                v[i] = (*valPtr)[ (*idxPtr)[i] ];
+            }
+        }
+        else
+        {
+            GatherIndexed( valPtr->getData(),
+                           sizeof( typename TRAITS::value_type ),
+                           idxPtr->get(), size, v );
         }
-
-        // NOTE: we could create an ArraySampleKey and insert this into the
-        // cache.  If it were in the cache, we'd return the shared pointer
-        // from there and call delete[] on v, thus preventing potentially
-        // unbounded heap growth.  We should probably do this, but for now,
-        // we'll assume that we don't have too many of these, and we're not
-        // tightly memory-constrained. Ha!
 
         const Alembic::Util::Dimensions dims( size );
 
-        oSamp.m_vals.reset( new Abc::TypedArraySample<TRAITS>( v, dims ),
+        oSamp.m_vals.reset( new samp_type( v, dims ),
                             AbcA::TArrayDeleter<typename TRAITS::value_type>());
+
+        if ( keyed )
+        {
+            oSamp.m_vals = Alembic::Util::static_pointer_cast< samp_type >(
+                AddExpandedSample( typeid( TRAITS ), valsKey, idxKey,
+                                   oSamp.m_vals ) );
+        }
     }
 
 }
@@ -36,10 +36,48 @@
 
 #include <Alembic/AbcGeom/IPoints.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// where each range of points to read starts, and how many there are
+typedef std::vector< std::pair< size_t, size_t > > PointRanges;
+
+//-*****************************************************************************
+// A new sample with just iRanges of the sample of iProp at iSS, read one
+// range at a time.
+template < class TRAITS >
+Alembic::Util::shared_ptr< Abc::TypedArraySample< TRAITS > >
+ReadRanges( const Abc::ITypedArrayProperty< TRAITS > & iProp,
+            const PointRanges & iRanges, size_t iNumPoints,
+            const Abc::ISampleSelector & iSS )
+{
+    typedef typename TRAITS::value_type value_type;
+    typedef Abc::TypedArraySample< TRAITS > sample_type;
+
+    value_type * data = new value_type[iNumPoints];
+    Alembic::Util::shared_ptr< sample_type > ret(
+        new sample_type( data, Alembic::Util::Dimensions( iNumPoints ) ),
+        AbcA::TArrayDeleter< value_type >() );
+
+    value_type * next = data;
+    for ( size_t i = 0; i < iRanges.size(); ++i )
+    {
+        iProp.getRange( next, iRanges[i].first, iRanges[i].second, iSS );
+        next += iRanges[i].second;
+    }
+
+    return ret;
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 void IPointsSchema::init( const Abc::Argument &iArg0,
                           const Abc::Argument &iArg1 )
@@ -70,9 +108,200 @@ void IPointsSchema::init( const Abc::Argument &iArg0,
         m_widthsParam = IFloatGeomParam( _this, ".widths", iArg0, iArg1 );
     }
 
+    if ( _this->getPropertyHeader( ".tileOffsets" ) != NULL &&
+         _this->getPropertyHeader( ".tileBnds" ) != NULL )
+    {
+        m_tileOffsetsProperty = Abc::IUInt64ArrayProperty( _this,
+            ".tileOffsets", iArg0, iArg1 );
+        m_tileBoundsProperty = Abc::IBox3dArrayProperty( _this, ".tileBnds",
+                                                         iArg0, iArg1 );
+    }
+
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
+//-*****************************************************************************
+void IPointsSchema::getInterpolated( IPointsSchema::Sample &oSample,
+                                     chrono_t iTime ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getInterpolated()" );
+
+    oSample.reset();
+    get( oSample, Abc::ISampleSelector( iTime,
+                                        Abc::ISampleSelector::kFloorIndex ) );
+
+    InterpolatePositions( m_positionsProperty, m_velocitiesProperty, iTime,
+                          oSample.m_positions, oSample.m_velocities );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPointsSchema::getTiles( std::vector< Abc::Box3d > & oBounds,
+                              std::vector< Alembic::Util::uint64_t > & oOffsets,
+                              const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getTiles()" );
+
+    oBounds.clear();
+    oOffsets.clear();
+
+    if ( isTiled() )
+    {
+        Abc::Box3dArraySamplePtr bounds;
+        Abc::UInt64ArraySamplePtr offsets;
+        m_tileBoundsProperty.get( bounds, iSS );
+        m_tileOffsetsProperty.get( offsets, iSS );
+
+        ABCA_ASSERT( offsets->size() == bounds->size() + 1,
+                     "Mismatched tile offsets and bounds" );
+
+        oBounds.assign( bounds->get(), bounds->get() + bounds->size() );
+        oOffsets.assign( offsets->get(), offsets->get() + offsets->size() );
+    }
+    else
+    {
+        Abc::Box3d bounds;
+        m_selfBoundsProperty.get( bounds, iSS );
+        oBounds.push_back( bounds );
+        oOffsets.push_back( 0 );
+        Alembic::Util::Dimensions dims;
+        m_positionsProperty.getDimensions( dims, iSS );
+        oOffsets.push_back( dims.numPoints() );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPointsSchema::getTiled( IPointsSchema::Sample &oSample,
+                              const Abc::Box3d &iRegion,
+                              double iFraction,
+                              const Abc::ISampleSelector &iSS ) const
+{
+    getTiled( oSample, NULL, iRegion, iFraction, iSS );
+}
+
+//-*****************************************************************************
+void IPointsSchema::getTiled( IPointsSchema::Sample &oSample,
+                              Abc::FloatArraySamplePtr &oWidths,
+                              const Abc::Box3d &iRegion,
+                              double iFraction,
+                              const Abc::ISampleSelector &iSS ) const
+{
+    getTiled( oSample, &oWidths, iRegion, iFraction, iSS );
+}
+
+//-*****************************************************************************
+void IPointsSchema::getTiled( IPointsSchema::Sample &oSample,
+                              Abc::FloatArraySamplePtr *oWidths,
+                              const Abc::Box3d &iRegion,
+                              double iFraction,
+                              const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getTiled()" );
+
+    oSample.reset();
+    if ( oWidths )
+    {
+        oWidths->reset();
+    }
+
+    std::vector< Abc::Box3d > bounds;
+    std::vector< Alembic::Util::uint64_t > offsets;
+    getTiles( bounds, offsets, iSS );
+
+    iFraction = std::max( std::min( iFraction, 1.0 ), 0.0 );
+
+    PointRanges ranges;
+    size_t numPoints = 0;
+    for ( size_t i = 0; i < bounds.size(); ++i )
+    {
+        if ( !bounds[i].intersects( iRegion ) )
+        {
+            continue;
+        }
+
+        size_t count = ( size_t ) std::ceil(
+            ( offsets[i + 1] - offsets[i] ) * iFraction );
+        if ( count > 0 )
+        {
+            ranges.push_back( std::make_pair( offsets[i], count ) );
+            numPoints += count;
+            oSample.m_selfBounds.extendBy( bounds[i] );
+        }
+    }
+
+    // only the ranges are read, not the whole samples
+    Alembic::Util::Dimensions dims;
+    m_positionsProperty.getDimensions( dims, iSS );
+    ABCA_ASSERT( dims.numPoints() == offsets.back(),
+                 "Tiles don't match the points" );
+
+    oSample.m_positions = ReadRanges( m_positionsProperty, ranges, numPoints,
+                                      iSS );
+    oSample.m_ids = ReadRanges( m_idsProperty, ranges, numPoints, iSS );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        Alembic::Util::Dimensions velDims;
+        m_velocitiesProperty.getDimensions( velDims, iSS );
+        if ( velDims.numPoints() == dims.numPoints() )
+        {
+            oSample.m_velocities = ReadRanges( m_velocitiesProperty, ranges,
+                                               numPoints, iSS );
+        }
+    }
+
+    IFloatGeomParam widths = m_widthsParam;
+    if ( oWidths && widths && widths.getNumSamples() > 0 )
+    {
+        // OPointsSchema::setTiled reorders the widths along with the points
+        // when there is one for every point, so those are read by range too
+        Alembic::Util::Dimensions widthDims;
+        Abc::IFloatArrayProperty vals = widths.getValueProperty();
+        if ( widths.isIndexed() )
+        {
+            Abc::IUInt32ArrayProperty indicesProp = widths.getIndexProperty();
+            indicesProp.getDimensions( widthDims, iSS );
+            if ( widthDims.numPoints() == dims.numPoints() )
+            {
+                Abc::UInt32ArraySamplePtr indices = ReadRanges( indicesProp,
+                    ranges, numPoints, iSS );
+                Abc::FloatArraySamplePtr valsSamp = vals.getValue( iSS );
+
+                float * data = new float[numPoints];
+                *oWidths = Abc::FloatArraySamplePtr(
+                    new Abc::FloatArraySample( data,
+                        Alembic::Util::Dimensions( numPoints ) ),
+                    AbcA::TArrayDeleter< float >() );
+                for ( size_t i = 0; i < numPoints; ++i )
+                {
+                    ABCA_ASSERT( ( *indices )[i] < valsSamp->size(),
+                                 "Width index out of range" );
+                    data[i] = ( *valsSamp )[( *indices )[i]];
+                }
+            }
+        }
+        else
+        {
+            vals.getDimensions( widthDims, iSS );
+            if ( widthDims.numPoints() == dims.numPoints() )
+            {
+                *oWidths = ReadRanges( vals, ranges, numPoints, iSS );
+            }
+        }
+
+        // widths that aren't per point weren't reordered
+        if ( !*oWidths )
+        {
+            *oWidths = widths.getExpandedValue( iSS ).getVals();
+        }
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -195,6 +195,39 @@ public:
         return smp;
     }
 
+    //! The sample at iTime, which needn't be one of the sampled times.
+    //! Everything but the positions and velocities is that of the sample at
+    //! or before iTime, see InterpolatePositions for those.
+    void getInterpolated( Sample &oSample, chrono_t iTime ) const;
+
+    //! Whether the points were written in tiles, see
+    //! OPointsSchema::setTileSize.
+    bool isTiled() const { return m_tileOffsetsProperty.valid(); }
+
+    //! The bounds of each tile at iSS, and where their points start: the
+    //! points of tile i are [oOffsets[i], oOffsets[i + 1]).  Points that
+    //! weren't tiled are a single tile with the self bounds.
+    void getTiles( std::vector< Abc::Box3d > & oBounds,
+                   std::vector< Alembic::Util::uint64_t > & oOffsets,
+                   const Abc::ISampleSelector &iSS =
+                   Abc::ISampleSelector() ) const;
+
+    //! Only the points of the tiles whose bounds intersect iRegion, and of
+    //! those only the first iFraction of each tile, which is spread evenly
+    //! over it.  The self bounds are those of the tiles read.
+    void getTiled( Sample &oSample, const Abc::Box3d &iRegion,
+                   double iFraction = 1.0,
+                   const Abc::ISampleSelector &iSS =
+                   Abc::ISampleSelector() ) const;
+
+    //! Like getTiled above, and also the widths of the points read, one per
+    //! point in the order they were read.  Widths that aren't per point
+    //! are expanded as they are, and oWidths is NULL without any.
+    void getTiled( Sample &oSample, Abc::FloatArraySamplePtr &oWidths,
+                   const Abc::Box3d &iRegion, double iFraction = 1.0,
+                   const Abc::ISampleSelector &iSS =
+                   Abc::ISampleSelector() ) const;
+
     Abc::IP3fArrayProperty getPositionsProperty() const
     {
         return m_positionsProperty;
@@ -250,10 +283,19 @@ protected:
     void init( const Abc::Argument &iArg0,
                const Abc::Argument &iArg1 );
 
+    // both getTiled, the widths are only read when oWidths isn't NULL
+    void getTiled( Sample &oSample, Abc::FloatArraySamplePtr *oWidths,
+                   const Abc::Box3d &iRegion, double iFraction,
+                   const Abc::ISampleSelector &iSS ) const;
+
     Abc::IP3fArrayProperty m_positionsProperty;
     Abc::IUInt64ArrayProperty m_idsProperty;
     Abc::IV3fArrayProperty m_velocitiesProperty;
     IFloatGeomParam m_widthsParam;
+
+    // only there for tiled points
+    Abc::IUInt64ArrayProperty m_tileOffsetsProperty;
+    Abc::IBox3dArrayProperty m_tileBoundsProperty;
 };
 
 //-*****************************************************************************
@@ -120,6 +120,8 @@ IPolyMeshSchema::operator=(const IPolyMeshSchema & rhs)
     m_velocitiesProperty = rhs.m_velocitiesProperty;
     m_indicesProperty   = rhs.m_indicesProperty;
     m_countsProperty    = rhs.m_countsProperty;
+    m_indicesMemo.reset();
+    m_countsMemo.reset();
 
     m_uvsParam          = rhs.m_uvsParam;
     m_normalsParam      = rhs.m_normalsParam;
@@ -229,6 +231,22 @@ IPolyMeshSchema::getFaceSet ( const std::string &iFaceSetName )
 }
 
 
+//-*****************************************************************************
+void IPolyMeshSchema::getInterpolated( IPolyMeshSchema::Sample &oSample,
+                                       chrono_t iTime ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getInterpolated()" );
+
+    oSample.reset();
+    get( oSample, Abc::ISampleSelector( iTime,
+                                        Abc::ISampleSelector::kFloorIndex ) );
+
+    InterpolatePositions( m_positionsProperty, m_velocitiesProperty, iTime,
+                          oSample.m_positions, oSample.m_velocities );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
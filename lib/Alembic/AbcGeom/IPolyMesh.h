@@ -40,6 +40,7 @@
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcGeom/Foundation.h>
 #include <Alembic/AbcGeom/SchemaInfoDeclarations.h>
+#include <Alembic/AbcGeom/ArraySampleMemo.h>
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
@@ -182,8 +183,10 @@ public:
         ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::get()" );
 
         m_positionsProperty.get( oSample.m_positions, iSS );
-        m_indicesProperty.get( oSample.m_indices, iSS );
-        m_countsProperty.get( oSample.m_counts, iSS );
+
+        // the topology of homogenous meshes is shared across samples
+        m_indicesMemo.get( m_indicesProperty, oSample.m_indices, iSS );
+        m_countsMemo.get( m_countsProperty, oSample.m_counts, iSS );
 
         m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
 
@@ -204,6 +207,11 @@ public:
         return smp;
     }
 
+    //! The sample at iTime, which needn't be one of the sampled times.
+    //! Everything but the positions and velocities is that of the sample at
+    //! or before iTime, see InterpolatePositions for those.
+    void getInterpolated( Sample &oSample, chrono_t iTime ) const;
+
     IV2fGeomParam getUVsParam() const
     {
         return m_uvsParam;
@@ -248,6 +256,8 @@ public:
         m_velocitiesProperty.reset();
         m_indicesProperty.reset();
         m_countsProperty.reset();
+        m_indicesMemo.reset();
+        m_countsMemo.reset();
 
         m_uvsParam.reset();
         m_normalsParam.reset();
@@ -284,6 +294,9 @@ protected:
     Abc::IInt32ArrayProperty m_indicesProperty;
     Abc::IInt32ArrayProperty m_countsProperty;
 
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_indicesMemo;
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_countsMemo;
+
     IV2fGeomParam m_uvsParam;
     IN3fGeomParam m_normalsParam;
 
@@ -101,8 +101,9 @@ void ISubDSchema::get( ISubDSchema::Sample &oSample,
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::get()" );
 
     m_positionsProperty.get( oSample.m_positions, iSS );
-    m_faceIndicesProperty.get( oSample.m_faceIndices, iSS );
-    m_faceCountsProperty.get( oSample.m_faceCounts, iSS );
+    m_faceIndicesMemo.get( m_faceIndicesProperty, oSample.m_faceIndices,
+                           iSS );
+    m_faceCountsMemo.get( m_faceCountsProperty, oSample.m_faceCounts, iSS );
 
     if ( m_faceVaryingInterpolateBoundaryProperty )
     {
@@ -136,22 +137,40 @@ void ISubDSchema::get( ISubDSchema::Sample &oSample,
     m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
 
     if ( m_creaseIndicesProperty )
-    { m_creaseIndicesProperty.get( oSample.m_creaseIndices, iSS ); }
+    {
+        m_creaseIndicesMemo.get( m_creaseIndicesProperty,
+            oSample.m_creaseIndices, iSS );
+    }
 
     if ( m_creaseLengthsProperty )
-    { m_creaseLengthsProperty.get( oSample.m_creaseLengths, iSS ); }
+    {
+        m_creaseLengthsMemo.get( m_creaseLengthsProperty,
+            oSample.m_creaseLengths, iSS );
+    }
 
     if ( m_creaseSharpnessesProperty )
-    { m_creaseSharpnessesProperty.get( oSample.m_creaseSharpnesses, iSS ); }
+    {
+        m_creaseSharpnessesMemo.get( m_creaseSharpnessesProperty,
+            oSample.m_creaseSharpnesses, iSS );
+    }
 
     if ( m_cornerIndicesProperty )
-    { m_cornerIndicesProperty.get( oSample.m_cornerIndices, iSS ); }
+    {
+        m_cornerIndicesMemo.get( m_cornerIndicesProperty,
+            oSample.m_cornerIndices, iSS );
+    }
 
     if ( m_cornerSharpnessesProperty )
-    { m_cornerSharpnessesProperty.get( oSample.m_cornerSharpnesses, iSS ); }
+    {
+        m_cornerSharpnessesMemo.get( m_cornerSharpnessesProperty,
+            oSample.m_cornerSharpnesses, iSS );
+    }
 
     if ( m_holesProperty )
-    { m_holesProperty.get( oSample.m_holes, iSS ); }
+    {
+        m_holesMemo.get( m_holesProperty,
+            oSample.m_holes, iSS );
+    }
 
     if ( m_subdSchemeProperty )
     {
@@ -189,6 +208,14 @@ ISubDSchema::operator=(const ISubDSchema & rhs)
     m_cornerIndicesProperty = rhs.m_cornerIndicesProperty;
     m_cornerSharpnessesProperty = rhs.m_cornerSharpnessesProperty;
     m_holesProperty = rhs.m_holesProperty;
+    m_faceIndicesMemo.reset();
+    m_faceCountsMemo.reset();
+    m_creaseIndicesMemo.reset();
+    m_creaseLengthsMemo.reset();
+    m_creaseSharpnessesMemo.reset();
+    m_cornerIndicesMemo.reset();
+    m_cornerSharpnessesMemo.reset();
+    m_holesMemo.reset();
     m_subdSchemeProperty = rhs.m_subdSchemeProperty;
     m_uvsParam = rhs.m_uvsParam;
     m_faceVaryingInterpolateBoundaryProperty =
@@ -40,6 +40,7 @@
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcGeom/Foundation.h>
 #include <Alembic/AbcGeom/SchemaInfoDeclarations.h>
+#include <Alembic/AbcGeom/ArraySampleMemo.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
@@ -330,6 +331,15 @@ public:
 
         m_holesProperty.reset();
 
+        m_faceIndicesMemo.reset();
+        m_faceCountsMemo.reset();
+        m_creaseIndicesMemo.reset();
+        m_creaseLengthsMemo.reset();
+        m_creaseSharpnessesMemo.reset();
+        m_cornerIndicesMemo.reset();
+        m_cornerSharpnessesMemo.reset();
+        m_holesMemo.reset();
+
         m_subdSchemeProperty.reset();
 
         m_uvsParam.reset();
@@ -389,6 +399,18 @@ protected:
     // Holes
     Abc::IInt32ArrayProperty  m_holesProperty;
 
+    // the topology of homogenous subds is shared across samples
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_faceIndicesMemo;
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_faceCountsMemo;
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_creaseIndicesMemo;
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_creaseLengthsMemo;
+    mutable ArraySampleMemo<Abc::IFloatArrayProperty>
+        m_creaseSharpnessesMemo;
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_cornerIndicesMemo;
+    mutable ArraySampleMemo<Abc::IFloatArrayProperty>
+        m_cornerSharpnessesMemo;
+    mutable ArraySampleMemo<Abc::IInt32ArrayProperty> m_holesMemo;
+
     // subdivision scheme
     Abc::IStringProperty      m_subdSchemeProperty;
 
@@ -37,6 +37,8 @@
 #include <Alembic/AbcGeom/IXform.h>
 #include <Alembic/AbcGeom/XformOp.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
@@ -179,6 +181,8 @@ void IXformSchema::init( const Abc::Argument &iArg0,
         }
     }
 
+    m_compiledOps = CompiledXformOps( m_sample );
+
     if ( ptr->getPropertyHeader( ".arbGeomParams" ) != NULL )
     {
         m_arbGeomParams = Abc::ICompoundProperty( ptr, ".arbGeomParams",
@@ -232,26 +236,34 @@ std::size_t IXformSchema::getNumSamples() const
 }
 
 //-*****************************************************************************
-void IXformSchema::getChannelValues( const AbcA::index_t iSampleIndex,
-    XformSample & oSamp ) const
+void IXformSchema::readChannels( const AbcA::index_t iSampleIndex,
+    std::vector<Alembic::Util::float64_t> & oChannels ) const
 {
-    std::vector<Alembic::Util::float64_t> dataVec;
-
     if ( m_useArrayProp )
     {
         AbcA::ArraySamplePtr sptr;
         m_valsProperty->asArrayPtr()->getSample( iSampleIndex, sptr );
 
-        dataVec.assign(
+        oChannels.assign(
             static_cast<const Alembic::Util::float64_t*>( sptr->getData() ),
             static_cast<const Alembic::Util::float64_t*>( sptr->getData() ) +
             sptr->size() );
     }
     else
     {
-        dataVec.resize( m_valsProperty->asScalarPtr()->getDataType().getExtent() );
-        m_valsProperty->asScalarPtr()->getSample( iSampleIndex, &(dataVec.front()) );
+        oChannels.resize(
+            m_valsProperty->asScalarPtr()->getDataType().getExtent() );
+        m_valsProperty->asScalarPtr()->getSample( iSampleIndex,
+                                                  &(oChannels.front()) );
     }
+}
+
+//-*****************************************************************************
+void IXformSchema::getChannelValues( const AbcA::index_t iSampleIndex,
+    XformSample & oSamp ) const
+{
+    std::vector<Alembic::Util::float64_t> dataVec;
+    readChannels( iSampleIndex, dataVec );
 
     std::vector< XformOp >::iterator op = oSamp.m_ops.begin();
     std::vector< XformOp >::iterator opEnd = oSamp.m_ops.end();
@@ -315,6 +327,205 @@ XformSample IXformSchema::getValue( const Abc::ISampleSelector &iSS ) const
     return ret;
 }
 
+//-*****************************************************************************
+Abc::M44d IXformSchema::getMatrix( const Abc::ISampleSelector &iSS ) const
+{
+    Abc::M44d ret;
+
+    if ( ! valid() || ! m_valsProperty ) { return ret; }
+
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IXformSchema::getMatrix()" );
+
+    AbcA::index_t numSamples = 0;
+    if ( m_useArrayProp )
+    {
+        numSamples = m_valsProperty->asArrayPtr()->getNumSamples();
+    }
+    else
+    {
+        numSamples = m_valsProperty->asScalarPtr()->getNumSamples();
+    }
+
+    if ( numSamples == 0 ) { return ret; }
+
+    AbcA::index_t sampIdx = iSS.getIndex( m_valsProperty->getTimeSampling(),
+                                          numSamples );
+
+    if ( sampIdx < 0 ) { return ret; }
+
+    this->getMatrices( sampIdx, 1, &ret );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    return ret;
+}
+
+//-*****************************************************************************
+void IXformSchema::getMatrices( AbcA::index_t iFirstIndex,
+                                size_t iNumSamples,
+                                Abc::M44d * oMatrices ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IXformSchema::getMatrices()" );
+
+    AbcA::index_t numSamples = 0;
+    if ( m_valsProperty && m_useArrayProp )
+    {
+        numSamples = m_valsProperty->asArrayPtr()->getNumSamples();
+    }
+    else if ( m_valsProperty )
+    {
+        numSamples = m_valsProperty->asScalarPtr()->getNumSamples();
+    }
+
+    if ( numSamples == 0 )
+    {
+        for ( size_t i = 0; i < iNumSamples; ++i )
+        {
+            oMatrices[i].makeIdentity();
+        }
+        return;
+    }
+
+    ABCA_ASSERT( iFirstIndex >= 0, "Invalid sample index: " << iFirstIndex );
+
+    size_t numChannels = m_compiledOps.getNumChannels();
+
+    if ( m_useArrayProp )
+    {
+        // the stored samples are already what the compiled ops want
+        AbcA::ArrayPropertyReaderPtr vals = m_valsProperty->asArrayPtr();
+        for ( size_t i = 0; i < iNumSamples; ++i )
+        {
+            AbcA::index_t index = std::min( iFirstIndex + ( AbcA::index_t ) i,
+                                            numSamples - 1 );
+            AbcA::ArraySamplePtr sptr;
+            vals->getSample( index, sptr );
+
+            ABCA_ASSERT( sptr->size() == numChannels,
+                         "Expected " << numChannels << " channels, got "
+                         << sptr->size() );
+
+            m_compiledOps.evaluate(
+                static_cast< const Alembic::Util::float64_t * >(
+                    sptr->getData() ), 0, 1, oMatrices + i );
+        }
+        return;
+    }
+
+    // read every sample first and evaluate them all in one go
+    AbcA::ScalarPropertyReaderPtr vals = m_valsProperty->asScalarPtr();
+    ABCA_ASSERT( vals->getDataType().getExtent() == numChannels,
+                 "Expected " << numChannels << " channels, got "
+                 << ( size_t ) vals->getDataType().getExtent() );
+
+    std::vector< Alembic::Util::float64_t > dataVec( numChannels *
+                                                     iNumSamples );
+    for ( size_t i = 0; i < iNumSamples && numChannels > 0; ++i )
+    {
+        AbcA::index_t index = std::min( iFirstIndex + ( AbcA::index_t ) i,
+                                        numSamples - 1 );
+        vals->getSample( index, &dataVec[i * numChannels] );
+    }
+
+    m_compiledOps.evaluate( dataVec.empty() ? NULL : &dataVec.front(),
+                            numChannels, iNumSamples, oMatrices );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+bool IXformSchema::getInterpolatedChannels( chrono_t iTime,
+    std::vector<Alembic::Util::float64_t> & oChannels ) const
+{
+    if ( ! valid() || ! m_valsProperty ) { return false; }
+
+    AbcA::index_t numSamples = 0;
+    if ( m_useArrayProp )
+    {
+        numSamples = m_valsProperty->asArrayPtr()->getNumSamples();
+    }
+    else
+    {
+        numSamples = m_valsProperty->asScalarPtr()->getNumSamples();
+    }
+
+    if ( numSamples == 0 ) { return false; }
+
+    AbcA::TimeSamplingPtr ts = m_valsProperty->getTimeSampling();
+    std::pair<AbcA::index_t, chrono_t> floorIndex =
+        ts->getFloorIndex( iTime, numSamples );
+    std::pair<AbcA::index_t, chrono_t> ceilIndex =
+        ts->getCeilIndex( iTime, numSamples );
+
+    readChannels( floorIndex.first, oChannels );
+
+    if ( floorIndex.first == ceilIndex.first ||
+         ceilIndex.second <= floorIndex.second )
+    {
+        return true;
+    }
+
+    std::vector<Alembic::Util::float64_t> ceilChannels;
+    readChannels( ceilIndex.first, ceilChannels );
+    if ( ceilChannels.size() != oChannels.size() ) { return true; }
+
+    // blending the channels rather than the matrices keeps rotations
+    // rotating, the same as animation curves in most packages
+    double t = ( iTime - floorIndex.second ) /
+        ( ceilIndex.second - floorIndex.second );
+    for ( size_t i = 0; i < oChannels.size(); ++i )
+    {
+        oChannels[i] += t * ( ceilChannels[i] - oChannels[i] );
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+void IXformSchema::getInterpolated( XformSample &oSamp, chrono_t iTime ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IXformSchema::getInterpolated()" );
+
+    Abc::ISampleSelector floorSS( iTime, Abc::ISampleSelector::kFloorIndex );
+    get( oSamp, floorSS );
+
+    std::vector<Alembic::Util::float64_t> channels;
+    if ( ! getInterpolatedChannels( iTime, channels ) ) { return; }
+
+    std::size_t chanPos = 0;
+    for ( std::size_t i = 0; i < oSamp.m_ops.size(); ++i )
+    {
+        XformOp & op = oSamp.m_ops[i];
+        for ( std::size_t j = 0; j < op.getNumChannels() &&
+              chanPos < channels.size(); ++j, ++chanPos )
+        {
+            op.setChannelValue( j, channels[chanPos] );
+        }
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+Abc::M44d IXformSchema::getInterpolatedMatrix( chrono_t iTime ) const
+{
+    Abc::M44d ret;
+
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IXformSchema::getInterpolatedMatrix()" );
+
+    std::vector<Alembic::Util::float64_t> channels;
+    if ( getInterpolatedChannels( iTime, channels ) &&
+         channels.size() == m_compiledOps.getNumChannels() &&
+         ! channels.empty() )
+    {
+        ret = m_compiledOps.evaluate( &channels.front() );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    return ret;
+}
+
 //-*****************************************************************************
 bool IXformSchema::getInheritsXforms( const Abc::ISampleSelector &iSS ) const
 {
@@ -42,6 +42,7 @@
 #include <Alembic/AbcGeom/SchemaInfoDeclarations.h>
 
 #include <Alembic/AbcGeom/XformSample.h>
+#include <Alembic/AbcGeom/CompiledXformOps.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -138,12 +139,37 @@ public:
 
     size_t getNumOps() const { return m_sample.getNumOps(); }
 
+    //! The same as getValue( iSS ).getMatrix(), but evaluated by the compiled
+    //! op stack straight from the stored channel values.
+    Abc::M44d getMatrix( const Abc::ISampleSelector &iSS =
+                         Abc::ISampleSelector() ) const;
+
+    //! Fills oMatrices with the matrices of the iNumSamples samples starting
+    //! at sample index iFirstIndex, indices past the last sample get the
+    //! matrix of the last sample.
+    void getMatrices( AbcA::index_t iFirstIndex, size_t iNumSamples,
+                      Abc::M44d * oMatrices ) const;
+
+    //! The sample at iTime, which needn't be one of the sampled times, with
+    //! every channel value blended linearly between the samples on either
+    //! side of iTime.  Whether it inherits comes from the sample at or before
+    //! iTime.
+    void getInterpolated( XformSample &oSamp, chrono_t iTime ) const;
+
+    //! The same as getInterpolated( samp, iTime ) followed by
+    //! samp.getMatrix(), evaluated by the compiled op stack.
+    Abc::M44d getInterpolatedMatrix( chrono_t iTime ) const;
+
+    //! The op stack, compiled once when this schema was created.
+    const CompiledXformOps & getCompiledOps() const { return m_compiledOps; }
+
     //! Reset returns this function set to an empty, default
     //! state.
     void reset()
     {
         m_childBoundsProperty.reset();
         m_sample = XformSample();
+        m_compiledOps = CompiledXformOps();
         m_inheritsProperty.reset();
         m_isConstant = true;
         m_isConstantIdentity = true;
@@ -185,6 +211,8 @@ protected:
 
     XformSample m_sample;
 
+    CompiledXformOps m_compiledOps;
+
 private:
     void init( const Abc::Argument &iArg0, const Abc::Argument &iArg1 );
 
@@ -194,6 +222,14 @@ private:
     // fills m_valVec with data
     void getChannelValues( const AbcA::index_t iSampleIndex,
                            XformSample & oSamp ) const;
+
+    // reads every channel value of a sample of .vals
+    void readChannels( const AbcA::index_t iSampleIndex,
+        std::vector<Alembic::Util::float64_t> & oChannels ) const;
+
+    // the channel values at iTime, false if there aren't any
+    bool getInterpolatedChannels( chrono_t iTime,
+        std::vector<Alembic::Util::float64_t> & oChannels ) const;
 };
 
 //-*****************************************************************************
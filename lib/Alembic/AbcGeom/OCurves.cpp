@@ -97,12 +97,19 @@ void OCurvesSchema::set( const OCurvesSchema::Sample &iSamp )
         ABCA_ASSERT( iSamp.getPositions(),
                      "Sample 0 must have valid data for all mesh components" );
 
-        m_positionsProperty.set( iSamp.getPositions() );
-        m_nVerticesProperty.set( iSamp.getCurvesNumVertices() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
+
+        if ( iSamp.getCurvesNumVerticesPtr() )
+        { m_nVerticesProperty.set( iSamp.getCurvesNumVerticesPtr() ); }
+        else
+        { m_nVerticesProperty.set( iSamp.getCurvesNumVertices() ); }
 
         m_basisAndTypeProperty.set( basisAndType );
 
-        if ( m_velocitiesProperty )
+        if ( m_velocitiesProperty && iSamp.getVelocitiesPtr() )
+        { m_velocitiesProperty.set( iSamp.getVelocitiesPtr() ); }
+        else if ( m_velocitiesProperty )
         { m_velocitiesProperty.set( iSamp.getVelocities() ); }
 
         if ( iSamp.getSelfBounds().isEmpty() )
@@ -113,10 +120,10 @@ void OCurvesSchema::set( const OCurvesSchema::Sample &iSamp )
                 ComputeBoundsFromPositions( iSamp.getPositions() )
                            );
 
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
 
         }
-        else { m_selfBoundsProperty.set( iSamp.getSelfBounds() ); }
+        else { setSelfBounds( iSamp.getSelfBounds() ); }
 
         // process uvs
         if ( iSamp.getUVs() )
@@ -156,8 +163,11 @@ void OCurvesSchema::set( const OCurvesSchema::Sample &iSamp )
     }
     else
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
-        SetPropUsePrevIfNull( m_nVerticesProperty, iSamp.getCurvesNumVertices() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
+        SetPropUsePrevIfNull( m_nVerticesProperty,
+                              iSamp.getCurvesNumVertices(),
+                              iSamp.getCurvesNumVerticesPtr() );
 
         // if number of vertices were specified, then the basis and type
         // was specified
@@ -171,7 +181,10 @@ void OCurvesSchema::set( const OCurvesSchema::Sample &iSamp )
         }
 
         if ( m_velocitiesProperty )
-        { SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() ); }
+        {
+            SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                                  iSamp.getVelocitiesPtr() );
+        }
 
         if ( m_uvsParam )
         { m_uvsParam.set( iSamp.getUVs() ); }
@@ -201,18 +214,18 @@ void OCurvesSchema::set( const OCurvesSchema::Sample &iSamp )
         // update bounds
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() )
                            );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.setFromPrevious();
+            setSelfBoundsFromPrevious();
         }
     }
 
@@ -236,21 +249,22 @@ void OCurvesSchema::selectiveSet( const OCurvesSchema::Sample &iSamp )
 
     if ( m_positionsProperty )
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
 
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.setFromPrevious();
+            setSelfBoundsFromPrevious();
         }
     }
 
@@ -261,7 +275,9 @@ void OCurvesSchema::selectiveSet( const OCurvesSchema::Sample &iSamp )
 
     if( m_nVerticesProperty )
     {
-        SetPropUsePrevIfNull( m_nVerticesProperty, iSamp.getCurvesNumVertices() );
+        SetPropUsePrevIfNull( m_nVerticesProperty,
+                              iSamp.getCurvesNumVertices(),
+                              iSamp.getCurvesNumVerticesPtr() );
         m_basisAndTypeProperty.set( basisAndType );
     }
 
@@ -272,7 +288,8 @@ void OCurvesSchema::selectiveSet( const OCurvesSchema::Sample &iSamp )
 
     if ( m_velocitiesProperty )
     {
-        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() );
+        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                              iSamp.getVelocitiesPtr() );
     }
 
     if ( iSamp.getUVs() && !m_uvsParam )
@@ -349,7 +366,7 @@ void OCurvesSchema::setFromPrevious()
     if ( m_positionsProperty ) { m_positionsProperty.setFromPrevious(); }
     if ( m_nVerticesProperty ) { m_nVerticesProperty.setFromPrevious(); }
     if ( m_basisAndTypeProperty ) { m_basisAndTypeProperty.setFromPrevious(); }
-    if ( m_selfBoundsProperty ) { m_selfBoundsProperty.setFromPrevious(); }
+    if ( m_selfBoundsProperty ) { setSelfBoundsFromPrevious(); }
     if ( m_velocitiesProperty ) { m_velocitiesProperty.setFromPrevious(); }
     if ( m_uvsParam ) { m_uvsParam.setFromPrevious(); }
     if ( m_normalsParam ) { m_normalsParam.setFromPrevious(); }
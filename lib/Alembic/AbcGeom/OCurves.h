@@ -134,7 +134,19 @@ public:
         // positions accessor
         const Abc::P3fArraySample &getPositions() const { return m_positions; }
         void setPositions( const Abc::P3fArraySample &iSmp )
-        { m_positions = iSmp; }
+        { m_positions = iSmp; m_positionsPtr.reset(); }
+
+        //! Sets the positions from a sample the curves may keep hold of, so
+        //! the archive doesn't need to copy it before writing.  A NULL
+        //! iSmp unsets the positions.
+        void setPositions( const Abc::P3fArraySamplePtr &iSmp )
+        {
+            if ( iSmp ) { setPositions( *iSmp ); }
+            else { setPositions( Abc::P3fArraySample() ); }
+            m_positionsPtr = iSmp;
+        }
+        const Abc::P3fArraySamplePtr &getPositionsPtr() const
+        { return m_positionsPtr; }
 
         // position weights, if it isn't set, it's 1 for every point
         const Abc::FloatArraySample &getPositionWeights() const
@@ -157,9 +169,17 @@ public:
         //! an array of ints that corresponds to the number
         //! of vertices per curve
         void setCurvesNumVertices( const Abc::Int32ArraySample &iNVertices)
-        { m_nVertices = iNVertices; }
+        { m_nVertices = iNVertices; m_nVerticesPtr.reset(); }
+        void setCurvesNumVertices( const Abc::Int32ArraySamplePtr &iNVertices )
+        {
+            if ( iNVertices ) { setCurvesNumVertices( *iNVertices ); }
+            else { setCurvesNumVertices( Abc::Int32ArraySample() ); }
+            m_nVerticesPtr = iNVertices;
+        }
         const Abc::Int32ArraySample &getCurvesNumVertices() const
         { return m_nVertices; }
+        const Abc::Int32ArraySamplePtr &getCurvesNumVerticesPtr() const
+        { return m_nVerticesPtr; }
 
         // UVs
         const OV2fGeomParam::Sample &getUVs() const { return m_uvs; }
@@ -174,7 +194,15 @@ public:
         // velocities accessor
         const Abc::V3fArraySample &getVelocities() const { return m_velocities; }
         void setVelocities( const Abc::V3fArraySample &iVelocities )
-        { m_velocities = iVelocities; }
+        { m_velocities = iVelocities; m_velocitiesPtr.reset(); }
+        void setVelocities( const Abc::V3fArraySamplePtr &iVelocities )
+        {
+            if ( iVelocities ) { setVelocities( *iVelocities ); }
+            else { setVelocities( Abc::V3fArraySample() ); }
+            m_velocitiesPtr = iVelocities;
+        }
+        const Abc::V3fArraySamplePtr &getVelocitiesPtr() const
+        { return m_velocitiesPtr; }
 
         // normal accessors
         const ON3fGeomParam::Sample &getNormals() const { return m_normals; }
@@ -206,6 +234,9 @@ public:
             m_widths.reset();
 
             m_nVertices.reset();
+            m_positionsPtr.reset();
+            m_velocitiesPtr.reset();
+            m_nVerticesPtr.reset();
 
             m_orders.reset();
             m_knots.reset();
@@ -237,6 +268,11 @@ public:
         Abc::V3fArraySample m_velocities;
         Abc::Int32ArraySample m_nVertices;
 
+        // set alongside the samples above when the data was handed over
+        Abc::P3fArraySamplePtr m_positionsPtr;
+        Abc::V3fArraySamplePtr m_velocitiesPtr;
+        Abc::Int32ArraySamplePtr m_nVerticesPtr;
+
         CurveType m_type;
         CurvePeriodicity m_wrap;
 
@@ -220,7 +220,7 @@ void OFaceSetSchema::set( const Sample &iSamp )
         SetPropUsePrevIfNull( m_facesProperty, iSamp.getFaces() );
     }
 
-    m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+    setSelfBounds( iSamp.getSelfBounds() );
 
     if (m_facesExclusive != kFaceSetNonExclusive)
     {
@@ -39,6 +39,7 @@
 
 #include <Alembic/Abc/OSchema.h>
 #include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/ArchiveBounds.h>
 #include <Alembic/AbcGeom/OGeomParam.h>
 
 namespace Alembic {
@@ -213,11 +214,25 @@ protected:
         Abc::Box3d bnds;
         for ( size_t i = 0; i < iNumSamples; ++i )
         {
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         ALEMBIC_ABC_SAFE_CALL_END();
     }
 
+    //! Sets the next self bounds sample, letting the OChildBoundsWriter of
+    //! the archive know about it if there is one.
+    void setSelfBounds( const Abc::Box3d & iBounds )
+    {
+        m_selfBoundsProperty.set( iBounds );
+        OChildBoundsWriter::RecordSelfBounds( m_selfBoundsProperty, &iBounds );
+    }
+
+    void setSelfBoundsFromPrevious()
+    {
+        m_selfBoundsProperty.setFromPrevious();
+        OChildBoundsWriter::RecordSelfBounds( m_selfBoundsProperty, NULL );
+    }
+
     // Only selfBounds is required, all others are optional
     Abc::OBox3dProperty m_selfBoundsProperty;
     Abc::OBox3dProperty m_childBoundsProperty;
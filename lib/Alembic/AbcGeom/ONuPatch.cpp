@@ -164,7 +164,8 @@ void ONuPatchSchema::set( const ONuPatchSchema::Sample &iSamp  )
                      "Sample 0 must have valid data for all mesh components" );
 
         // set required properties
-        m_positionsProperty.set( iSamp.getPositions() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
         m_numUProperty.set( iSamp.getNu() );
         m_numVProperty.set( iSamp.getNv() );
         m_uOrderProperty.set( iSamp.getUOrder() );
@@ -192,7 +193,11 @@ void ONuPatchSchema::set( const ONuPatchSchema::Sample &iSamp  )
             m_positionWeightsProperty.set( iSamp.getPositionWeights() );
         }
 
-        if ( m_velocitiesProperty )
+        if ( m_velocitiesProperty && iSamp.getVelocitiesPtr() )
+        {
+            m_velocitiesProperty.set( iSamp.getVelocitiesPtr() );
+        }
+        else if ( m_velocitiesProperty )
         {
             m_velocitiesProperty.set( iSamp.getVelocities() );
         }
@@ -215,18 +220,19 @@ void ONuPatchSchema::set( const ONuPatchSchema::Sample &iSamp  )
                 ComputeBoundsFromPositions( iSamp.getPositions() )
                            );
 
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
 
         }
         else
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
     }
     else
     {
         // TODO this would all go away, remove the lightweight constructor
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
         SetPropUsePrevIfNull( m_numUProperty, iSamp.getNu() );
         SetPropUsePrevIfNull( m_numVProperty, iSamp.getNv() );
         SetPropUsePrevIfNull( m_uOrderProperty, iSamp.getUOrder() );
@@ -253,7 +259,8 @@ void ONuPatchSchema::set( const ONuPatchSchema::Sample &iSamp  )
         if ( m_velocitiesProperty )
         {
             SetPropUsePrevIfNull( m_velocitiesProperty,
-                                  iSamp.getVelocities() );
+                                  iSamp.getVelocities(),
+                                  iSamp.getVelocitiesPtr() );
         }
 
         // handle trim curves
@@ -275,18 +282,18 @@ void ONuPatchSchema::set( const ONuPatchSchema::Sample &iSamp  )
         // update bounds
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() )
                            );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.setFromPrevious();
+            setSelfBoundsFromPrevious();
         }
     }
 
@@ -313,17 +320,18 @@ void ONuPatchSchema::selectiveSet( const Sample &iSamp )
 
     if( m_positionsProperty )
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
 
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
     }
 
@@ -346,13 +354,15 @@ void ONuPatchSchema::selectiveSet( const Sample &iSamp )
 
     if ( m_velocitiesProperty )
     {
-        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() );
+        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                              iSamp.getVelocitiesPtr() );
     }
 
     if ( m_velocitiesProperty )
     {
         SetPropUsePrevIfNull( m_velocitiesProperty,
-                              iSamp.getVelocities() );
+                              iSamp.getVelocities(),
+                              iSamp.getVelocitiesPtr() );
     }
 
     // do we need to create uvs?
@@ -623,7 +633,7 @@ void ONuPatchSchema::setFromPrevious( )
     if( m_uKnotProperty ) { m_uKnotProperty.setFromPrevious(); }
     if( m_vKnotProperty ) { m_vKnotProperty.setFromPrevious(); }
 
-    m_selfBoundsProperty.setFromPrevious();
+    setSelfBoundsFromPrevious();
 
     // handle optional properties
     if ( m_velocitiesProperty ) { m_velocitiesProperty.setFromPrevious(); }
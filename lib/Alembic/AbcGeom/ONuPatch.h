@@ -103,7 +103,19 @@ public:
         // positions
         const Abc::P3fArraySample &getPositions() const { return m_positions; }
         void setPositions( const Abc::P3fArraySample &iSmp )
-        { m_positions = iSmp; }
+        { m_positions = iSmp; m_positionsPtr.reset(); }
+
+        //! Sets the positions from a sample the patch may keep hold of, so
+        //! the archive doesn't need to copy it before writing.  A NULL
+        //! iSmp unsets the positions.
+        void setPositions( const Abc::P3fArraySamplePtr &iSmp )
+        {
+            if ( iSmp ) { setPositions( *iSmp ); }
+            else { setPositions( Abc::P3fArraySample() ); }
+            m_positionsPtr = iSmp;
+        }
+        const Abc::P3fArraySamplePtr &getPositionsPtr() const
+        { return m_positionsPtr; }
 
         // position weights, if it isn't set, it's 1 for every point
         const Abc::FloatArraySample &getPositionWeights() const
@@ -159,7 +171,15 @@ public:
         // velocities accessor
         const Abc::V3fArraySample &getVelocities() const { return m_velocities; }
         void setVelocities( const Abc::V3fArraySample &iVelocities )
-        { m_velocities = iVelocities; }
+        { m_velocities = iVelocities; m_velocitiesPtr.reset(); }
+        void setVelocities( const Abc::V3fArraySamplePtr &iVelocities )
+        {
+            if ( iVelocities ) { setVelocities( *iVelocities ); }
+            else { setVelocities( Abc::V3fArraySample() ); }
+            m_velocitiesPtr = iVelocities;
+        }
+        const Abc::V3fArraySamplePtr &getVelocitiesPtr() const
+        { return m_velocitiesPtr; }
 
         // trim curves
         void setTrimCurve( const int32_t i_trim_nLoops,
@@ -210,6 +230,8 @@ public:
         {
             m_positions.reset();
             m_velocities.reset();
+            m_positionsPtr.reset();
+            m_velocitiesPtr.reset();
             m_numU = ABC_GEOM_NUPATCH_NULL_INT_VALUE;
             m_numV = ABC_GEOM_NUPATCH_NULL_INT_VALUE;
             m_uOrder = ABC_GEOM_NUPATCH_NULL_INT_VALUE;
@@ -265,6 +287,11 @@ public:
         // required properties
         Abc::P3fArraySample m_positions;
         Abc::V3fArraySample m_velocities;
+
+        // set alongside the samples above when the data was handed over
+        Abc::P3fArraySamplePtr m_positionsPtr;
+        Abc::V3fArraySamplePtr m_velocitiesPtr;
+
         int32_t m_numU;
         int32_t m_numV;
         int32_t m_uOrder;
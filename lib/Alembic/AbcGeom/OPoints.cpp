@@ -37,10 +37,109 @@
 #include <Alembic/AbcGeom/OPoints.h>
 #include <Alembic/AbcGeom/GeometryScope.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// spreads the low 21 bits of iVal out to every third bit
+Alembic::Util::uint64_t SpreadBits( Alembic::Util::uint64_t iVal )
+{
+    iVal &= 0x1fffff;
+    iVal = ( iVal | iVal << 32 ) & 0x1f00000000ffffULL;
+    iVal = ( iVal | iVal << 16 ) & 0x1f0000ff0000ffULL;
+    iVal = ( iVal | iVal << 8 ) & 0x100f00f00f00f00fULL;
+    iVal = ( iVal | iVal << 4 ) & 0x10c30c30c30c30c3ULL;
+    iVal = ( iVal | iVal << 2 ) & 0x1249249249249249ULL;
+    return iVal;
+}
+
+//-*****************************************************************************
+// Sorts the points along a Morton curve over their bounds and cuts them into
+// tiles of iTileSize, each of which is then put in bit reversed order, so
+// that any first part of it samples the whole tile.
+void ComputeTiles( const Abc::V3f * iPositions, size_t iNumPoints,
+                   size_t iTileSize, std::vector< size_t > & oOrder,
+                   std::vector< Alembic::Util::uint64_t > & oOffsets )
+{
+    Abc::Box3d bounds = ComputeBoundsFromPositions( iPositions, iNumPoints );
+
+    const double kMaxCoord = ( double ) 0x1fffff;
+    Abc::V3d scale( 0.0 );
+    for ( size_t j = 0; j < 3 && !bounds.isEmpty(); ++j )
+    {
+        double size = bounds.max[j] - bounds.min[j];
+        if ( size > 0.0 )
+        {
+            scale[j] = kMaxCoord / size;
+        }
+    }
+
+    std::vector< std::pair< Alembic::Util::uint64_t, size_t > > keys(
+        iNumPoints );
+    for ( size_t i = 0; i < iNumPoints; ++i )
+    {
+        Alembic::Util::uint64_t code = 0;
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            // NaNs end up at 0
+            double coord = ( iPositions[i][j] - bounds.min[j] ) * scale[j];
+            coord = coord > 0.0 ? std::min( coord, kMaxCoord ) : 0.0;
+            code |= SpreadBits( ( Alembic::Util::uint64_t ) coord ) << j;
+        }
+        keys[i] = std::make_pair( code, i );
+    }
+    std::sort( keys.begin(), keys.end() );
+
+    oOrder.resize( iNumPoints );
+    oOffsets.clear();
+    for ( size_t begin = 0; begin < iNumPoints; begin += iTileSize )
+    {
+        oOffsets.push_back( begin );
+
+        size_t count = std::min( iTileSize, iNumPoints - begin );
+        size_t numBits = 0;
+        while ( ( ( size_t ) 1 << numBits ) < count )
+        {
+            ++numBits;
+        }
+
+        size_t next = begin;
+        for ( size_t k = 0; k < ( ( size_t ) 1 << numBits ); ++k )
+        {
+            size_t reversed = 0;
+            for ( size_t b = 0; b < numBits; ++b )
+            {
+                reversed |= ( ( k >> b ) & 1 ) << ( numBits - 1 - b );
+            }
+
+            if ( reversed < count )
+            {
+                oOrder[next++] = keys[begin + reversed].second;
+            }
+        }
+    }
+    oOffsets.push_back( iNumPoints );
+}
+
+//-*****************************************************************************
+template < class T >
+void Reorder( const T * iVals, const std::vector< size_t > & iOrder,
+              std::vector< T > & oVals )
+{
+    oVals.resize( iOrder.size() );
+    for ( size_t i = 0; i < iOrder.size(); ++i )
+    {
+        oVals[i] = iVals[iOrder[i]];
+    }
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 OPointsSchema::OPointsSchema( AbcA::CompoundPropertyWriterPtr iParent,
                                   const std::string &iName,
@@ -101,6 +200,112 @@ OPointsSchema::OPointsSchema( Abc::OCompoundProperty iParent,
 
 //-*****************************************************************************
 void OPointsSchema::set( const Sample &iSamp )
+{
+    if ( m_tileSize > 0 && !m_selectiveExport )
+    {
+        setTiled( iSamp );
+    }
+    else
+    {
+        setPoints( iSamp );
+    }
+}
+
+//-*****************************************************************************
+void OPointsSchema::setTiled( const Sample &iSamp )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OPointsSchema::setTiled()" );
+
+    if ( !m_tileOffsetsProperty )
+    {
+        m_tileOffsetsProperty = Abc::OUInt64ArrayProperty( this->getPtr(),
+            ".tileOffsets", m_timeSamplingIndex );
+        m_tileBoundsProperty = Abc::OBox3dArrayProperty( this->getPtr(),
+            ".tileBnds", m_timeSamplingIndex );
+    }
+
+    // without new positions, the order stays the same
+    if ( !iSamp.getPositions() )
+    {
+        ABCA_ASSERT( !iSamp.getIds() && !iSamp.getVelocities() &&
+                     !iSamp.getWidths(),
+                     "Tiled points need positions for anything else" );
+
+        m_tileOffsetsProperty.setFromPrevious();
+        m_tileBoundsProperty.setFromPrevious();
+        setPoints( iSamp );
+    }
+    else
+    {
+        setTiledPoints( iSamp );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void OPointsSchema::setTiledPoints( const Sample &iSamp )
+{
+    size_t numPoints = iSamp.getPositions().size();
+    ABCA_ASSERT( iSamp.getIds() && iSamp.getIds().size() == numPoints,
+                 "Tiled points need an id for every point in every sample" );
+
+    std::vector< Alembic::Util::uint64_t > offsets;
+    ComputeTiles( iSamp.getPositions().get(), numPoints, m_tileSize,
+                  m_tileOrder, offsets );
+
+    Sample tiled;
+
+    std::vector< Abc::V3f > positions;
+    Reorder( iSamp.getPositions().get(), m_tileOrder, positions );
+    tiled.setPositions( Abc::P3fArraySample( positions ) );
+    tiled.setSelfBounds( iSamp.getSelfBounds() );
+
+    std::vector< Alembic::Util::uint64_t > ids;
+    Reorder( iSamp.getIds().get(), m_tileOrder, ids );
+    tiled.setIds( Abc::UInt64ArraySample( ids ) );
+
+    std::vector< Abc::V3f > velocities;
+    if ( iSamp.getVelocities() )
+    {
+        ABCA_ASSERT( iSamp.getVelocities().size() == numPoints,
+                     "Tiled points need a velocity for every point" );
+        Reorder( iSamp.getVelocities().get(), m_tileOrder, velocities );
+        tiled.setVelocities( Abc::V3fArraySample( velocities ) );
+    }
+
+    // widths that aren't per point stay as they are
+    OFloatGeomParam::Sample widths = iSamp.getWidths();
+    std::vector< float > widthVals;
+    std::vector< Alembic::Util::uint32_t > widthIndices;
+    if ( widths.getIndices() && widths.getIndices().size() == numPoints )
+    {
+        Reorder( widths.getIndices().get(), m_tileOrder, widthIndices );
+        widths.setIndices( Abc::UInt32ArraySample( widthIndices ) );
+    }
+    else if ( !widths.getIndices() && widths.getVals() &&
+              widths.getVals().size() == numPoints )
+    {
+        Reorder( widths.getVals().get(), m_tileOrder, widthVals );
+        widths.setVals( Abc::FloatArraySample( widthVals ) );
+    }
+    tiled.setWidths( widths );
+
+    std::vector< Abc::Box3d > tileBounds( offsets.size() - 1 );
+    for ( size_t i = 0; i < tileBounds.size(); ++i )
+    {
+        tileBounds[i] = ComputeBoundsFromPositions(
+            &positions.front() + offsets[i], offsets[i + 1] - offsets[i], 1 );
+    }
+
+    m_tileOffsetsProperty.set( Abc::UInt64ArraySample( offsets ) );
+    m_tileBoundsProperty.set( Abc::Box3dArraySample( tileBounds ) );
+
+    setPoints( tiled );
+}
+
+//-*****************************************************************************
+void OPointsSchema::setPoints( const Sample &iSamp )
 {
     if( m_selectiveExport || iSamp.isPartialSample() )
     {
@@ -129,10 +334,14 @@ void OPointsSchema::set( const Sample &iSamp )
         ABCA_ASSERT( iSamp.getPositions() &&
                      iSamp.getIds(),
                      "Sample 0 must have valid data for points and ids" );
-        m_positionsProperty.set( iSamp.getPositions() );
-        m_idsProperty.set( iSamp.getIds() );
-
-        if ( m_velocitiesProperty )
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
+        SetPropUsePrevIfNull( m_idsProperty, iSamp.getIds(),
+                              iSamp.getIdsPtr() );
+
+        if ( m_velocitiesProperty && iSamp.getVelocitiesPtr() )
+        { m_velocitiesProperty.set( iSamp.getVelocitiesPtr() ); }
+        else if ( m_velocitiesProperty )
         { m_velocitiesProperty.set( iSamp.getVelocities() ); }
 
         if ( m_widthsParam )
@@ -144,29 +353,32 @@ void OPointsSchema::set( const Sample &iSamp )
             // so we need a a placeholder variable.
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
-        else { m_selfBoundsProperty.set( iSamp.getSelfBounds() ); }
+        else { setSelfBounds( iSamp.getSelfBounds() ); }
     }
     else
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
-        SetPropUsePrevIfNull( m_idsProperty, iSamp.getIds() );
-        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
+        SetPropUsePrevIfNull( m_idsProperty, iSamp.getIds(),
+                              iSamp.getIdsPtr() );
+        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                              iSamp.getVelocitiesPtr() );
 
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.setFromPrevious();
+            setSelfBoundsFromPrevious();
         }
 
         if ( m_widthsParam )
@@ -190,21 +402,22 @@ void OPointsSchema::selectiveSet( const Sample &iSamp )
 
     if( m_positionsProperty )
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
 
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.setFromPrevious();
+            setSelfBoundsFromPrevious();
         }
     }
 
@@ -215,7 +428,8 @@ void OPointsSchema::selectiveSet( const Sample &iSamp )
 
     if( m_idsProperty )
     {
-        SetPropUsePrevIfNull( m_idsProperty, iSamp.getIds() );
+        SetPropUsePrevIfNull( m_idsProperty, iSamp.getIds(),
+                              iSamp.getIdsPtr() );
     }
 
     if ( iSamp.getVelocities() && !m_velocitiesProperty )
@@ -223,7 +437,11 @@ void OPointsSchema::selectiveSet( const Sample &iSamp )
         createVelocityProperty();
     }
 
-    if( m_velocitiesProperty )
+    if( m_velocitiesProperty && iSamp.getVelocitiesPtr() )
+    {
+        m_velocitiesProperty.set( iSamp.getVelocitiesPtr() );
+    }
+    else if( m_velocitiesProperty )
     {
         m_velocitiesProperty.set( iSamp.getVelocities() );
     }
@@ -250,9 +468,14 @@ void OPointsSchema::setFromPrevious()
 
     if ( m_positionsProperty ) { m_positionsProperty.setFromPrevious(); }
     if ( m_idsProperty ) { m_idsProperty.setFromPrevious(); }
-    if ( m_selfBoundsProperty ) { m_selfBoundsProperty.setFromPrevious(); }
+    if ( m_selfBoundsProperty ) { setSelfBoundsFromPrevious(); }
     if ( m_velocitiesProperty ) { m_velocitiesProperty.setFromPrevious(); }
     if ( m_widthsParam ) { m_widthsParam.setFromPrevious(); }
+    if ( m_tileOffsetsProperty )
+    {
+        m_tileOffsetsProperty.setFromPrevious();
+        m_tileBoundsProperty.setFromPrevious();
+    }
 
     ALEMBIC_ABC_SAFE_CALL_END();
 }
@@ -270,6 +493,11 @@ void OPointsSchema::setTimeSampling( uint32_t iIndex )
     if ( m_selfBoundsProperty ) { m_selfBoundsProperty.setTimeSampling( iIndex ); }
     if ( m_widthsParam ) { m_widthsParam.setTimeSampling( iIndex ); }
     if ( m_velocitiesProperty ) { m_velocitiesProperty.setTimeSampling( iIndex ); }
+    if ( m_tileOffsetsProperty )
+    {
+        m_tileOffsetsProperty.setTimeSampling( iIndex );
+        m_tileBoundsProperty.setTimeSampling( iIndex );
+    }
 
     ALEMBIC_ABC_SAFE_CALL_END();
 }
@@ -289,6 +517,19 @@ void OPointsSchema::setTimeSampling( AbcA::TimeSamplingPtr iTime )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void OPointsSchema::setTileSize( size_t iPointsPerTile )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OPointsSchema::setTileSize()" );
+
+    ABCA_ASSERT( m_numSamples == 0 || iPointsPerTile == m_tileSize,
+                 "Points can only be tiled from the first sample on" );
+
+    m_tileSize = iPointsPerTile;
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void OPointsSchema::init( uint32_t iTsIdx, bool isSparse )
 {
@@ -300,6 +541,8 @@ void OPointsSchema::init( uint32_t iTsIdx, bool isSparse )
 
     m_timeSamplingIndex = iTsIdx;
 
+    m_tileSize = 0;
+
     if ( m_selectiveExport )
     {
         return;
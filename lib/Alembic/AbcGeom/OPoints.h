@@ -89,17 +89,45 @@ public:
         // positions accessor
         const Abc::P3fArraySample &getPositions() const { return m_positions; }
         void setPositions( const Abc::P3fArraySample &iSmp )
-        { m_positions = iSmp; }
+        { m_positions = iSmp; m_positionsPtr.reset(); }
+
+        //! Sets the positions from a sample the points may keep hold of, so
+        //! the archive doesn't need to copy it before writing.  A NULL
+        //! iSmp unsets the positions.
+        void setPositions( const Abc::P3fArraySamplePtr &iSmp )
+        {
+            if ( iSmp ) { setPositions( *iSmp ); }
+            else { setPositions( Abc::P3fArraySample() ); }
+            m_positionsPtr = iSmp;
+        }
+        const Abc::P3fArraySamplePtr &getPositionsPtr() const
+        { return m_positionsPtr; }
 
         // ids accessor
         const Abc::UInt64ArraySample &getIds() const { return m_ids; }
         void setIds( const Abc::UInt64ArraySample &iSmp )
-        { m_ids = iSmp; }
+        { m_ids = iSmp; m_idsPtr.reset(); }
+        void setIds( const Abc::UInt64ArraySamplePtr &iSmp )
+        {
+            if ( iSmp ) { setIds( *iSmp ); }
+            else { setIds( Abc::UInt64ArraySample() ); }
+            m_idsPtr = iSmp;
+        }
+        const Abc::UInt64ArraySamplePtr &getIdsPtr() const
+        { return m_idsPtr; }
 
         // velocities accessor
         const Abc::V3fArraySample &getVelocities() const { return m_velocities; }
         void setVelocities( const Abc::V3fArraySample &iVelocities )
-        { m_velocities = iVelocities; }
+        { m_velocities = iVelocities; m_velocitiesPtr.reset(); }
+        void setVelocities( const Abc::V3fArraySamplePtr &iVelocities )
+        {
+            if ( iVelocities ) { setVelocities( *iVelocities ); }
+            else { setVelocities( Abc::V3fArraySample() ); }
+            m_velocitiesPtr = iVelocities;
+        }
+        const Abc::V3fArraySamplePtr &getVelocitiesPtr() const
+        { return m_velocitiesPtr; }
 
         // widths accessor
         const OFloatGeomParam::Sample &getWidths() const { return m_widths; }
@@ -116,6 +144,9 @@ public:
             m_velocities.reset();
             m_ids.reset();
             m_widths.reset();
+            m_positionsPtr.reset();
+            m_velocitiesPtr.reset();
+            m_idsPtr.reset();
 
             m_selfBounds.makeEmpty();
         }
@@ -137,6 +168,11 @@ public:
         OFloatGeomParam::Sample m_widths;
 
         Abc::Box3d m_selfBounds;
+
+        // set alongside the samples above when the data was handed over
+        Abc::P3fArraySamplePtr m_positionsPtr;
+        Abc::V3fArraySamplePtr m_velocitiesPtr;
+        Abc::UInt64ArraySamplePtr m_idsPtr;
     };
 
     //-*************************************************************************
@@ -158,6 +194,7 @@ public:
         m_selectiveExport = false;
         m_numSamples = 0;
         m_timeSamplingIndex = 0;
+        m_tileSize = 0;
     }
 
     //! This constructor creates a new poly mesh writer.
@@ -229,6 +266,24 @@ public:
     void setTimeSampling( uint32_t iIndex );
     void setTimeSampling( AbcA::TimeSamplingPtr iTime );
 
+    //! Writes the points of every sample spatially tiled: sorted along a
+    //! Morton curve and cut into tiles of iPointsPerTile points, whose bounds
+    //! and offsets are written alongside, and ordered within each tile so
+    //! that any first part of it is spread evenly over it.
+    //! IPointsSchema::getTiled can then read just the tiles in a region, or
+    //! a lower level of detail.  Ids, velocities and per point widths are
+    //! reordered along with the positions, arbGeomParams aren't, see
+    //! getTileOrder.  Has to be called before the first sample is set, 0
+    //! (the default) writes the points as they are given.
+    void setTileSize( size_t iPointsPerTile );
+
+    size_t getTileSize() const { return m_tileSize; }
+
+    //! The order the points of the last tiled sample were written in: point
+    //! i in the archive is point getTileOrder()[i] of the sample.
+    const std::vector< size_t > & getTileOrder() const
+    { return m_tileOrder; }
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, validity,
@@ -269,6 +324,12 @@ private:
     //! another file.
     void selectiveSet( const Sample &iSamp );
 
+    //! Sorts iSamp into tiles and sets that.
+    void setTiled( const Sample &iSamp );
+    void setTiledPoints( const Sample &iSamp );
+
+    void setPoints( const Sample &iSamp );
+
     void createPositionProperty();
     void createIdProperty();
     void createVelocityProperty();
@@ -288,6 +349,11 @@ private:
 
     uint32_t m_timeSamplingIndex;
 
+    // points per tile, 0 when not tiling
+    size_t m_tileSize;
+    Abc::OUInt64ArrayProperty m_tileOffsetsProperty;
+    Abc::OBox3dArrayProperty m_tileBoundsProperty;
+    std::vector< size_t > m_tileOrder;
 };
 
 //-*****************************************************************************
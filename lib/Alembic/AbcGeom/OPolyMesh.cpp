@@ -138,12 +138,18 @@ void OPolyMeshSchema::set( const Sample &iSamp )
                      iSamp.getFaceCounts(),
                      "Sample 0 must have valid data for all mesh components" );
 
-        m_positionsProperty.set( iSamp.getPositions() );
-        m_indicesProperty.set( iSamp.getFaceIndices() );
-        m_countsProperty.set( iSamp.getFaceCounts() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
+        SetPropUsePrevIfNull( m_indicesProperty, iSamp.getFaceIndices(),
+                              iSamp.getFaceIndicesPtr() );
+        SetPropUsePrevIfNull( m_countsProperty, iSamp.getFaceCounts(),
+                              iSamp.getFaceCountsPtr() );
 
         if ( m_velocitiesProperty )
-        { SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() ); }
+        {
+            SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                                  iSamp.getVelocitiesPtr() );
+        }
 
         if ( iSamp.getSelfBounds().isEmpty() )
         {
@@ -151,11 +157,11 @@ void OPolyMeshSchema::set( const Sample &iSamp )
             // so we need a a placeholder variable.
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
 
         if ( iSamp.getUVs().getVals() )
@@ -169,28 +175,32 @@ void OPolyMeshSchema::set( const Sample &iSamp )
     }
     else
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
-        SetPropUsePrevIfNull( m_indicesProperty, iSamp.getFaceIndices() );
-        SetPropUsePrevIfNull( m_countsProperty, iSamp.getFaceCounts() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
+        SetPropUsePrevIfNull( m_indicesProperty, iSamp.getFaceIndices(),
+                              iSamp.getFaceIndicesPtr() );
+        SetPropUsePrevIfNull( m_countsProperty, iSamp.getFaceCounts(),
+                              iSamp.getFaceCountsPtr() );
 
         if ( m_velocitiesProperty )
         {
-            SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() );
+            SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                                  iSamp.getVelocitiesPtr() );
         }
 
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.setFromPrevious();
+            setSelfBoundsFromPrevious();
         }
 
         // OGeomParam will automatically use SetPropUsePrevIfNull internally
@@ -321,7 +331,7 @@ void OPolyMeshSchema::setFromPrevious()
     if( m_indicesProperty ) m_indicesProperty.setFromPrevious();
     if( m_countsProperty )m_countsProperty.setFromPrevious();
 
-    if( m_selfBoundsProperty ) m_selfBoundsProperty.setFromPrevious();
+    if( m_selfBoundsProperty ) setSelfBoundsFromPrevious();
 
     if ( m_velocitiesProperty ) { m_velocitiesProperty.setFromPrevious(); }
     if ( m_uvsParam ) { m_uvsParam.setFromPrevious(); }
@@ -504,16 +514,17 @@ void OPolyMeshSchema::selectiveSet( const Sample &iSamp )
 
     if ( m_positionsProperty )
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
     }
 
@@ -525,7 +536,8 @@ void OPolyMeshSchema::selectiveSet( const Sample &iSamp )
 
     if ( m_velocitiesProperty )
     {
-        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() );
+        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                              iSamp.getVelocitiesPtr() );
     }
 
     //! UVs
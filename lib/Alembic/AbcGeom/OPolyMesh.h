@@ -88,20 +88,56 @@ public:
 
         const Abc::P3fArraySample &getPositions() const { return m_positions; }
         void setPositions( const Abc::P3fArraySample &iSmp )
-        { m_positions = iSmp; }
+        { m_positions = iSmp; m_positionsPtr.reset(); }
+
+        //! Sets the positions from a sample the mesh may keep hold of, so
+        //! the archive doesn't need to copy it before writing.  A NULL
+        //! iSmp unsets the positions.
+        void setPositions( const Abc::P3fArraySamplePtr &iSmp )
+        {
+            if ( iSmp ) { setPositions( *iSmp ); }
+            else { setPositions( Abc::P3fArraySample() ); }
+            m_positionsPtr = iSmp;
+        }
+        const Abc::P3fArraySamplePtr &getPositionsPtr() const
+        { return m_positionsPtr; }
 
         // velocities accessor
         const Abc::V3fArraySample &getVelocities() const { return m_velocities; }
         void setVelocities( const Abc::V3fArraySample &iVelocities )
-        { m_velocities = iVelocities; }
+        { m_velocities = iVelocities; m_velocitiesPtr.reset(); }
+        void setVelocities( const Abc::V3fArraySamplePtr &iVelocities )
+        {
+            if ( iVelocities ) { setVelocities( *iVelocities ); }
+            else { setVelocities( Abc::V3fArraySample() ); }
+            m_velocitiesPtr = iVelocities;
+        }
+        const Abc::V3fArraySamplePtr &getVelocitiesPtr() const
+        { return m_velocitiesPtr; }
 
         const Abc::Int32ArraySample &getFaceIndices() const { return m_indices; }
         void setFaceIndices( const Abc::Int32ArraySample &iSmp )
-        { m_indices = iSmp; }
+        { m_indices = iSmp; m_indicesPtr.reset(); }
+        void setFaceIndices( const Abc::Int32ArraySamplePtr &iSmp )
+        {
+            if ( iSmp ) { setFaceIndices( *iSmp ); }
+            else { setFaceIndices( Abc::Int32ArraySample() ); }
+            m_indicesPtr = iSmp;
+        }
+        const Abc::Int32ArraySamplePtr &getFaceIndicesPtr() const
+        { return m_indicesPtr; }
 
         const Abc::Int32ArraySample &getFaceCounts() const { return m_counts; }
         void setFaceCounts( const Abc::Int32ArraySample &iCnt )
-        { m_counts = iCnt; }
+        { m_counts = iCnt; m_countsPtr.reset(); }
+        void setFaceCounts( const Abc::Int32ArraySamplePtr &iCnt )
+        {
+            if ( iCnt ) { setFaceCounts( *iCnt ); }
+            else { setFaceCounts( Abc::Int32ArraySample() ); }
+            m_countsPtr = iCnt;
+        }
+        const Abc::Int32ArraySamplePtr &getFaceCountsPtr() const
+        { return m_countsPtr; }
 
         const Abc::Box3d &getSelfBounds() const { return m_selfBounds; }
         void setSelfBounds( const Abc::Box3d &iBnds )
@@ -120,10 +156,14 @@ public:
             m_positions.reset();
             m_indices.reset();
             m_counts.reset();
+            m_positionsPtr.reset();
+            m_indicesPtr.reset();
+            m_countsPtr.reset();
 
             m_selfBounds.makeEmpty();
 
             m_velocities.reset();
+            m_velocitiesPtr.reset();
             m_uvs.reset();
             m_normals.reset();
         }
@@ -152,6 +192,12 @@ public:
         OV2fGeomParam::Sample m_uvs;
         ON3fGeomParam::Sample m_normals;
 
+        // set alongside the samples above when the data was handed over
+        Abc::P3fArraySamplePtr m_positionsPtr;
+        Abc::Int32ArraySamplePtr m_indicesPtr;
+        Abc::Int32ArraySamplePtr m_countsPtr;
+        Abc::V3fArraySamplePtr m_velocitiesPtr;
+
     };
     //-*************************************************************************
     // POLY MESH SCHEMA
@@ -175,13 +175,17 @@ void OSubDSchema::set( const Sample &iSamp )
                      iSamp.getFaceCounts(),
                      "Sample 0 must have valid data for all mesh components" );
 
-        m_positionsProperty.set( iSamp.getPositions() );
-        m_faceIndicesProperty.set( iSamp.getFaceIndices() );
-        m_faceCountsProperty.set( iSamp.getFaceCounts() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
+        SetPropUsePrevIfNull( m_faceIndicesProperty, iSamp.getFaceIndices(),
+                              iSamp.getFaceIndicesPtr() );
+        SetPropUsePrevIfNull( m_faceCountsProperty, iSamp.getFaceCounts(),
+                              iSamp.getFaceCountsPtr() );
 
         if ( m_velocitiesProperty )
         {
-            SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() );
+            SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                                  iSamp.getVelocitiesPtr() );
         }
 
         if ( iSamp.getSelfBounds().isEmpty() )
@@ -191,11 +195,11 @@ void OSubDSchema::set( const Sample &iSamp )
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() )
                            );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
 
         if ( iSamp.getUVs().getVals() )
@@ -287,9 +291,12 @@ void OSubDSchema::set( const Sample &iSamp )
     }
     else
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
-        SetPropUsePrevIfNull( m_faceIndicesProperty, iSamp.getFaceIndices() );
-        SetPropUsePrevIfNull( m_faceCountsProperty, iSamp.getFaceCounts() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
+        SetPropUsePrevIfNull( m_faceIndicesProperty, iSamp.getFaceIndices(),
+                              iSamp.getFaceIndicesPtr() );
+        SetPropUsePrevIfNull( m_faceCountsProperty, iSamp.getFaceCounts(),
+                              iSamp.getFaceCountsPtr() );
 
         if ( m_faceVaryingInterpolateBoundaryProperty )
         {
@@ -357,23 +364,24 @@ void OSubDSchema::set( const Sample &iSamp )
 
         if ( m_velocitiesProperty )
         {
-            SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() );
+            SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                                  iSamp.getVelocitiesPtr() );
         }
 
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() )
                            );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
         else
         {
-            m_selfBoundsProperty.setFromPrevious();
+            setSelfBoundsFromPrevious();
         }
 
         if ( m_uvsParam )
@@ -569,7 +577,7 @@ void OSubDSchema::setFromPrevious()
         m_subdSchemeProperty.setFromPrevious();
     }
 
-    m_selfBoundsProperty.setFromPrevious();
+    setSelfBoundsFromPrevious();
 
     if ( m_velocitiesProperty ) { m_velocitiesProperty.setFromPrevious(); }
 
@@ -869,16 +877,17 @@ void OSubDSchema::selectiveSet( const Sample &iSamp )
 
     if ( m_positionsProperty )
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
+        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions(),
+                              iSamp.getPositionsPtr() );
         if ( iSamp.getSelfBounds().hasVolume() )
         {
-            m_selfBoundsProperty.set( iSamp.getSelfBounds() );
+            setSelfBounds( iSamp.getSelfBounds() );
         }
         else if ( iSamp.getPositions() )
         {
             Abc::Box3d bnds(
                 ComputeBoundsFromPositions( iSamp.getPositions() ) );
-            m_selfBoundsProperty.set( bnds );
+            setSelfBounds( bnds );
         }
     }
 
@@ -890,7 +899,8 @@ void OSubDSchema::selectiveSet( const Sample &iSamp )
 
     if ( m_velocitiesProperty )
     {
-        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities() );
+        SetPropUsePrevIfNull( m_velocitiesProperty, iSamp.getVelocities(),
+                              iSamp.getVelocitiesPtr() );
     }
 
     //! UVs
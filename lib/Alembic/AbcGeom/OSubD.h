@@ -109,15 +109,43 @@ public:
         // main stuff
         const Abc::P3fArraySample &getPositions() const { return m_positions; }
         void setPositions( const Abc::P3fArraySample &iSmp )
-        { m_positions = iSmp; }
+        { m_positions = iSmp; m_positionsPtr.reset(); }
+
+        //! Sets the positions from a sample the subd may keep hold of, so
+        //! the archive doesn't need to copy it before writing.  A NULL
+        //! iSmp unsets the positions.
+        void setPositions( const Abc::P3fArraySamplePtr &iSmp )
+        {
+            if ( iSmp ) { setPositions( *iSmp ); }
+            else { setPositions( Abc::P3fArraySample() ); }
+            m_positionsPtr = iSmp;
+        }
+        const Abc::P3fArraySamplePtr &getPositionsPtr() const
+        { return m_positionsPtr; }
 
         const Abc::Int32ArraySample &getFaceIndices() const { return m_faceIndices; }
         void setFaceIndices( const Abc::Int32ArraySample &iSmp )
-        { m_faceIndices = iSmp; }
+        { m_faceIndices = iSmp; m_faceIndicesPtr.reset(); }
+        void setFaceIndices( const Abc::Int32ArraySamplePtr &iSmp )
+        {
+            if ( iSmp ) { setFaceIndices( *iSmp ); }
+            else { setFaceIndices( Abc::Int32ArraySample() ); }
+            m_faceIndicesPtr = iSmp;
+        }
+        const Abc::Int32ArraySamplePtr &getFaceIndicesPtr() const
+        { return m_faceIndicesPtr; }
 
         const Abc::Int32ArraySample &getFaceCounts() const { return m_faceCounts; }
         void setFaceCounts( const Abc::Int32ArraySample &iCnt )
-        { m_faceCounts = iCnt; }
+        { m_faceCounts = iCnt; m_faceCountsPtr.reset(); }
+        void setFaceCounts( const Abc::Int32ArraySamplePtr &iCnt )
+        {
+            if ( iCnt ) { setFaceCounts( *iCnt ); }
+            else { setFaceCounts( Abc::Int32ArraySample() ); }
+            m_faceCountsPtr = iCnt;
+        }
+        const Abc::Int32ArraySamplePtr &getFaceCountsPtr() const
+        { return m_faceCountsPtr; }
 
 
         // misc subd stuff
@@ -208,7 +236,15 @@ public:
         // velocities accessor
         const Abc::V3fArraySample &getVelocities() const { return m_velocities; }
         void setVelocities( const Abc::V3fArraySample &iVelocities )
-        { m_velocities = iVelocities; }
+        { m_velocities = iVelocities; m_velocitiesPtr.reset(); }
+        void setVelocities( const Abc::V3fArraySamplePtr &iVelocities )
+        {
+            if ( iVelocities ) { setVelocities( *iVelocities ); }
+            else { setVelocities( Abc::V3fArraySample() ); }
+            m_velocitiesPtr = iVelocities;
+        }
+        const Abc::V3fArraySamplePtr &getVelocitiesPtr() const
+        { return m_velocitiesPtr; }
 
         // UVs; need to set these outside the Sample constructor
         const OV2fGeomParam::Sample &getUVs() const { return m_uvs; }
@@ -220,6 +256,9 @@ public:
             m_positions.reset();
             m_faceIndices.reset();
             m_faceCounts.reset();
+            m_positionsPtr.reset();
+            m_faceIndicesPtr.reset();
+            m_faceCountsPtr.reset();
 
             m_faceVaryingInterpolateBoundary = ABC_GEOM_SUBD_NULL_INT_VALUE;
             m_faceVaryingPropagateCorners = ABC_GEOM_SUBD_NULL_INT_VALUE;
@@ -237,6 +276,7 @@ public:
             m_subdScheme = "catmull-clark";
 
             m_velocities.reset();
+            m_velocitiesPtr.reset();
 
             m_selfBounds.makeEmpty();
 
@@ -297,6 +337,12 @@ public:
         // UVs
         OV2fGeomParam::Sample m_uvs;
 
+        // set alongside the samples above when the data was handed over
+        Abc::P3fArraySamplePtr m_positionsPtr;
+        Abc::Int32ArraySamplePtr m_faceIndicesPtr;
+        Abc::Int32ArraySamplePtr m_faceCountsPtr;
+        Abc::V3fArraySamplePtr m_velocitiesPtr;
+
     }; // end OSubDSchema::Sample
 
     //-*************************************************************************
@@ -36,6 +36,7 @@
 
 #include <Alembic/AbcGeom/OXform.h>
 #include <Alembic/AbcGeom/XformOp.h>
+#include <Alembic/AbcGeom/ArchiveBounds.h>
 #include <algorithm>
 #define MAX_SCALAR_CHANS 256
 
@@ -222,6 +223,8 @@ void OXformSchema::set( XformSample &ioSamp )
 
     m_inheritsProperty.set( ioSamp.getInheritsXforms() );
 
+    OChildBoundsWriter::RecordXform( *this, &ioSamp );
+
     if ( ! m_opsPWPtr ) { return; }
 
     std::vector<double> chanvals;
@@ -289,6 +292,8 @@ void OXformSchema::setFromPrevious()
 
     m_inheritsProperty.setFromPrevious();
 
+    OChildBoundsWriter::RecordXform( *this, NULL );
+
     m_opsPWPtr->setFromPreviousSample();
 
     if ( m_valsPWPtr )
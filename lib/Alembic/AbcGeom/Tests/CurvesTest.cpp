@@ -278,6 +278,181 @@ void sparseTest()
     }
 }
 
+//-*****************************************************************************
+// Hands the positions and vertex counts over to an asynchronous archive,
+// which has to keep them alive after the sample lets go of them.
+void ownedSampleTest()
+{
+    std::string name = "curvesOwnedTest.abc";
+    {
+        Alembic::AbcCoreOgawa::WriteArchive writer;
+        writer.setAsyncWrites( 2 );
+        OArchive archive( writer, name );
+        OCurves curvesObj( OObject( archive, kTop ), "owned" );
+
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            V3f * verts = new V3f[g_totalVerts];
+            for ( size_t j = 0; j < g_totalVerts; ++j )
+            {
+                verts[j] = V3f( g_verts[j * 3], g_verts[j * 3 + 1],
+                                g_verts[j * 3 + 2] + i );
+            }
+
+            Alembic::Util::int32_t * numVerts =
+                new Alembic::Util::int32_t[g_numCurves];
+            std::copy( g_numVerts, g_numVerts + g_numCurves, numVerts );
+
+            OCurvesSchema::Sample samp;
+            samp.setPositions( P3fArraySamplePtr(
+                new P3fArraySample( verts, g_totalVerts ),
+                AbcA::TArrayDeleter< V3f >() ) );
+            samp.setCurvesNumVertices( Int32ArraySamplePtr(
+                new Int32ArraySample( numVerts, g_numCurves ),
+                AbcA::TArrayDeleter< Alembic::Util::int32_t >() ) );
+            TESTING_ASSERT( samp.getPositionsPtr() &&
+                            samp.getCurvesNumVerticesPtr() );
+
+            // a NULL pointer unsets the sample like any other
+            samp.setVelocities( V3fArraySamplePtr() );
+            TESTING_ASSERT( !samp.getVelocities() );
+
+            // and an owned, unset sample repeats the previous one
+            if ( i == 2 )
+            {
+                samp.setPositions( P3fArraySamplePtr(
+                    new P3fArraySample() ) );
+            }
+            curvesObj.getSchema().set( samp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    ICurvesSchema curves = ICurves( IObject( archive, kTop ),
+                                    "owned" ).getSchema();
+    TESTING_ASSERT( curves.getNumSamples() == 3 );
+    for ( size_t i = 0; i < 3; ++i )
+    {
+        ICurvesSchema::Sample samp;
+        curves.get( samp, i );
+        TESTING_ASSERT( samp.getNumCurves() == g_numCurves );
+        TESTING_ASSERT( ( *samp.getCurvesNumVertices() )[1] ==
+                        g_numVerts[1] );
+        TESTING_ASSERT( samp.getPositions()->size() == g_totalVerts );
+        TESTING_ASSERT( ( *samp.getPositions() )[2].z ==
+                        g_verts[8] + std::min( i, ( size_t ) 1 ) );
+    }
+}
+
+//-*****************************************************************************
+void batchTest()
+{
+    std::string name = "curvesBatchTest.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OCurves hairObj( OObject( archive, kTop ), "hair" );
+
+        // two linear curves, the second frame moves them up by 1
+        Alembic::Util::int32_t numVerts[2] = { 3, 2 };
+        float widths[2] = { 2.0f, 4.0f };
+        OFloatGeomParam::Sample widthSamp(
+            FloatArraySample( widths, 2 ), kUniformScope );
+        for ( size_t i = 0; i < 2; ++i )
+        {
+            float y = ( float ) i;
+            V3f verts[5] = { V3f( 0, y, 0 ), V3f( 1, y, 0 ), V3f( 1, y + 1, 0 ),
+                             V3f( 0, y, 0 ), V3f( 0, y, 4 ) };
+            OCurvesSchema::Sample samp(
+                V3fArraySample( verts, 5 ), Int32ArraySample( numVerts, 2 ),
+                kLinear, kNonPeriodic, widthSamp );
+            hairObj.getSchema().set( samp );
+        }
+
+        // one bezier curve with a width at each end of its 2 segments
+        OCurves bezierObj( OObject( archive, kTop ), "bezier" );
+        V3f bezierVerts[7];
+        for ( size_t i = 0; i < 7; ++i )
+        {
+            bezierVerts[i] = V3f( ( float ) i, 0, 0 );
+        }
+        Alembic::Util::int32_t bezierNumVerts = 7;
+        float varyingWidths[3] = { 1.0f, 2.0f, 3.0f };
+        OCurvesSchema::Sample bezierSamp(
+            V3fArraySample( bezierVerts, 7 ),
+            Int32ArraySample( &bezierNumVerts, 1 ), kCubic, kNonPeriodic,
+            OFloatGeomParam::Sample( FloatArraySample( varyingWidths, 3 ),
+                                     kVaryingScope ),
+            OV2fGeomParam::Sample(), ON3fGeomParam::Sample(), kBezierBasis );
+        bezierObj.getSchema().set( bezierSamp );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    ICurves hairObj( IObject( archive, kTop ), "hair" );
+
+    ICurvesBatch batch( hairObj.getSchema() );
+    TESTING_ASSERT( batch.topologyChanged() );
+    TESTING_ASSERT( batch.changed() );
+    TESTING_ASSERT( batch.getNumCurves() == 2 );
+    TESTING_ASSERT( batch.getNumVertices() == 5 );
+    TESTING_ASSERT( batch.getVertexOffsets()[0] == 0 );
+    TESTING_ASSERT( batch.getVertexOffsets()[1] == 3 );
+    TESTING_ASSERT( batch.getVertexOffsets()[2] == 5 );
+
+    const float * widths = batch.getWidths();
+    TESTING_ASSERT( widths[0] == 2.0f && widths[2] == 2.0f );
+    TESTING_ASSERT( widths[3] == 4.0f && widths[4] == 4.0f );
+
+    // grown by half of the width
+    TESTING_ASSERT( batch.getCurveBounds()[0].min == V3f( -1, -1, -1 ) );
+    TESTING_ASSERT( batch.getCurveBounds()[0].max == V3f( 2, 2, 1 ) );
+    TESTING_ASSERT( batch.getCurveBounds()[1].min == V3f( -2, -2, -2 ) );
+    TESTING_ASSERT( batch.getCurveBounds()[1].max == V3f( 2, 2, 6 ) );
+
+    // same topology, so just the positions and bounds change
+    batch.load( ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( !batch.topologyChanged() );
+    TESTING_ASSERT( batch.getPositions()[2] == V3f( 1, 2, 0 ) );
+    TESTING_ASSERT( batch.getCurveBounds()[0].max == V3f( 2, 3, 1 ) );
+    TESTING_ASSERT( batch.getWidths()[4] == 4.0f );
+    TESTING_ASSERT( batch.changed() );
+
+    // the same keys again, so nothing is read or computed, every sample
+    // read from Ogawa is a new allocation so the positions would move if it
+    // had been
+    const V3f * positions = batch.getPositions();
+    batch.load( ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( !batch.changed() );
+    TESTING_ASSERT( !batch.topologyChanged() );
+    TESTING_ASSERT( batch.getPositions() == positions );
+    TESTING_ASSERT( batch.getCurveBounds()[0].max == V3f( 2, 3, 1 ) );
+
+    // 3 vertices evenly spaced along each curve, on as many threads as we can
+    ICurvesBatch resampled( hairObj.getSchema(), 3, 4 );
+    TESTING_ASSERT( resampled.getNumVertices() == 6 );
+    TESTING_ASSERT( resampled.getVertexOffsets()[1] == 3 );
+    const V3f * p = resampled.getPositions();
+    TESTING_ASSERT( p[0] == V3f( 0, 0, 0 ) && p[1] == V3f( 1, 0, 0 ) &&
+                    p[2] == V3f( 1, 1, 0 ) );
+    TESTING_ASSERT( p[3] == V3f( 0, 0, 0 ) && p[4] == V3f( 0, 0, 2 ) &&
+                    p[5] == V3f( 0, 0, 4 ) );
+    TESTING_ASSERT( resampled.getWidths()[4] == 4.0f );
+
+    resampled.setResampleCount( 0 );
+    resampled.load( ISampleSelector() );
+    TESTING_ASSERT( resampled.getNumVertices() == 5 );
+    TESTING_ASSERT( resampled.getPositions()[4] == V3f( 0, 0, 4 ) );
+
+    // varying widths are spread along the vertices of each segment
+    ICurves bezierObj( IObject( archive, kTop ), "bezier" );
+    ICurvesBatch bezier( bezierObj.getSchema() );
+    widths = bezier.getWidths();
+    TESTING_ASSERT( widths[0] == 1.0f && widths[3] == 2.0f &&
+                    widths[6] == 3.0f );
+    TESTING_ASSERT( widths[1] > 1.0f && widths[1] < widths[2] &&
+                    widths[2] < 2.0f );
+    TESTING_ASSERT( bezier.getCurveBounds()[0].max == V3f( 7.5, 1.5, 1.5 ) );
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -305,5 +480,9 @@ int main( int argc, char *argv[] )
 
     sparseTest();
 
+    ownedSampleTest();
+
+    batchTest();
+
     return 0;
 }
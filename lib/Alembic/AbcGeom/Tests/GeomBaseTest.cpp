@@ -547,6 +547,113 @@ void LayeredIndexedGeomParamTest()
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
+//-*****************************************************************************
+// the same data type and interpretation as V2fTPTraits, but not the same type
+ALEMBIC_ABC_DECLARE_TYPE_TRAITS( V2f, kFloat32POD, 2, "vector",
+                                 OtherV2fTPTraits );
+
+//-*****************************************************************************
+void ExpandedGeomParamCacheTest()
+{
+    // enough indices for the expansion to be split over threads
+    const size_t numVals = 1000;
+    const size_t numIndices = 1500007;
+    {
+        std::vector< V2f > vals( numVals );
+        for ( size_t i = 0; i < numVals; ++i )
+        {
+            vals[i] = V2f( ( float ) i, -( float ) i );
+        }
+
+        std::vector< Alembic::Util::uint32_t > indices( numIndices );
+        for ( size_t i = 0; i < numIndices; ++i )
+        {
+            indices[i] = ( i * 7 ) % numVals;
+        }
+
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "expandedGeomParam.abc" );
+        OCompoundProperty prop = archive.getTop().getProperties();
+
+        OV2fGeomParam uvs( prop, "uvs", true, kFacevaryingScope, 1 );
+        OV2fGeomParam::Sample samp( V2fArraySample( vals ),
+                                    UInt32ArraySample( indices ),
+                                    kFacevaryingScope );
+        uvs.set( samp );
+        uvs.set( samp );
+        indices[0] = 3;
+        uvs.set( samp );
+
+        OV2fGeomParam flat( prop, "flat", false, kVertexScope, 1 );
+        flat.set( OV2fGeomParam::Sample( V2fArraySample( vals ),
+                                         kVertexScope ) );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "expandedGeomParam.abc" );
+    ICompoundProperty prop = archive.getTop().getProperties();
+    IV2fGeomParam uvs( prop, "uvs" );
+
+    IV2fGeomParam::Sample samp0 = uvs.getExpandedValue( 0 );
+    TESTING_ASSERT( samp0.getVals()->size() == numIndices );
+    for ( size_t i = 0; i < numIndices; ++i )
+    {
+        TESTING_ASSERT( ( *samp0.getVals() )[i].x ==
+                        ( float )( ( i * 7 ) % numVals ) );
+    }
+
+    // the same values and indices give back the same expansion
+    IV2fGeomParam::Sample samp1 = uvs.getExpandedValue( 1 );
+    TESTING_ASSERT( samp0.getVals() == samp1.getVals() );
+    TESTING_ASSERT( uvs.getExpandedValue( 0 ).getVals() == samp0.getVals() );
+
+    IV2fGeomParam::Sample samp2 = uvs.getExpandedValue( 2 );
+    TESTING_ASSERT( samp2.getVals() != samp0.getVals() );
+    TESTING_ASSERT( ( *samp2.getVals() )[0].x == 3.0f );
+    TESTING_ASSERT( ( *samp2.getVals() )[1].x == 7.0f );
+
+    // other traits never get a sample of the wrong type
+    ITypedGeomParam< OtherV2fTPTraits > otherUvs( prop, "uvs" );
+    ITypedGeomParam< OtherV2fTPTraits >::Sample other0 =
+        otherUvs.getExpandedValue( 0 );
+    TESTING_ASSERT( other0.getVals()->size() == numIndices );
+    TESTING_ASSERT( ( void * ) other0.getVals().get() !=
+                    ( void * ) samp0.getVals().get() );
+    TESTING_ASSERT( otherUvs.getExpandedValue( 1 ).getVals() ==
+                    other0.getVals() );
+
+    // once nobody holds on to it, the expansion is gone
+    Alembic::Util::weak_ptr< V2fArraySample > weak = samp2.getVals();
+    samp2.reset();
+    TESTING_ASSERT( weak.expired() );
+    TESTING_ASSERT( ( *uvs.getExpandedValue( 2 ).getVals() )[0].x == 3.0f );
+
+    // no indices share the identity indices
+    IV2fGeomParam flat( prop, "flat" );
+    IV2fGeomParam::Sample flat0 = flat.getIndexedValue();
+    IV2fGeomParam::Sample flat1 = flat.getIndexedValue();
+    TESTING_ASSERT( flat0.getIndices() == flat1.getIndices() );
+    TESTING_ASSERT( flat0.getIndices()->size() == numVals );
+    TESTING_ASSERT( ( *flat0.getIndices() )[numVals - 1] == numVals - 1 );
+    TESTING_ASSERT( GetIdentityIndices( numVals ) == flat0.getIndices() );
+
+    // element sizes without a specialized gather
+    std::vector< Alembic::Util::uint8_t > bytes( 50 * 5 );
+    for ( size_t i = 0; i < bytes.size(); ++i )
+    {
+        bytes[i] = ( Alembic::Util::uint8_t ) i;
+    }
+    std::vector< Alembic::Util::uint32_t > idx( 3 );
+    idx[0] = 49;
+    idx[1] = 0;
+    idx[2] = 2;
+    std::vector< Alembic::Util::uint8_t > gathered( 3 * 5 );
+    GatherIndexed( &bytes.front(), 5, &idx.front(), 3, &gathered.front() );
+    TESTING_ASSERT( gathered[0] == 245 && gathered[4] == 249 &&
+                    gathered[5] == 0 && gathered[10] == 10 &&
+                    gathered[14] == 14 );
+}
+
 int main( int argc, char *argv[] )
 {
 
@@ -562,5 +669,6 @@ int main( int argc, char *argv[] )
     IndexexedGeomParamTest();
 
     LayeredIndexedGeomParamTest();
+    ExpandedGeomParamCacheTest();
     return 0;
 }
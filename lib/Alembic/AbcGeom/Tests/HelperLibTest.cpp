@@ -42,6 +42,8 @@
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <limits>
+
 namespace Abc = Alembic::Abc;
 
 using namespace Alembic::AbcGeom; // Contains Abc, AbcCoreAbstract
@@ -560,6 +562,62 @@ void readNestedCommpoundWithVis(const std::string &archiveName)
 }
 
 
+//-*****************************************************************************
+template <class VEC>
+void testComputeBounds( std::size_t iNumPoints )
+{
+    typedef typename VEC::BaseType T;
+
+    std::vector< VEC > pos( iNumPoints );
+    for ( std::size_t i = 0; i < iNumPoints; ++i )
+    {
+        pos[i] = VEC( ( T )( ( i * 7919 ) % 10007 ) - ( T ) 5000.5,
+                      ( T )( i % 101 ) * ( T ) 0.25,
+                      -( T )( ( i * 31 ) % 977 ) );
+    }
+
+    // NaNs are skipped, so they don't change anything
+    if ( iNumPoints > 10 )
+    {
+        pos[3].x = std::numeric_limits< T >::quiet_NaN();
+        pos[iNumPoints - 2].z = std::numeric_limits< T >::quiet_NaN();
+    }
+
+    Box3d expected;
+    for ( std::size_t i = 0; i < iNumPoints; ++i )
+    {
+        expected.extendBy( pos[i] );
+    }
+
+    const VEC * data = iNumPoints > 0 ? &pos.front() : NULL;
+    TESTING_ASSERT( ComputeBoundsFromPositions( data, iNumPoints ) ==
+                    expected );
+    TESTING_ASSERT( ComputeBoundsFromPositions( data, iNumPoints, 1 ) ==
+                    expected );
+    TESTING_ASSERT( ComputeBoundsFromPositions( data, iNumPoints, 3 ) ==
+                    expected );
+}
+
+//-*****************************************************************************
+void testComputeBounds()
+{
+    std::size_t sizes[5] = { 0, 1, 7, 1001, 3000017 };
+    for ( std::size_t i = 0; i < 5; ++i )
+    {
+        testComputeBounds< V3f >( sizes[i] );
+        testComputeBounds< V3d >( sizes[i] );
+    }
+
+    // typed samples go through the same kernels
+    std::vector< V3f > pos( 5, V3f( 1.0f, 2.0f, 3.0f ) );
+    pos[4] = V3f( -1.0f, 5.0f, 0.0f );
+    Box3d bounds = ComputeBoundsFromPositions( P3fArraySample( pos ) );
+    TESTING_ASSERT( bounds.min == V3d( -1.0, 2.0, 0.0 ) );
+    TESTING_ASSERT( bounds.max == V3d( 1.0, 5.0, 3.0 ) );
+    TESTING_ASSERT( ComputeBoundsFromPositions(
+        P3fArraySample( std::vector< V3f >() ) ).isEmpty() );
+}
+
 int main( int argc, char *argv[] )
 {
     try
@@ -578,6 +636,8 @@ int main( int argc, char *argv[] )
         std::string archiveName2("simpleHelperProps.abc");
         writeSimpleProperties(archiveName2);
         readSimpleProperties(archiveName2);
+
+        testComputeBounds();
     }
     catch (char * str )
     {
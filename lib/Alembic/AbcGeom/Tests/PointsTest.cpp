@@ -475,6 +475,67 @@ void optPropTest()
     }
 }
 
+//-*****************************************************************************
+void interpolatedTest()
+{
+    std::string name = "pointsInterpolatedTest.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        TimeSamplingPtr ts( new TimeSampling( 0.5, 0.0 ) );
+        OPoints ptObj( OObject( archive, kTop ), "pts", ts );
+        OPointsSchema &pt = ptObj.getSchema();
+
+        // a point is born between samples 1 and 2
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            size_t numVerts = ( i < 2 ) ? 5 : 6;
+            std::vector< V3f > verts( numVerts );
+            std::vector< V3f > veloc( numVerts );
+            std::vector< Alembic::Util::uint64_t > ids( numVerts );
+            for ( size_t j = 0; j < numVerts; ++j )
+            {
+                ids[j] = j;
+                verts[j] = V3f( j, i, 0.0 );
+                veloc[j] = V3f( 0.0, 2.0, 4.0 );
+            }
+
+            OPointsSchema::Sample samp;
+            samp.setPositions( P3fArraySample( verts ) );
+            samp.setIds( UInt64ArraySample( ids ) );
+            samp.setVelocities( V3fArraySample( veloc ) );
+            pt.set( samp );
+        }
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+        IPointsSchema pts = IPoints( IObject( archive, kTop ),
+                                     "pts" ).getSchema();
+
+        // same number of points, blended
+        IPointsSchema::Sample samp;
+        pts.getInterpolated( samp, 0.25 );
+        TESTING_ASSERT( samp.getPositions()->size() == 5 );
+        TESTING_ASSERT( ( *samp.getPositions() )[3] == V3f( 3.0, 0.5, 0.0 ) );
+        TESTING_ASSERT( ( *samp.getVelocities() )[3] ==
+                        V3f( 0.0, 2.0, 4.0 ) );
+
+        // different number of points, moved along the velocities
+        pts.getInterpolated( samp, 0.75 );
+        TESTING_ASSERT( samp.getPositions()->size() == 5 );
+        TESTING_ASSERT( ( *samp.getPositions() )[4] == V3f( 4.0, 1.5, 1.0 ) );
+
+        // and the same past the last sample
+        pts.getInterpolated( samp, 1.5 );
+        TESTING_ASSERT( samp.getPositions()->size() == 6 );
+        TESTING_ASSERT( ( *samp.getPositions() )[5] == V3f( 5.0, 3.0, 2.0 ) );
+
+        // right on a sample is just that sample
+        pts.getInterpolated( samp, 0.5 );
+        TESTING_ASSERT( ( *samp.getPositions() )[2] == V3f( 2.0, 1.0, 0.0 ) );
+    }
+}
+
 //-*****************************************************************************
 void sparseTest()
 {
@@ -542,6 +603,130 @@ void sparseTest()
     }
 }
 
+//-*****************************************************************************
+void tiledTest()
+{
+    std::string name = "pointsTiledTest.abc";
+
+    // a 32 x 32 grid, with everything else derived from the positions
+    const size_t numPoints = 1024;
+    std::vector< V3f > verts( numPoints );
+    std::vector< V3f > veloc( numPoints );
+    std::vector< Alembic::Util::uint64_t > ids( numPoints );
+    std::vector< float > widths( numPoints );
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        verts[i] = V3f( i % 32, i / 32, 0.0f );
+        veloc[i] = verts[i] * 2.0f;
+        ids[i] = i * 10;
+        widths[i] = i;
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPoints ptObj( OObject( archive, kTop ), "tiled" );
+        OPointsSchema &pt = ptObj.getSchema();
+        pt.setTileSize( 64 );
+
+        OPointsSchema::Sample samp;
+        samp.setPositions( P3fArraySample( verts ) );
+        samp.setIds( UInt64ArraySample( ids ) );
+        samp.setVelocities( V3fArraySample( veloc ) );
+        samp.setWidths( OFloatGeomParam::Sample(
+            FloatArraySample( widths ), kVertexScope ) );
+        pt.set( samp );
+
+        TESTING_ASSERT( pt.getTileOrder().size() == numPoints );
+        pt.setFromPrevious();
+
+        OPoints plainObj( OObject( archive, kTop ), "plain" );
+        plainObj.getSchema().set( samp );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IPointsSchema pts = IPoints( IObject( archive, kTop ),
+                                 "tiled" ).getSchema();
+    TESTING_ASSERT( pts.isTiled() );
+    TESTING_ASSERT( pts.getNumSamples() == 2 );
+
+    // every point is still there, along with its own id, velocity and width
+    IPointsSchema::Sample samp;
+    pts.get( samp );
+    FloatArraySamplePtr readWidths = pts.getWidthsParam().getExpandedValue(
+        ).getVals();
+    TESTING_ASSERT( samp.getPositions()->size() == numPoints );
+    std::vector< bool > seen( numPoints, false );
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        size_t orig = ( *samp.getIds() )[i] / 10;
+        TESTING_ASSERT( !seen[orig] );
+        seen[orig] = true;
+        TESTING_ASSERT( ( *samp.getPositions() )[i] == verts[orig] );
+        TESTING_ASSERT( ( *samp.getVelocities() )[i] == veloc[orig] );
+        TESTING_ASSERT( ( *readWidths )[i] == widths[orig] );
+    }
+
+    // 16 tiles of 8 x 8 points, holding the points inside them
+    std::vector< Box3d > tileBounds;
+    std::vector< Alembic::Util::uint64_t > offsets;
+    pts.getTiles( tileBounds, offsets, 1 );
+    TESTING_ASSERT( tileBounds.size() == 16 && offsets.size() == 17 );
+    for ( size_t t = 0; t < tileBounds.size(); ++t )
+    {
+        TESTING_ASSERT( offsets[t] == t * 64 );
+        TESTING_ASSERT( tileBounds[t].size() == V3d( 7.0, 7.0, 0.0 ) );
+        for ( size_t i = offsets[t]; i < offsets[t + 1]; ++i )
+        {
+            TESTING_ASSERT( tileBounds[t].intersects(
+                V3d( ( *samp.getPositions() )[i] ) ) );
+        }
+    }
+
+    // a region within the first tile only reads that one
+    Box3d region( V3d( 0.5, 0.5, -1.0 ), V3d( 7.5, 7.5, 1.0 ) );
+    pts.getTiled( samp, region );
+    TESTING_ASSERT( samp.getPositions()->size() == 64 );
+    TESTING_ASSERT( samp.getIds()->size() == 64 );
+    TESTING_ASSERT( samp.getVelocities()->size() == 64 );
+    TESTING_ASSERT( samp.getSelfBounds() ==
+                    Box3d( V3d( 0.0 ), V3d( 7.0, 7.0, 0.0 ) ) );
+
+    // along with the widths of just those points
+    FloatArraySamplePtr tileWidths;
+    pts.getTiled( samp, tileWidths, region );
+    TESTING_ASSERT( tileWidths && tileWidths->size() == 64 );
+    for ( size_t i = 0; i < 64; ++i )
+    {
+        size_t orig = ( *samp.getIds() )[i] / 10;
+        TESTING_ASSERT( ( *tileWidths )[i] == widths[orig] );
+    }
+
+    // a quarter of every tile is every other point in x and y
+    pts.getTiled( samp, Box3d( V3d( -1.0 ), V3d( 100.0 ) ), 0.25 );
+    TESTING_ASSERT( samp.getPositions()->size() == 256 );
+    Box3d firstBounds;
+    for ( size_t i = 0; i < 16; ++i )
+    {
+        const V3f & p = ( *samp.getPositions() )[i];
+        TESTING_ASSERT( ( int ) p.x % 2 == 0 && ( int ) p.y % 2 == 0 );
+        firstBounds.extendBy( V3d( p ) );
+    }
+    TESTING_ASSERT( firstBounds == Box3d( V3d( 0.0 ), V3d( 6.0, 6.0, 0.0 ) ) );
+
+    // untiled points are a single tile
+    IPointsSchema plain = IPoints( IObject( archive, kTop ),
+                                   "plain" ).getSchema();
+    TESTING_ASSERT( !plain.isTiled() );
+    plain.getTiles( tileBounds, offsets );
+    TESTING_ASSERT( tileBounds.size() == 1 && offsets.back() == numPoints );
+    plain.getTiled( samp, region );
+    TESTING_ASSERT( samp.getPositions()->size() == numPoints );
+    TESTING_ASSERT( ( *samp.getIds() )[5] == 50 );
+    plain.getTiled( samp, tileWidths, region );
+    TESTING_ASSERT( tileWidths->size() == numPoints &&
+                    ( *tileWidths )[5] == 5.0f );
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -580,5 +765,9 @@ int main( int argc, char *argv[] )
 
     sparseTest();
 
+    interpolatedTest();
+
+    tiledTest();
+
     return 0;
 }
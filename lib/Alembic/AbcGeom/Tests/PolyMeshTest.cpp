@@ -415,6 +415,83 @@ void sparseTest()
     }
 }
 
+//-*****************************************************************************
+void topologyMemoTest()
+{
+    std::string name = "topologyMemoTest.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPolyMeshSchema homog =
+            OPolyMesh( OObject( archive, kTop ), "homog" ).getSchema();
+        OPolyMeshSchema heterog =
+            OPolyMesh( OObject( archive, kTop ), "heterog" ).getSchema();
+
+        std::vector< V3f > verts( ( const V3f * ) g_verts,
+                                  ( const V3f * ) g_verts + g_numVerts );
+        std::vector< int32_t > indices( g_indices, g_indices + g_numIndices );
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            verts[0].x = ( float ) i;
+
+            homog.set( OPolyMeshSchema::Sample(
+                V3fArraySample( verts ),
+                Int32ArraySample( g_indices, g_numIndices ),
+                Int32ArraySample( g_counts, g_numCounts ) ) );
+
+            // topology changes between samples 1 and 2, and back for 3
+            indices[0] = ( i == 2 ) ? 1 : g_indices[0];
+            heterog.set( OPolyMeshSchema::Sample(
+                V3fArraySample( verts ),
+                Int32ArraySample( indices ),
+                Int32ArraySample( g_counts, g_numCounts ) ) );
+        }
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+        IPolyMeshSchema homog =
+            IPolyMesh( IObject( archive, kTop ), "homog" ).getSchema();
+        IPolyMeshSchema heterog =
+            IPolyMesh( IObject( archive, kTop ), "heterog" ).getSchema();
+        TESTING_ASSERT( homog.getTopologyVariance() == kHomogenousTopology );
+        TESTING_ASSERT( heterog.getTopologyVariance() ==
+                        kHeterogenousTopology );
+
+        IPolyMeshSchema::Sample samp0 = homog.getValue( 0 );
+        for ( index_t i = 1; i < 4; ++i )
+        {
+            IPolyMeshSchema::Sample samp = homog.getValue( i );
+            TESTING_ASSERT( samp.getFaceIndices() == samp0.getFaceIndices() );
+            TESTING_ASSERT( samp.getFaceCounts() == samp0.getFaceCounts() );
+            TESTING_ASSERT( samp.getPositions() != samp0.getPositions() );
+            TESTING_ASSERT( ( *samp.getPositions() )[0].x == ( float ) i );
+        }
+
+        // a quarter of the way from sample 1 to 2 with the same topology
+        IPolyMeshSchema::Sample interp;
+        homog.getInterpolated( interp, 1.25 );
+        TESTING_ASSERT( interp.getFaceIndices() == samp0.getFaceIndices() );
+        TESTING_ASSERT( ( *interp.getPositions() )[0].x == 1.25f );
+        TESTING_ASSERT( ( *interp.getPositions() )[1] ==
+                        ( *samp0.getPositions() )[1] );
+
+        // samples 1 and 3 have the same topology as 0, but 2 doesn't
+        IPolyMeshSchema::Sample het0 = heterog.getValue( 0 );
+        IPolyMeshSchema::Sample het1 = heterog.getValue( 1 );
+        IPolyMeshSchema::Sample het2 = heterog.getValue( 2 );
+        IPolyMeshSchema::Sample het3 = heterog.getValue( 3 );
+        TESTING_ASSERT( het1.getFaceIndices() == het0.getFaceIndices() );
+        TESTING_ASSERT( het2.getFaceIndices() != het1.getFaceIndices() );
+        TESTING_ASSERT( ( *het2.getFaceIndices() )[0] == 1 );
+        TESTING_ASSERT( ( *het3.getFaceIndices() )[0] == g_indices[0] );
+        TESTING_ASSERT( het3.getFaceCounts() == het0.getFaceCounts() );
+
+        // a schema assigned over another one doesn't hand back its topology
+        homog = heterog;
+        TESTING_ASSERT( ( *homog.getValue( 2 ).getFaceIndices() )[0] == 1 );
+    }
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -437,5 +514,7 @@ int main( int argc, char *argv[] )
 
     sparseTest();
 
+    topologyMemoTest();
+
     return 0;
 }
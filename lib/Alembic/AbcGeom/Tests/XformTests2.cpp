@@ -38,6 +38,9 @@
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <algorithm>
+#include <sstream>
+
 using namespace Alembic::AbcGeom;
 
 //-*****************************************************************************
@@ -131,12 +134,424 @@ void rotateTest()
 }
 
 //-*****************************************************************************
+//-*****************************************************************************
+void compiledOpsTest()
+{
+    std::string fileName = "compiledXformOps.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), fileName );
+        OXform a( OObject( archive, kTop ), "a" );
+
+        // more than 256 channels puts the values in an array property
+        OXform b( OObject( archive, kTop ), "b" );
+
+        for ( size_t i = 0; i < 10; ++i )
+        {
+            double d = ( double ) i;
+            XformSample aSamp;
+            aSamp.addOp( XformOp( kTranslateOperation ),
+                         V3d( d, 2.0, -d ) );
+            aSamp.addOp( XformOp( kRotateOperation ),
+                         V3d( 1.0, d, 2.0 ), 10.0 * d );
+            aSamp.addOp( XformOp( kRotateXOperation ), 5.0 * d );
+            aSamp.addOp( XformOp( kRotateYOperation ), 45.0 );
+            aSamp.addOp( XformOp( kRotateZOperation ), -3.0 * d );
+            aSamp.addOp( XformOp( kScaleOperation ),
+                         V3d( 1.0, 2.0 + d, 0.5 ) );
+            M44d mat;
+            mat.x[0][1] = d;
+            mat.x[3][2] = 7.0;
+            aSamp.addOp( XformOp( kMatrixOperation ), mat );
+            a.getSchema().set( aSamp );
+
+            XformSample bSamp;
+            for ( size_t j = 0; j < 20; ++j )
+            {
+                M44d bMat;
+                bMat.setEulerAngles( V3d( 0.1 * d, 0.01 * j, 0.0 ) );
+                bMat.x[3][0] = d + j;
+                bSamp.addOp( XformOp( kMatrixOperation ), bMat );
+            }
+            b.getSchema().set( bSamp );
+        }
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), fileName );
+        IXformSchema schemas[2] = {
+            IXform( IObject( archive, kTop ), "a" ).getSchema(),
+            IXform( IObject( archive, kTop ), "b" ).getSchema() };
+
+        TESTING_ASSERT( schemas[0].getCompiledOps().getNumOps() == 7 );
+        TESTING_ASSERT( schemas[0].getCompiledOps().getNumChannels() == 29 );
+        TESTING_ASSERT( schemas[1].getCompiledOps().getNumChannels() == 320 );
+
+        for ( size_t s = 0; s < 2; ++s )
+        {
+            // 2 past the end get the last sample
+            std::vector< M44d > mats( 12 );
+            schemas[s].getMatrices( 0, mats.size(), &mats.front() );
+
+            for ( index_t i = 0; i < 12; ++i )
+            {
+                index_t index = std::min( i, ( index_t ) 9 );
+                M44d expected = schemas[s].getValue( index ).getMatrix();
+                TESTING_ASSERT( mats[i].equalWithAbsError( expected,
+                                                           1e-9 ) );
+                TESTING_ASSERT( schemas[s].getMatrix( index ).
+                                equalWithAbsError( expected, 1e-9 ) );
+            }
+        }
+
+        // halfway between samples 3 and 4, every channel is halfway too
+        XformSample halfway;
+        schemas[0].getInterpolated( halfway, 3.5 );
+        TESTING_ASSERT( halfway[0].getChannelValue( 0 ) == 3.5 );
+        TESTING_ASSERT( halfway[0].getChannelValue( 2 ) == -3.5 );
+        TESTING_ASSERT( halfway[2].getChannelValue( 0 ) == 17.5 );
+        TESTING_ASSERT( halfway[3].getChannelValue( 0 ) == 45.0 );
+        TESTING_ASSERT( schemas[0].getInterpolatedMatrix( 3.5 ).
+                        equalWithAbsError( halfway.getMatrix(), 1e-9 ) );
+
+        // on and past the samples we just get those
+        TESTING_ASSERT( schemas[1].getInterpolatedMatrix( 4.0 ).
+                        equalWithAbsError( schemas[1].getMatrix( 4 ), 1e-9 ) );
+        TESTING_ASSERT( schemas[1].getInterpolatedMatrix( 20.0 ).
+                        equalWithAbsError( schemas[1].getMatrix( 9 ), 1e-9 ) );
+    }
+}
+
+//-*****************************************************************************
+void boundsQueryTest()
+{
+    std::string fileName = "boundsQuery.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), fileName );
+
+        std::vector< V3f > verts( 2, V3f( 0.0f, 0.0f, 0.0f ) );
+        verts[1] = V3f( 0.5f, 0.5f, 0.5f );
+        std::vector< Alembic::Util::uint64_t > ids( 2, 0 );
+        ids[1] = 1;
+        OPointsSchema::Sample ptsSamp;
+        ptsSamp.setPositions( P3fArraySample( verts ) );
+        ptsSamp.setIds( UInt64ArraySample( ids ) );
+
+        // a static 10 x 10 grid of points
+        for ( size_t i = 0; i < 100; ++i )
+        {
+            std::ostringstream name;
+            name << "grid" << i;
+            OXform xf( OObject( archive, kTop ), name.str() );
+            XformSample samp;
+            samp.setTranslation( V3d( i % 10, i / 10, 0.0 ) );
+            xf.getSchema().set( samp );
+            OPoints( xf, "pts" ).getSchema().set( ptsSamp );
+        }
+
+        // and one moving along x, starting well away from the grid
+        OXform mover( OObject( archive, kTop ), "mover" );
+        for ( size_t i = 0; i < 10; ++i )
+        {
+            XformSample samp;
+            samp.setTranslation( V3d( 20.0 - 3.0 * i, 0.0, 0.0 ) );
+            mover.getSchema().set( samp );
+        }
+        OPoints( mover, "pts" ).getSchema().set( ptsSamp );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), fileName );
+    IBoundsQuery query( archive.getTop() );
+    TESTING_ASSERT( query.getNumItems() == 101 );
+    TESTING_ASSERT( query.getBounds().max.x == 20.5 );
+
+    std::vector< size_t > found;
+    query.intersect( Box3d( V3d( 2.2, 2.2, -1.0 ), V3d( 3.7, 3.7, 1.0 ) ),
+                     found );
+    TESTING_ASSERT( found.size() == 4 );
+    for ( size_t i = 0; i < found.size(); ++i )
+    {
+        std::string name = query.getObject( found[i] ).getFullName();
+        TESTING_ASSERT( name == "/grid22/pts" || name == "/grid23/pts" ||
+                        name == "/grid32/pts" || name == "/grid33/pts" );
+    }
+
+    // an orthographic frustum over x and y from 0 to 10
+    M44d worldToClip;
+    worldToClip.setTranslation( V3d( -5.0, -5.0, 0.0 ) );
+    M44d scale;
+    scale.setScale( 0.2 );
+    worldToClip = worldToClip * scale;
+    std::vector< Imath::V4d > planes;
+    IBoundsQuery::GetFrustumPlanes( worldToClip, planes );
+    TESTING_ASSERT( planes.size() == 6 );
+    Box3d frustumBox( V3d( 0.0, 0.0, -5.0 ), V3d( 10.0, 10.0, 5.0 ) );
+
+    for ( index_t frame = 0; frame < 10; ++frame )
+    {
+        query.evaluate( frame );
+
+        // the same as checking every item
+        std::vector< size_t > expected;
+        for ( size_t i = 0; i < query.getNumItems(); ++i )
+        {
+            if ( query.getWorldBounds( i ).intersects( frustumBox ) )
+            {
+                expected.push_back( i );
+            }
+        }
+
+        std::vector< size_t > inBox;
+        std::vector< size_t > inFrustum;
+        query.intersect( frustumBox, inBox );
+        query.intersect( planes, inFrustum );
+        std::sort( inBox.begin(), inBox.end() );
+        std::sort( inFrustum.begin(), inFrustum.end() );
+        TESTING_ASSERT( inBox == expected );
+        TESTING_ASSERT( inFrustum == expected );
+
+        // the mover is in x from 20 - 3 * frame to 20.5 - 3 * frame
+        bool moverIn = 20.0 - 3.0 * frame <= 10.0 &&
+            20.5 - 3.0 * frame >= 0.0;
+        TESTING_ASSERT( expected.size() == ( moverIn ? 101 : 100 ) );
+    }
+}
+
+//-*****************************************************************************
+void hierarchyOut()
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                      "xformHierarchy.abc" );
+    TimeSamplingPtr ts( new TimeSampling( 1.0 / 24.0, 0.0 ) );
+
+    OXform still( OObject( archive, kTop ), "still" );
+    XformSample samp;
+    samp.setTranslation( V3d( 1.0, 2.0, 3.0 ) );
+    still.getSchema().set( samp );
+
+    OXform spin( still, "spin", ts );
+    for ( size_t i = 0; i < 10; ++i )
+    {
+        XformSample spinSamp;
+        spinSamp.setTranslation( V3d( ( double ) i, 0.0, 0.0 ) );
+        spinSamp.setYRotation( 10.0 * i );
+        spin.getSchema().set( spinSamp );
+    }
+
+    OXform leaf( spin, "leaf" );
+    XformSample leafSamp;
+    leafSamp.setScale( V3d( 2.0, 2.0, 2.0 ) );
+    leaf.getSchema().set( leafSamp );
+    OObject shape( leaf, "shape" );
+
+    OXform noInherit( spin, "noInherit" );
+    XformSample noInheritSamp;
+    noInheritSamp.setTranslation( V3d( 0.0, 5.0, 0.0 ) );
+    noInheritSamp.setInheritsXforms( false );
+    noInherit.getSchema().set( noInheritSamp );
+
+    OXform other( OObject( archive, kTop ), "other" );
+    XformSample otherSamp;
+    otherSamp.setTranslation( V3d( 0.0, 0.0, 7.0 ) );
+    other.getSchema().set( otherSamp );
+}
+
+//-*****************************************************************************
+// the world matrix the slow way
+M44d worldMatrix( IObject iObject, const ISampleSelector & iSS )
+{
+    M44d ret;
+    while ( iObject.valid() )
+    {
+        if ( IXform::matches( iObject.getMetaData() ) )
+        {
+            XformSample samp;
+            IXform( iObject, kWrapExisting ).getSchema().get( samp, iSS );
+            ret = ret * samp.getMatrix();
+            if ( !samp.getInheritsXforms() )
+            {
+                break;
+            }
+        }
+        iObject = iObject.getParent();
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+void hierarchyIn()
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "xformHierarchy.abc" );
+    IXformHierarchy hier( archive.getTop() );
+
+    TESTING_ASSERT( hier.getNumNodes() == 7 );
+    TESTING_ASSERT( hier.getParent( 0 ) == IXformHierarchy::kNoParent );
+    size_t still = hier.findNode( "/still" );
+    size_t spin = hier.findNode( "/still/spin" );
+    size_t shape = hier.findNode( "/still/spin/leaf/shape" );
+    size_t noInherit = hier.findNode( "/still/spin/noInherit" );
+    TESTING_ASSERT( hier.findNode( "/nope" ) == IXformHierarchy::kNoParent );
+    TESTING_ASSERT( hier.getParent( spin ) == still );
+    TESTING_ASSERT( hier.getObject( shape ).getName() == "shape" );
+    TESTING_ASSERT( hier.isConstant( still ) );
+    TESTING_ASSERT( !hier.isConstant( spin ) );
+    TESTING_ASSERT( !hier.isConstant( shape ) );
+    TESTING_ASSERT( hier.isConstant( hier.findNode( "/other" ) ) );
+
+    // forwards, backwards and by time
+    index_t indices[6] = { 0, 3, 4, 9, 2, 2 };
+    for ( size_t i = 0; i < 6; ++i )
+    {
+        ISampleSelector ss( indices[i] );
+        std::vector< double > matrices;
+        hier.getWorldMatrices( ss, matrices );
+        TESTING_ASSERT( matrices.size() == 16 * hier.getNumNodes() );
+
+        for ( size_t n = 0; n < hier.getNumNodes(); ++n )
+        {
+            M44d expected = worldMatrix( hier.getObject( n ), ss );
+            TESTING_ASSERT( hier.getWorldMatrix( n ) == expected );
+            TESTING_ASSERT( matrices[13 * hier.getNumNodes() + n] ==
+                            expected[3][1] );
+        }
+
+        ISampleSelector timeSS( indices[i] / 24.0 );
+        TESTING_ASSERT( hier.getWorldMatrix( shape, timeSS ) ==
+                        worldMatrix( hier.getObject( shape ), ss ) );
+    }
+
+    // not inheriting means our parents don't matter
+    TESTING_ASSERT( hier.getWorldMatrix( noInherit ).translation() ==
+                    V3d( 0.0, 5.0, 0.0 ) );
+}
+
+//-*****************************************************************************
+void childBoundsOut( const std::string & iFileName,
+                     OChildBoundsWriter::Space iSpace )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iFileName );
+    OChildBoundsWriter childBounds( archive, iSpace );
+
+    std::vector< V3f > verts( 2, V3f( 0.0f, 0.0f, 0.0f ) );
+    verts[1] = V3f( 1.0f, 1.0f, 1.0f );
+    std::vector< Alembic::Util::uint64_t > ids( 2, 0 );
+    ids[1] = 1;
+    OPointsSchema::Sample ptsSamp;
+    ptsSamp.setPositions( P3fArraySample( verts ) );
+    ptsSamp.setIds( UInt64ArraySample( ids ) );
+
+    // a moves along x over 3 samples, and b scales the points under it by 2
+    OXform a( OObject( archive, kTop ), "a" );
+    for ( size_t i = 0; i < 3; ++i )
+    {
+        XformSample samp;
+        samp.setTranslation( V3d( 1.0 + i, 0.0, 0.0 ) );
+        a.getSchema().set( samp );
+    }
+
+    OXform b( a, "b" );
+    XformSample bsamp;
+    bsamp.setScale( V3d( 2.0, 2.0, 2.0 ) );
+    b.getSchema().set( bsamp );
+    OPoints( b, "pts" ).getSchema().set( ptsSamp );
+
+    // points right under the top, from -1 to 0
+    verts[0] = V3f( -1.0f, -1.0f, -1.0f );
+    verts[1] = V3f( 0.0f, 0.0f, 0.0f );
+    ptsSamp.setPositions( P3fArraySample( verts ) );
+    OPoints( OObject( archive, kTop ), "loose" ).getSchema().set( ptsSamp );
+
+    // bounds written by hand are left alone
+    OXform c( OObject( archive, kTop ), "c" );
+    c.getSchema().set( bsamp );
+    c.getSchema().getChildBoundsProperty().set(
+        Box3d( V3d( 5.0 ), V3d( 6.0 ) ) );
+}
+
+//-*****************************************************************************
+void childBoundsTest()
+{
+    childBoundsOut( "childBoundsLocal.abc", OChildBoundsWriter::kLocalSpace );
+    childBoundsOut( "childBoundsWorld.abc", OChildBoundsWriter::kWorldSpace );
+
+    for ( size_t f = 0; f < 2; ++f )
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                          f == 0 ? "childBoundsLocal.abc" :
+                          "childBoundsWorld.abc" );
+
+        // the archive bounds follow a, the densest thing under them
+        IBox3dProperty archiveBounds = GetIArchiveBounds( archive );
+        TESTING_ASSERT( archiveBounds.getNumSamples() == 3 );
+        for ( index_t i = 0; i < 3; ++i )
+        {
+            Box3d bnds = archiveBounds.getValue( i );
+            TESTING_ASSERT( bnds.min == V3d( -1.0 ) );
+            TESTING_ASSERT( bnds.max == V3d( 3.0 + i, 2.0, 2.0 ) );
+        }
+
+        IXform a( archive.getTop(), "a" );
+        IBox3dProperty aBounds = a.getSchema().getChildBoundsProperty();
+        TESTING_ASSERT( aBounds.getNumSamples() == 3 );
+
+        IXform b( a, "b" );
+        IBox3dProperty bBounds = b.getSchema().getChildBoundsProperty();
+
+        if ( f == 0 )
+        {
+            // the points as seen from a and from b
+            for ( index_t i = 0; i < 3; ++i )
+            {
+                TESTING_ASSERT( aBounds.getValue( i ) ==
+                                Box3d( V3d( 0.0 ), V3d( 2.0 ) ) );
+            }
+
+            // nothing under b moves relative to it
+            TESTING_ASSERT( bBounds.getNumSamples() == 1 );
+            TESTING_ASSERT( bBounds.getValue() ==
+                            Box3d( V3d( 0.0 ), V3d( 1.0 ) ) );
+        }
+        else
+        {
+            for ( index_t i = 0; i < 3; ++i )
+            {
+                TESTING_ASSERT( aBounds.getValue( i ) ==
+                                Box3d( V3d( 1.0 + i, 0.0, 0.0 ),
+                                       V3d( 3.0 + i, 2.0, 2.0 ) ) );
+            }
+
+            // b and its points don't move, but a carries them along in
+            // world space, so b's bounds follow a's samples
+            TESTING_ASSERT( bBounds.getNumSamples() == 3 );
+            for ( index_t i = 0; i < 3; ++i )
+            {
+                TESTING_ASSERT( bBounds.getValue( i ) ==
+                                Box3d( V3d( 1.0 + i, 0.0, 0.0 ),
+                                       V3d( 3.0 + i, 2.0, 2.0 ) ) );
+            }
+        }
+
+        IXform c( archive.getTop(), "c" );
+        IBox3dProperty cBounds = c.getSchema().getChildBoundsProperty();
+        TESTING_ASSERT( cBounds.getNumSamples() == 1 );
+        TESTING_ASSERT( cBounds.getValue() ==
+                        Box3d( V3d( 5.0 ), V3d( 6.0 ) ) );
+    }
+}
+
 int main( int argc, char *argv[] )
 {
     xformOut();
     xformIn();
 
     rotateTest();
+    compiledOpsTest();
+
+    hierarchyOut();
+    hierarchyIn();
+
+    boundsQueryTest();
+    childBoundsTest();
 
     return 0;
 }
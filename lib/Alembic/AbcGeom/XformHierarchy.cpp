@@ -0,0 +1,259 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/XformHierarchy.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+const size_t IXformHierarchy::kNoParent = ( size_t ) -1;
+
+//-*****************************************************************************
+IXformHierarchy::IXformHierarchy( const Abc::IObject & iTop )
+{
+    if ( iTop.valid() )
+    {
+        addNode( iTop, kNoParent );
+    }
+
+    // the constant parts are done once and for all
+    Abc::ISampleSelector ss;
+    for ( size_t i = 0; i < m_nodes.size(); ++i )
+    {
+        const Node & node = m_nodes[i];
+        if ( !node.isConstant )
+        {
+            m_animated.push_back( i );
+            continue;
+        }
+
+        if ( node.xform )
+        {
+            readLocal( i, ss );
+        }
+
+        if ( node.parent == kNoParent || !node.inherits )
+        {
+            m_world[i] = m_local[i];
+        }
+        else
+        {
+            m_world[i] = m_local[i] * m_world[node.parent];
+        }
+    }
+
+    evaluate( ss );
+}
+
+//-*****************************************************************************
+void IXformHierarchy::addNode( const Abc::IObject & iObject, size_t iParent )
+{
+    size_t index = m_nodes.size();
+
+    Node node;
+    node.object = iObject;
+    node.parent = iParent;
+    node.isConstant = iParent == kNoParent || m_nodes[iParent].isConstant;
+    node.isAnimated = false;
+    node.inherits = true;
+    node.sampleIndex = -1;
+
+    if ( IXform::matches( iObject.getMetaData() ) )
+    {
+        node.xform = IXform( iObject, kWrapExisting ).getSchema();
+        node.isAnimated = !node.xform.isConstant();
+        node.isConstant = node.isConstant && !node.isAnimated;
+    }
+
+    m_nodes.push_back( node );
+    m_local.push_back( Abc::M44d() );
+    m_world.push_back( Abc::M44d() );
+    m_changed.push_back( 0 );
+    m_names[iObject.getFullName()] = index;
+
+    for ( size_t i = 0; i < iObject.getNumChildren(); ++i )
+    {
+        addNode( iObject.getChild( i ), index );
+    }
+}
+
+//-*****************************************************************************
+void IXformHierarchy::readLocal( size_t iNode,
+                                 const Abc::ISampleSelector & iSS )
+{
+    Node & node = m_nodes[iNode];
+    index_t index = iSS.getIndex( node.xform.getTimeSampling(),
+                                  node.xform.getNumSamples() );
+
+    m_local[iNode] = node.xform.getMatrix( Abc::ISampleSelector( index ) );
+    node.inherits = node.xform.getInheritsXforms(
+        Abc::ISampleSelector( index ) );
+    node.sampleIndex = index;
+}
+
+//-*****************************************************************************
+Abc::IObject IXformHierarchy::getObject( size_t iNode ) const
+{
+    ABCA_ASSERT( iNode < m_nodes.size(), "Invalid node: " << iNode );
+    return m_nodes[iNode].object;
+}
+
+//-*****************************************************************************
+size_t IXformHierarchy::getParent( size_t iNode ) const
+{
+    ABCA_ASSERT( iNode < m_nodes.size(), "Invalid node: " << iNode );
+    return m_nodes[iNode].parent;
+}
+
+//-*****************************************************************************
+size_t IXformHierarchy::findNode( const std::string & iFullName ) const
+{
+    std::map< std::string, size_t >::const_iterator it =
+        m_names.find( iFullName );
+    return it == m_names.end() ? kNoParent : it->second;
+}
+
+//-*****************************************************************************
+bool IXformHierarchy::isConstant( size_t iNode ) const
+{
+    ABCA_ASSERT( iNode < m_nodes.size(), "Invalid node: " << iNode );
+    return m_nodes[iNode].isConstant;
+}
+
+//-*****************************************************************************
+void IXformHierarchy::evaluate( const Abc::ISampleSelector & iSS )
+{
+    for ( size_t i = 0; i < m_animated.size(); ++i )
+    {
+        size_t n = m_animated[i];
+        Node & node = m_nodes[n];
+
+        // nothing has been read the first time around
+        bool changed = node.sampleIndex < 0;
+        if ( node.isAnimated )
+        {
+            index_t index = iSS.getIndex( node.xform.getTimeSampling(),
+                                          node.xform.getNumSamples() );
+            if ( index != node.sampleIndex )
+            {
+                readLocal( n, Abc::ISampleSelector( index ) );
+                changed = true;
+            }
+        }
+        else if ( changed )
+        {
+            // a constant xform, or no xform at all, underneath an animated
+            // one is only read once
+            if ( node.xform )
+            {
+                readLocal( n, iSS );
+            }
+            node.sampleIndex = 0;
+        }
+
+        // parents come first, so theirs is already up to date
+        bool hasParent = node.parent != kNoParent;
+        if ( hasParent && m_changed[node.parent] )
+        {
+            changed = true;
+        }
+
+        if ( changed )
+        {
+            if ( hasParent && node.inherits )
+            {
+                m_world[n] = m_local[n] * m_world[node.parent];
+            }
+            else
+            {
+                m_world[n] = m_local[n];
+            }
+        }
+
+        m_changed[n] = changed;
+    }
+}
+
+//-*****************************************************************************
+bool IXformHierarchy::hasChanged( size_t iNode ) const
+{
+    ABCA_ASSERT( iNode < m_nodes.size(), "Invalid node: " << iNode );
+    return m_changed[iNode] != 0;
+}
+
+//-*****************************************************************************
+const Abc::M44d & IXformHierarchy::getWorldMatrix( size_t iNode ) const
+{
+    ABCA_ASSERT( iNode < m_nodes.size(), "Invalid node: " << iNode );
+    return m_world[iNode];
+}
+
+//-*****************************************************************************
+const Abc::M44d &
+IXformHierarchy::getWorldMatrix( size_t iNode,
+                                 const Abc::ISampleSelector & iSS )
+{
+    evaluate( iSS );
+    return getWorldMatrix( iNode );
+}
+
+//-*****************************************************************************
+void IXformHierarchy::getWorldMatrices( const Abc::ISampleSelector & iSS,
+                                        std::vector< double > & oMatrices )
+{
+    evaluate( iSS );
+
+    size_t numNodes = m_nodes.size();
+    oMatrices.resize( 16 * numNodes );
+    for ( size_t i = 0; i < 4; ++i )
+    {
+        for ( size_t j = 0; j < 4; ++j )
+        {
+            double * elements = oMatrices.empty() ? NULL :
+                &oMatrices[( i * 4 + j ) * numNodes];
+            for ( size_t n = 0; n < numNodes; ++n )
+            {
+                elements[n] = m_world[n][i][j];
+            }
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
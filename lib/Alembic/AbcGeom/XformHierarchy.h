@@ -0,0 +1,153 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_XformHierarchy_h
+#define Alembic_AbcGeom_XformHierarchy_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/IXform.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! IXformHierarchy flattens the objects underneath an object (usually the top
+//! of an archive) into nodes, parents always coming before their children,
+//! and keeps the world matrix of every one of them: the product of the
+//! xforms above it and its own, taking getInheritsXforms into account.
+//! Objects that aren't xforms just have the world matrix of their parent.
+//!
+//! Nodes whose xform and every xform above them are constant are computed
+//! once.  Evaluating the hierarchy at another sample selector only reads the
+//! animated xforms whose sample index changed, and only multiplies out those
+//! and the nodes underneath them, so stepping through frames costs nothing
+//! for the static parts of a scene.
+//!
+//! An IXformHierarchy is not safe to evaluate from several threads at once.
+class ALEMBIC_EXPORT IXformHierarchy
+{
+public:
+    //! What getParent returns for the first node.
+    static const size_t kNoParent;
+
+    IXformHierarchy() {}
+
+    //! Walks iTop and everything underneath it, and evaluates it at the
+    //! default sample selector.
+    explicit IXformHierarchy( const Abc::IObject & iTop );
+
+    size_t getNumNodes() const { return m_nodes.size(); }
+
+    Abc::IObject getObject( size_t iNode ) const;
+
+    //! The index of the parent of iNode, kNoParent for iTop
+    size_t getParent( size_t iNode ) const;
+
+    //! The node of the object with the full name iFullName, kNoParent if
+    //! there isn't one.
+    size_t findNode( const std::string & iFullName ) const;
+
+    //! Whether the world matrix of iNode is the same at every time.
+    bool isConstant( size_t iNode ) const;
+
+    //! Brings every world matrix up to date for iSS.
+    void evaluate( const Abc::ISampleSelector & iSS );
+
+    //! Whether the world matrix of iNode changed in the last evaluate.
+    bool hasChanged( size_t iNode ) const;
+
+    //! The world matrix of iNode as of the last evaluate.
+    const Abc::M44d & getWorldMatrix( size_t iNode ) const;
+
+    //! The world matrix of iNode at iSS.
+    const Abc::M44d & getWorldMatrix( size_t iNode,
+                                      const Abc::ISampleSelector & iSS );
+
+    //! The world matrices of every node at iSS, as a structure of arrays:
+    //! element [i][j] of the matrix of node n is at
+    //! oMatrices[( i * 4 + j ) * getNumNodes() + n].
+    void getWorldMatrices( const Abc::ISampleSelector & iSS,
+                           std::vector< double > & oMatrices );
+
+private:
+    struct Node
+    {
+        Abc::IObject object;
+
+        // only valid for xforms
+        IXformSchema xform;
+
+        size_t parent;
+
+        // whether the world matrix can change at all, and whether our own
+        // xform does
+        bool isConstant;
+        bool isAnimated;
+
+        bool inherits;
+
+        // the sample of our xform that m_local holds, -1 until it has been
+        // read
+        index_t sampleIndex;
+    };
+
+    void addNode( const Abc::IObject & iObject, size_t iParent );
+
+    void readLocal( size_t iNode, const Abc::ISampleSelector & iSS );
+
+    std::vector< Node > m_nodes;
+
+    // per node
+    std::vector< Abc::M44d > m_local;
+    std::vector< Abc::M44d > m_world;
+    std::vector< char > m_changed;
+
+    // the nodes that aren't constant, in order
+    std::vector< size_t > m_animated;
+
+    std::map< std::string, size_t > m_names;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
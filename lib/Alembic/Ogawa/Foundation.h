@@ -49,6 +49,15 @@ const Alembic::Util::uint64_t EMPTY_GROUP   = 0x0000000000000000ULL;
 const Alembic::Util::uint64_t INVALID_DATA  = 0xffffffffffffffffULL;
 const Alembic::Util::uint64_t EMPTY_DATA    = 0x8000000000000000ULL;
 
+// Data of up to INLINE_DATA_MAX_SIZE bytes may be stored directly in the
+// child table of its group instead of at its own position in the archive.
+// Such children have both the data bit and INLINE_DATA set, the size in bits
+// 56-58 and the data itself in the lowest 7 bytes.  Archives containing
+// inline data are written as version 2 so older readers won't open them.
+const Alembic::Util::uint64_t INLINE_DATA   = 0x4000000000000000ULL;
+const Alembic::Util::uint64_t INLINE_DATA_MAX_SIZE = 7;
+const Alembic::Util::uint16_t INLINE_DATA_VERSION = 2;
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -57,6 +57,10 @@ public:
     // set after freeze
     Alembic::Util::uint64_t pos;
     Alembic::Util::uint64_t size;
+
+    // holds the data itself when it was stored inline in the group
+    bool isInline;
+    char inlineData[8];
 };
 
 IData::~IData()
@@ -70,10 +74,21 @@ IData::IData(IStreamsPtr iStreams,
     mData(new IData::PrivateData(iStreams))
 {
     mData->size = 0;
+    mData->isInline = false;
 
     // strip off the top bit (indicates data) to get our seek position
     mData->pos = iPos & INVALID_GROUP;
 
+    // only archives with a new enough version can have inline data
+    if ((mData->pos & INLINE_DATA) != 0 &&
+        mData->streams->getVersion() >= INLINE_DATA_VERSION)
+    {
+        mData->isInline = true;
+        mData->size = (mData->pos >> 56) & 0x7;
+        memcpy(mData->inlineData, &mData->pos, 8);
+        return;
+    }
+
     Alembic::Util::uint64_t size = 0;
 
     // not the empty group?  then figure out our size
@@ -100,6 +115,12 @@ void IData::read(Alembic::Util::uint64_t iSize, void * iData,
         return;
     }
 
+    if (mData->isInline)
+    {
+        memcpy(iData, mData->inlineData + iOffset, iSize);
+        return;
+    }
+
     // +8 is to account for the size
     mData->streams->read(iThreadId, mData->pos + iOffset + 8, iSize, iData);
 }
@@ -114,6 +135,29 @@ Alembic::Util::uint64_t IData::getPos() const
     return mData->pos;
 }
 
+const void * IData::getMappedData() const
+{
+    if (mData->size == 0)
+    {
+        return NULL;
+    }
+
+    if (mData->isInline)
+    {
+        return mData->inlineData;
+    }
+
+    const char * file =
+        static_cast<const char *>(mData->streams->getMappedData());
+    if (!file)
+    {
+        return NULL;
+    }
+
+    // +8 is to account for the size
+    return file + mData->pos + 8;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
@@ -59,6 +59,11 @@ public:
     // Ogawa utilities to detect when this IData is shared
     Alembic::Util::uint64_t getPos() const;
 
+    // where the data is in memory if the archive is memory mapped, so it
+    // can be used without reading it, NULL otherwise.  It is only valid for
+    // as long as the archive is open.
+    const void * getMappedData() const;
+
 private:
     friend class IGroup;
     IData(IStreamsPtr iStreams, Alembic::Util::uint64_t iPos,
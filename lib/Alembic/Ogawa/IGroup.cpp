@@ -163,6 +163,37 @@ IDataPtr IGroup::getData(Alembic::Util::uint64_t iIndex,
     return child;
 }
 
+void IGroup::getAllData(std::vector< IDataPtr > & oData,
+                        std::size_t iThreadIndex)
+{
+    oData.clear();
+    if (mData->numChildren == 0)
+    {
+        return;
+    }
+
+    std::vector<Alembic::Util::uint64_t> lightVec;
+    const std::vector<Alembic::Util::uint64_t> * children = &mData->childVec;
+    if (isLight())
+    {
+        lightVec.resize(mData->numChildren);
+        mData->streams->read(iThreadIndex, mData->pos + 8,
+                             mData->numChildren * 8, &(lightVec.front()));
+        children = &lightVec;
+    }
+
+    oData.resize(mData->numChildren);
+    for (std::size_t i = 0; i < children->size(); ++i)
+    {
+        // top bit should be set for data
+        if (((*children)[i] & EMPTY_DATA) != 0)
+        {
+            oData[i].reset(new IData(mData->streams, (*children)[i],
+                                     iThreadIndex));
+        }
+    }
+}
+
 Alembic::Util::uint64_t IGroup::getNumChildren() const
 {
     return mData->numChildren;
@@ -197,6 +228,11 @@ bool IGroup::isLight() const
     return mData->numChildren != 0 && mData->childVec.empty();
 }
 
+Alembic::Util::uint64_t IGroup::getPos() const
+{
+    return mData->pos;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
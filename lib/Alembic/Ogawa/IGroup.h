@@ -58,6 +58,12 @@ public:
 
     IDataPtr getData(Alembic::Util::uint64_t iIndex, std::size_t iThreadIndex);
 
+    // Fills oData with one entry per child, reading all of the child
+    // positions at once even if this group is light.  Entries for children
+    // which are not data are left NULL.
+    void getAllData(std::vector< IDataPtr > & oData,
+                    std::size_t iThreadIndex);
+
     Alembic::Util::uint64_t getNumChildren() const;
 
     bool isChildGroup(Alembic::Util::uint64_t iIndex) const;
@@ -68,6 +74,10 @@ public:
 
     bool isLight() const;
 
+    // not really necessary for most workflows, it is used when appending to
+    // an archive to reference this group from a new one
+    Alembic::Util::uint64_t getPos() const;
+
 private:
     friend class IArchive;
     IGroup(IStreamsPtr iStreams, Alembic::Util::uint64_t iPos, bool iLight,
@@ -84,6 +84,9 @@ public:
 
     // not all streams have a size
     virtual Alembic::Util::uint64_t size() {return 0xffffffffffffffff;};
+
+    // the whole file, if it is in memory
+    virtual const void * getMappedData() const {return NULL;}
 };
 
 typedef Alembic::Util::shared_ptr<IStreamReader> IStreamReaderPtr;
@@ -562,6 +565,11 @@ public:
         return static_cast<Alembic::Util::uint64_t>(mappedRegion.len);
     }
 
+    const void * getMappedData() const
+    {
+        return mappedRegion.p;
+    }
+
     bool read(std::size_t iStream, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void* oBuf)
     {
@@ -678,7 +686,7 @@ public:
         }
 
         // if we reach here, and we're a known version, then we're valid
-        if (version == 1)
+        if (version == 1 || version == INLINE_DATA_VERSION)
         {
             reader = iReader;        // preserve the reader
             valid = true;
@@ -734,6 +742,16 @@ Alembic::Util::uint64_t IStreams::getSize()
     return mData->size;
 }
 
+const void * IStreams::getMappedData()
+{
+    if (!isValid())
+    {
+        return NULL;
+    }
+
+    return mData->reader->getMappedData();
+}
+
 void IStreams::read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
                     Alembic::Util::uint64_t iSize, void * oBuf)
 {
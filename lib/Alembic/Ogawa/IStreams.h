@@ -60,6 +60,9 @@ public:
 
     Alembic::Util::uint64_t getSize();
 
+    // the start of the file if it is memory mapped, NULL otherwise
+    const void * getMappedData();
+
     // locks on the threadId, seeks to iPos, and reads iSize bytes into oBuf
     void read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void * oBuf);
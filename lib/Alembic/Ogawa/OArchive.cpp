@@ -41,8 +41,8 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
-OArchive::OArchive(const std::string & iFileName) :
-    mStream(new OStream(iFileName))
+OArchive::OArchive(const std::string & iFileName, bool iAppend) :
+    mStream(new OStream(iFileName, iAppend))
 {
     mGroup.reset(new OGroup(mStream));
 }
@@ -61,6 +61,21 @@ bool OArchive::isValid()
     return mStream->isValid();
 }
 
+void OArchive::setDataAlignment(Alembic::Util::uint64_t iAlignment)
+{
+    mStream->setAlignment(iAlignment);
+}
+
+Alembic::Util::uint64_t OArchive::getDataAlignment() const
+{
+    return mStream->getAlignment();
+}
+
+void OArchive::setProfile(OStreamProfilePtr iProfile)
+{
+    mStream->setProfile(iProfile);
+}
+
 OGroupPtr OArchive::getGroup()
 {
     return mGroup;
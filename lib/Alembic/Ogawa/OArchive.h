@@ -48,7 +48,11 @@ namespace ALEMBIC_VERSION_NS {
 class ALEMBIC_EXPORT OArchive
 {
 public:
-    OArchive(const std::string & iFileName);
+    // With iAppend the existing archive iFileName is added to, see OStream.
+    // Its groups and data can be referenced via OGroup::addExistingGroup and
+    // OGroup::addExistingData, and getGroup becomes its new first group once
+    // everything has been written.
+    OArchive(const std::string & iFileName, bool iAppend=false);
     OArchive(std::ostream * iStream);
     ~OArchive();
 
@@ -56,6 +60,16 @@ public:
 
     bool isValid();
 
+    // Sets the alignment (in bytes, relative to the start of the archive)
+    // that OGroup::addAlignedData will pad data to, 0 (the default) turns
+    // the padding off.
+    void setDataAlignment(Alembic::Util::uint64_t iAlignment);
+
+    Alembic::Util::uint64_t getDataAlignment() const;
+
+    // See OStream::setProfile
+    void setProfile(OStreamProfilePtr iProfile);
+
 private:
     OStreamPtr mStream;
     OGroupPtr mGroup;
@@ -38,6 +38,8 @@
 #include <Alembic/Ogawa/OData.h>
 #include <Alembic/Ogawa/OStream.h>
 
+#include <Alembic/Util/Timer.h>
+
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
@@ -187,6 +189,67 @@ ODataPtr OGroup::addData(Alembic::Util::uint64_t iNumData,
     return child;
 }
 
+ODataPtr OGroup::addAlignedData(Alembic::Util::uint64_t iNumData,
+                                const Alembic::Util::uint64_t * iSizes,
+                                const void ** iDatas,
+                                Alembic::Util::uint64_t iAlignedIndex)
+{
+    if (isFrozen())
+    {
+        return ODataPtr();
+    }
+
+    Alembic::Util::uint64_t alignment = mData->stream->getAlignment();
+    if (alignment > 1 && iAlignedIndex < iNumData &&
+        iSizes[iAlignedIndex] > 0)
+    {
+        // the aligned source comes after the size and all the sources
+        // before it
+        Alembic::Util::uint64_t offset = 8;
+        for (Alembic::Util::uint64_t i = 0; i < iAlignedIndex; ++i)
+        {
+            offset += iSizes[i];
+        }
+
+        Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
+        Alembic::Util::uint64_t pad =
+            (alignment - (pos + offset) % alignment) % alignment;
+        if (pad != 0)
+        {
+            std::vector<char> padding(pad, 0);
+            mData->stream->write(&padding.front(), pad);
+        }
+    }
+
+    return addData(iNumData, iSizes, iDatas);
+}
+
+ODataPtr OGroup::addInlineData(Alembic::Util::uint64_t iSize,
+                               const void * iData)
+{
+    if (iSize == 0 || iSize > INLINE_DATA_MAX_SIZE)
+    {
+        return addData(iSize, iData);
+    }
+
+    ODataPtr child;
+    if (isFrozen())
+    {
+        return child;
+    }
+
+    Alembic::Util::uint64_t pos = 0;
+    memcpy(&pos, iData, iSize);
+    pos |= INLINE_DATA | (iSize << 56);
+
+    // there is nothing at pos in the stream, so no stream for rewrite to use
+    child.reset(new OData(OStreamPtr(), pos, iSize));
+    mData->childVec.push_back(pos | 0x8000000000000000ULL);
+    mData->stream->requireVersion(INLINE_DATA_VERSION);
+
+    return child;
+}
+
 void OGroup::addData(ODataPtr iData)
 {
     if (!isFrozen())
@@ -212,6 +275,27 @@ void OGroup::addGroup(OGroupPtr iGroup)
     }
 }
 
+ODataPtr OGroup::addExistingData(IDataPtr iData)
+{
+    ODataPtr child;
+    if (!isFrozen() && iData)
+    {
+        // there is no stream, existing data isn't ours to rewrite
+        child.reset(new OData(OStreamPtr(), iData->getPos(),
+                              iData->getSize()));
+        mData->childVec.push_back(iData->getPos() | 0x8000000000000000ULL);
+    }
+    return child;
+}
+
+void OGroup::addExistingGroup(IGroupPtr iGroup)
+{
+    if (!isFrozen() && iGroup)
+    {
+        mData->childVec.push_back(iGroup->getPos());
+    }
+}
+
 void OGroup::addEmptyGroup()
 {
     if (!isFrozen())
@@ -237,6 +321,13 @@ void OGroup::freeze()
         return;
     }
 
+    OStreamProfilePtr profile = mData->stream->getProfile();
+    double start = 0.0;
+    if (profile)
+    {
+        start = Alembic::Util::Timer::now();
+    }
+
     // we ended up not adding any children, so no need to commit this group
     // to disk, use empty group instead
     if (mData->childVec.empty())
@@ -270,6 +361,17 @@ void OGroup::freeze()
         it->first->mData->childVec[it->second] = mData->pos;
     }
 
+    if (profile)
+    {
+        double elapsed = Alembic::Util::Timer::now() - start;
+        Alembic::Util::uint64_t bytes = 0;
+        if (!mData->childVec.empty())
+        {
+            bytes = (mData->childVec.size() + 1) * 8;
+        }
+        profile->addFreeze(bytes, elapsed);
+    }
+
     mData->parents.clear();
 
 }
@@ -324,6 +426,32 @@ void OGroup::replaceData(Alembic::Util::uint64_t iIndex, ODataPtr iData)
     mData->childVec[iIndex] = pos;
 }
 
+void OGroup::replaceGroup(Alembic::Util::uint64_t iIndex, OGroupPtr iGroup)
+{
+    if (!isChildGroup(iIndex) || !iGroup || !iGroup->isFrozen())
+    {
+        return;
+    }
+
+    Alembic::Util::uint64_t pos = iGroup->mData->pos;
+    if (isFrozen())
+    {
+        mData->stream->seek(mData->pos + (iIndex + 1) * 8);
+        mData->stream->write(&pos, 8);
+    }
+    mData->childVec[iIndex] = pos;
+}
+
+OGroupPtr OGroup::replaceGroup(Alembic::Util::uint64_t iIndex)
+{
+    OGroupPtr child;
+    if (isChildGroup(iIndex))
+    {
+        child.reset(new OGroup(shared_from_this(), iIndex));
+    }
+    return child;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
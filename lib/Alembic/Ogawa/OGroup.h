@@ -40,6 +40,7 @@
 #include <Alembic/Ogawa/Foundation.h>
 #include <Alembic/Ogawa/OStream.h>
 #include <Alembic/Ogawa/OData.h>
+#include <Alembic/Ogawa/IGroup.h>
 
 namespace Alembic {
 namespace Ogawa {
@@ -79,12 +80,34 @@ public:
                         const Alembic::Util::uint64_t * iSizes,
                         const void ** iDatas);
 
+    // store the data directly in this group's child table if it is no
+    // bigger than INLINE_DATA_MAX_SIZE, otherwise this is the same as addData.
+    // The returned ODataPtr can be referenced by other groups as usual but
+    // it can not be rewritten.
+    ODataPtr addInlineData(Alembic::Util::uint64_t iSize, const void * iData);
+
+    // Same as the multiple source addData, except that if the archive has a
+    // data alignment, padding is written in front of the data so that the
+    // source at iAlignedIndex starts on an alignment boundary.  Empty sources
+    // have nothing to align and are written as is.
+    ODataPtr addAlignedData(Alembic::Util::uint64_t iNumData,
+                            const Alembic::Util::uint64_t * iSizes,
+                            const void ** iDatas,
+                            Alembic::Util::uint64_t iAlignedIndex);
+
     // reference existing data
     void addData(ODataPtr iData);
 
     // reference an existing group
     void addGroup(OGroupPtr iGroup);
 
+    // reference data that is already in the archive being appended to, the
+    // returned ODataPtr can be referenced by other groups but not rewritten
+    ODataPtr addExistingData(IDataPtr iData);
+
+    // reference a group that is already in the archive being appended to
+    void addExistingGroup(IGroupPtr iGroup);
+
     // convenience function for adding a default NULL group
     void addEmptyGroup();
 
@@ -109,14 +132,14 @@ public:
 
     void replaceData(Alembic::Util::uint64_t iIndex, ODataPtr iData);
 
-    // currently I'm going to leave this out, because a bad implementation
-    // could cause all sorts of subtle race conditions when unfrozen children
-    // are suddenly frozen.  It may also not be necessary (you can still
-    // reference an existing group)
-    // if this is necessary, an easy compromise might be that iGroup HAS to
-    // be frozen, much like how replaceData deals with something implicitly
-    // frozen
-    //void replaceGroup(Alembic::Util::uint64_t iIndex, OGroupPtr iGroup);
+    // Both iGroup and the group it replaces HAVE to be frozen, otherwise
+    // either of them could write itself into our child table later on.
+    // Nothing is done if iGroup isn't frozen.
+    void replaceGroup(Alembic::Util::uint64_t iIndex, OGroupPtr iGroup);
+
+    // create a group that takes the place of the group child iIndex once it
+    // is frozen, until then child iIndex is left as it is
+    OGroupPtr replaceGroup(Alembic::Util::uint64_t iIndex);
 
 private:
     friend class OArchive;
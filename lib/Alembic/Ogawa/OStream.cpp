@@ -34,19 +34,74 @@
 //-*****************************************************************************
 
 #include <Alembic/Ogawa/OStream.h>
+#include <Alembic/Util/Timer.h>
 #include <fstream>
+#include <cstring>
 #include <stdexcept>
 
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+OStreamProfile::OStreamProfile() :
+    mNumWrites(0), mWriteBytes(0), mWriteSeconds(0.0), mNumFreezes(0),
+    mFreezeBytes(0), mFreezeSeconds(0.0)
+{
+}
+
+void OStreamProfile::addWrite(Alembic::Util::uint64_t iBytes,
+                              double iSeconds)
+{
+    Alembic::Util::scoped_lock l(mLock);
+    mNumWrites++;
+    mWriteBytes += iBytes;
+    mWriteSeconds += iSeconds;
+}
+
+void OStreamProfile::addFreeze(Alembic::Util::uint64_t iBytes,
+                               double iSeconds)
+{
+    Alembic::Util::scoped_lock l(mLock);
+    mNumFreezes++;
+    mFreezeBytes += iBytes;
+    mFreezeSeconds += iSeconds;
+}
+
+void OStreamProfile::get(Alembic::Util::uint64_t & oNumWrites,
+                         Alembic::Util::uint64_t & oWriteBytes,
+                         double & oWriteSeconds,
+                         Alembic::Util::uint64_t & oNumFreezes,
+                         Alembic::Util::uint64_t & oFreezeBytes,
+                         double & oFreezeSeconds)
+{
+    Alembic::Util::scoped_lock l(mLock);
+    oNumWrites = mNumWrites;
+    oWriteBytes = mWriteBytes;
+    oWriteSeconds = mWriteSeconds;
+    oNumFreezes = mNumFreezes;
+    oFreezeBytes = mFreezeBytes;
+    oFreezeSeconds = mFreezeSeconds;
+}
+
+Alembic::Util::uint64_t OStreamProfile::getWriteBytes()
+{
+    Alembic::Util::scoped_lock l(mLock);
+    return mWriteBytes;
+}
+
 class OStream::PrivateData
 {
 public:
-    PrivateData(const std::string & iFileName) :
-        stream(NULL), fileName(iFileName), startPos(0), curPos(0), maxPos(0)
+    PrivateData(const std::string & iFileName, bool iAppend) :
+        stream(NULL), fileName(iFileName), startPos(0), curPos(0), maxPos(0),
+        version(1), alignment(0)
     {
+        if (iAppend)
+        {
+            openForAppend();
+            return;
+        }
+
         std::ofstream * filestream = new std::ofstream(fileName.c_str(),
             std::ios_base::trunc | std::ios_base::binary);
         if (filestream->is_open())
@@ -65,8 +120,37 @@ public:
         }
     }
 
+    // open an existing archive without truncating it, we stay invalid
+    // unless it was completely written
+    void openForAppend()
+    {
+        std::fstream * filestream = new std::fstream(fileName.c_str(),
+            std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+
+        char header[16];
+        if (!filestream->is_open() || !filestream->read(header, 16) ||
+            memcmp(header, "Ogawa", 5) != 0 || header[5] != (char)0xff)
+        {
+            filestream->close();
+            delete filestream;
+            return;
+        }
+
+        stream = filestream;
+#if defined _WIN32 || defined _WIN64
+        filestream->rdbuf()->pubsetbuf(buffer, sizeof(buffer));
+#endif
+        stream->exceptions ( std::fstream::failbit | std::fstream::badbit );
+
+        version = ((Alembic::Util::uint8_t)header[6] << 8) |
+            (Alembic::Util::uint8_t)header[7];
+        curPos = stream->seekp(0, std::ios_base::end).tellp();
+        maxPos = curPos;
+    }
+
     PrivateData(std::ostream * iStream) :
-        stream(iStream), startPos(0), curPos(0), maxPos(0)
+        stream(iStream), startPos(0), curPos(0), maxPos(0), version(1),
+        alignment(0)
     {
         if (stream)
         {
@@ -87,11 +171,17 @@ public:
         if (!fileName.empty() && stream)
         {
             std::ofstream * filestream = dynamic_cast<std::ofstream *>(stream);
+            std::fstream * appendstream = dynamic_cast<std::fstream *>(stream);
             if (filestream)
             {
                 filestream->close();
                 delete filestream;
             }
+            else if (appendstream)
+            {
+                appendstream->close();
+                delete appendstream;
+            }
         }
     }
 
@@ -103,11 +193,14 @@ public:
     Alembic::Util::uint64_t startPos;
     Alembic::Util::uint64_t curPos;
     Alembic::Util::uint64_t maxPos;
+    Alembic::Util::uint16_t version;
+    Alembic::Util::uint64_t alignment;
     Alembic::Util::mutex lock;
+    OStreamProfilePtr profile;
 };
 
-OStream::OStream(const std::string & iFileName) :
-    mData(new PrivateData(iFileName))
+OStream::OStream(const std::string & iFileName, bool iAppend) :
+    mData(new PrivateData(iFileName, iAppend))
 {
     init();
 }
@@ -123,6 +216,15 @@ OStream::~OStream()
     // write our "frozen" byte (totally done writing)
     if (isValid())
     {
+        // something needed a newer version than what we started with
+        if (mData->version != 1)
+        {
+            char version[2];
+            version[0] = (char)(mData->version >> 8);
+            version[1] = (char)(mData->version & 0xff);
+            mData->stream->seekp(mData->startPos + 6).write(version, 2);
+        }
+
         char frozen = 0xff;
         mData->stream->seekp(mData->startPos + 5).write(&frozen, 1).flush();
     }
@@ -149,7 +251,8 @@ void OStream::init()
             "Ogawa currently only supports little-endian writing.");
     }
 
-    if (isValid())
+    // anything we append to already has its header
+    if (isValid() && mData->maxPos == 0)
     {
         const char header[] = {
             'O', 'g', 'a', 'w', 'a',  // special magic number
@@ -188,17 +291,61 @@ void OStream::seek(Alembic::Util::uint64_t iPos)
     }
 }
 
+void OStream::requireVersion(Alembic::Util::uint16_t iVersion)
+{
+    Alembic::Util::scoped_lock l(mData->lock);
+    if (iVersion > mData->version)
+    {
+        mData->version = iVersion;
+    }
+}
+
+void OStream::setAlignment(Alembic::Util::uint64_t iAlignment)
+{
+    mData->alignment = iAlignment;
+}
+
+Alembic::Util::uint64_t OStream::getAlignment()
+{
+    return mData->alignment;
+}
+
+void OStream::setProfile(OStreamProfilePtr iProfile)
+{
+    Alembic::Util::scoped_lock l(mData->lock);
+    mData->profile = iProfile;
+}
+
+OStreamProfilePtr OStream::getProfile()
+{
+    Alembic::Util::scoped_lock l(mData->lock);
+    return mData->profile;
+}
+
 void OStream::write(const void * iBuf, Alembic::Util::uint64_t iSize)
 {
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
+
+        double start = 0.0;
+        if (mData->profile)
+        {
+            start = Alembic::Util::Timer::now();
+        }
+
         mData->stream->write((const char *)iBuf, iSize).flush();
         mData->curPos += iSize;
         if(mData->curPos > mData->maxPos)
         {
             mData->maxPos = mData->curPos;
         }
+
+        if (mData->profile)
+        {
+            double elapsed = Alembic::Util::Timer::now() - start;
+            mData->profile->addWrite(iSize, elapsed);
+        }
     }
 }
 
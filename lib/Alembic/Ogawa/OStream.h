@@ -49,10 +49,49 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+// Cumulative counters of the time and bytes an OStream spends writing and
+// freezing groups, see OStream::setProfile.  These are shared so that they
+// can still be looked at once the stream is gone.
+class ALEMBIC_EXPORT OStreamProfile
+{
+public:
+    OStreamProfile();
+
+    void addWrite(Alembic::Util::uint64_t iBytes, double iSeconds);
+
+    // iBytes is the size of the group table, the time also includes
+    // patching the parents of the group
+    void addFreeze(Alembic::Util::uint64_t iBytes, double iSeconds);
+
+    void get(Alembic::Util::uint64_t & oNumWrites,
+             Alembic::Util::uint64_t & oWriteBytes,
+             double & oWriteSeconds,
+             Alembic::Util::uint64_t & oNumFreezes,
+             Alembic::Util::uint64_t & oFreezeBytes,
+             double & oFreezeSeconds);
+
+    Alembic::Util::uint64_t getWriteBytes();
+
+private:
+    Alembic::Util::mutex mLock;
+    Alembic::Util::uint64_t mNumWrites;
+    Alembic::Util::uint64_t mWriteBytes;
+    double mWriteSeconds;
+    Alembic::Util::uint64_t mNumFreezes;
+    Alembic::Util::uint64_t mFreezeBytes;
+    double mFreezeSeconds;
+};
+
+typedef Alembic::Util::shared_ptr< OStreamProfile > OStreamProfilePtr;
+
 class ALEMBIC_EXPORT OStream
 {
 public:
-    OStream(const std::string & iFileName);
+    // If iAppend is true iFileName has to be an existing, cleanly closed,
+    // Ogawa archive.  Nothing already in it is overwritten, new data is
+    // written after it and the position of the new first group replaces the
+    // old one when we are done.
+    OStream(const std::string & iFileName, bool iAppend=false);
     OStream(std::ostream * iStream);
     ~OStream();
 
@@ -62,6 +101,19 @@ public:
     void write(const void * iBuf, Alembic::Util::uint64_t iSize);
     void seek(Alembic::Util::uint64_t iPos);
 
+    // make sure the format version written to the header is at least
+    // iVersion, the header is updated when we are done writing
+    void requireVersion(Alembic::Util::uint16_t iVersion);
+
+    // alignment used by OGroup::addAlignedData, 0 means no alignment
+    void setAlignment(Alembic::Util::uint64_t iAlignment);
+    Alembic::Util::uint64_t getAlignment();
+
+    // Start accumulating into iProfile how long writing takes, an empty
+    // iProfile stops it again.
+    void setProfile(OStreamProfilePtr iProfile);
+    OStreamProfilePtr getProfile();
+
 private:
     // noncopyable
     OStream(const OStream &);
@@ -37,6 +37,7 @@
 #include <Alembic/Ogawa/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 #include <iostream>
+#include <vector>
 
 void test(bool iUseMMap)
 {
@@ -185,6 +186,87 @@ void test(bool iUseMMap)
     TESTING_ASSERT(data4[6] == 6);
     TESTING_ASSERT(data4[7] == 7);
 
+    TESTING_ASSERT(ia.getVersion() == 1);
+}
+
+void testInline(bool iUseMMap)
+{
+    char data[] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+{
+    Alembic::Ogawa::OArchive oa("inlineTest.ogawa");
+    Alembic::Ogawa::OGroupPtr top = oa.getGroup();
+    Alembic::Ogawa::OGroupPtr a = top->addGroup();
+    Alembic::Ogawa::OGroupPtr b = top->addGroup();
+
+    // enough children that the group can be read light
+    Alembic::Ogawa::ODataPtr shared;
+    for (Alembic::Util::uint64_t i = 0; i < 10; ++i)
+    {
+        Alembic::Ogawa::ODataPtr d = a->addInlineData(i % 7 + 1, &(data[1]));
+        if (i == 2)
+        {
+            shared = d;
+        }
+    }
+
+    // too big to be inlined
+    b->addInlineData(8, data);
+    b->addData(shared);
+}
+
+    Alembic::Ogawa::IArchive ia("inlineTest.ogawa", 1, iUseMMap);
+    TESTING_ASSERT(ia.isValid());
+    TESTING_ASSERT(ia.getVersion() == 2);
+
+    Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+    for (int light = 0; light < 2; ++light)
+    {
+        Alembic::Ogawa::IGroupPtr a = top->getGroup(0, light == 1, 0);
+        TESTING_ASSERT(a->getNumChildren() == 10);
+        TESTING_ASSERT(a->isLight() == (light == 1));
+
+        std::vector< Alembic::Ogawa::IDataPtr > allData;
+        a->getAllData(allData, 0);
+        TESTING_ASSERT(allData.size() == 10);
+
+        for (Alembic::Util::uint64_t i = 0; i < 10; ++i)
+        {
+            Alembic::Util::uint64_t size = i % 7 + 1;
+            Alembic::Ogawa::IDataPtr d = a->getData(i, 0);
+            TESTING_ASSERT(d->getSize() == size);
+            TESTING_ASSERT(allData[i]->getSize() == size);
+
+            char readData[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+            d->read(size, readData, 0, 0);
+            for (Alembic::Util::uint64_t j = 0; j < size; ++j)
+            {
+                TESTING_ASSERT(readData[j] == data[j + 1]);
+            }
+
+            // partial reads
+            if (size > 2)
+            {
+                char c = 0;
+                d->read(1, &c, 2, 0);
+                TESTING_ASSERT(c == data[3]);
+            }
+        }
+    }
+
+    Alembic::Ogawa::IGroupPtr b = top->getGroup(1, false, 0);
+    TESTING_ASSERT(b->getNumChildren() == 2);
+    TESTING_ASSERT(b->getData(0, 0)->getSize() == 8);
+    char readData[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    b->getData(0, 0)->read(8, readData, 0, 0);
+    TESTING_ASSERT(readData[7] == 7);
+
+    Alembic::Ogawa::IDataPtr shared = b->getData(1, 0);
+    TESTING_ASSERT(shared->getSize() == 3);
+    shared->read(3, readData, 0, 0);
+    TESTING_ASSERT(readData[0] == 1);
+    TESTING_ASSERT(readData[1] == 2);
+    TESTING_ASSERT(readData[2] == 3);
 }
 
 int main ( int argc, char *argv[] )
@@ -192,5 +274,8 @@ int main ( int argc, char *argv[] )
     test(true);     // Use mmap
     test(false);    // Use streams
 
+    testInline(true);
+    testInline(false);
+
     return 0;
 }
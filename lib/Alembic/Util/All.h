@@ -45,7 +45,9 @@
 #include <Alembic/Util/Naming.h>
 #include <Alembic/Util/OperatorBool.h>
 #include <Alembic/Util/PlainOldDataType.h>
+#include <Alembic/Util/Threads.h>
 #include <Alembic/Util/TokenMap.h>
+#include <Alembic/Util/Timer.h>
 #include <Alembic/Util/SpookyV2.h>
 
 #endif
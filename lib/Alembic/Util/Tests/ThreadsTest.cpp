@@ -0,0 +1,163 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Threads.h>
+#include <Alembic/Util/Exception.h>
+
+#include <string>
+#include <vector>
+#include <assert.h>
+
+struct Summer
+{
+    Summer() : begin( 0 ), end( 0 ), sum( 0 ) {}
+
+    void run()
+    {
+        for ( size_t i = begin; i < end; ++i )
+        {
+            sum += i;
+        }
+    }
+
+    size_t begin;
+    size_t end;
+    size_t sum;
+};
+
+struct Thrower
+{
+    Thrower() : fail( false ), ran( false ) {}
+
+    void run()
+    {
+        ran = true;
+        if ( fail )
+        {
+            ALEMBIC_THROW( "Thrower failed" );
+        }
+    }
+
+    bool fail;
+    bool ran;
+};
+
+void testRunWorkers()
+{
+    using namespace Alembic::Util;
+
+    std::vector< Summer > summers( 4 );
+    for ( size_t i = 0; i < summers.size(); ++i )
+    {
+        summers[i].begin = i * 1000;
+        summers[i].end = ( i + 1 ) * 1000;
+    }
+
+    RunWorkers( summers );
+
+    size_t sum = 0;
+    for ( size_t i = 0; i < summers.size(); ++i )
+    {
+        sum += summers[i].sum;
+    }
+    assert( sum == ( 4000 * 3999 ) / 2 );
+}
+
+void testWorkerErrors()
+{
+    using namespace Alembic::Util;
+
+    // whichever worker throws, the error comes back on this thread after
+    // every worker has finished
+    for ( size_t failing = 0; failing < 4; ++failing )
+    {
+        std::vector< Thrower > throwers( 4 );
+        throwers[failing].fail = true;
+
+        bool caught = false;
+        try
+        {
+            RunWorkers( throwers );
+        }
+        catch ( Exception & e )
+        {
+            caught = std::string( e.what() ) == "Thrower failed";
+        }
+        assert( caught );
+
+        for ( size_t i = 0; i < throwers.size(); ++i )
+        {
+            assert( throwers[i].ran );
+        }
+    }
+}
+
+void testThreadJoin()
+{
+    using namespace Alembic::Util;
+
+    Thrower thrower;
+    thrower.fail = true;
+
+    Thread thread;
+    bool started = thread.start( RunWorker< Thrower >, &thrower );
+    assert( started );
+
+    bool caught = false;
+    try
+    {
+        thread.join();
+    }
+    catch ( Exception & )
+    {
+        caught = true;
+    }
+    assert( caught );
+    assert( thrower.ran );
+
+    // joining again does nothing
+    thread.join();
+}
+
+int main( int argc, char* argv[] )
+{
+    testRunWorkers();
+    testWorkerErrors();
+    testThreadJoin();
+
+    std::cout << "Success!" << std::endl;
+    return 0;
+}
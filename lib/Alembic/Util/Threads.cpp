@@ -0,0 +1,297 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Exception.h>
+#include <Alembic/Util/Threads.h>
+
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+#ifdef _MSC_VER
+
+Monitor::Monitor()
+{
+    InitializeCriticalSection( &m_cs );
+    InitializeConditionVariable( &m_cond );
+}
+
+Monitor::~Monitor() { DeleteCriticalSection( &m_cs ); }
+
+void Monitor::lock() { EnterCriticalSection( &m_cs ); }
+void Monitor::unlock() { LeaveCriticalSection( &m_cs ); }
+void Monitor::wait() { SleepConditionVariableCS( &m_cond, &m_cs, INFINITE ); }
+void Monitor::notifyAll() { WakeAllConditionVariable( &m_cond ); }
+
+#else
+
+Monitor::Monitor()
+{
+    pthread_mutex_init( &m_mutex, NULL );
+    pthread_cond_init( &m_cond, NULL );
+}
+
+Monitor::~Monitor()
+{
+    pthread_cond_destroy( &m_cond );
+    pthread_mutex_destroy( &m_mutex );
+}
+
+void Monitor::lock() { pthread_mutex_lock( &m_mutex ); }
+void Monitor::unlock() { pthread_mutex_unlock( &m_mutex ); }
+void Monitor::wait() { pthread_cond_wait( &m_cond, &m_mutex ); }
+void Monitor::notifyAll() { pthread_cond_broadcast( &m_cond ); }
+
+#endif
+
+//-*****************************************************************************
+Thread::Thread()
+    : m_function( NULL )
+    , m_data( NULL )
+    , m_started( false )
+    , m_failed( false )
+{
+}
+
+//-*****************************************************************************
+Thread::~Thread()
+{
+    if ( m_started )
+    {
+        try
+        {
+            join();
+        }
+        catch ( ... )
+        {
+        }
+    }
+}
+
+//-*****************************************************************************
+bool Thread::start( Function iFunction, void * iData )
+{
+    if ( m_started )
+    {
+        ALEMBIC_THROW( "Thread is already running." );
+    }
+
+    m_function = iFunction;
+    m_data = iData;
+    m_failed = false;
+    m_error.clear();
+
+#ifdef _MSC_VER
+    m_handle = CreateThread( NULL, 0, entry, this, 0, NULL );
+    m_started = ( m_handle != NULL );
+#else
+    m_started = ( pthread_create( &m_handle, NULL, entry, this ) == 0 );
+#endif
+
+    return m_started;
+}
+
+//-*****************************************************************************
+void Thread::join()
+{
+    if ( !m_started )
+    {
+        return;
+    }
+
+#ifdef _MSC_VER
+    WaitForSingleObject( m_handle, INFINITE );
+    CloseHandle( m_handle );
+#else
+    pthread_join( m_handle, NULL );
+#endif
+    m_started = false;
+
+    if ( m_failed )
+    {
+        m_failed = false;
+        ALEMBIC_THROW( m_error );
+    }
+}
+
+//-*****************************************************************************
+void Thread::run()
+{
+    try
+    {
+        m_function( m_data );
+    }
+    catch ( std::exception & e )
+    {
+        m_error = e.what();
+        m_failed = true;
+    }
+    catch ( ... )
+    {
+        m_error = "Unknown error on a thread";
+        m_failed = true;
+    }
+}
+
+//-*****************************************************************************
+#ifdef _MSC_VER
+DWORD WINAPI Thread::entry( LPVOID iThread )
+{
+    static_cast< Thread * >( iThread )->run();
+    return 0;
+}
+#else
+void * Thread::entry( void * iThread )
+{
+    static_cast< Thread * >( iThread )->run();
+    return NULL;
+}
+#endif
+
+//-*****************************************************************************
+std::size_t GetNumProcessors()
+{
+#ifdef _MSC_VER
+    SYSTEM_INFO info;
+    GetSystemInfo( &info );
+    long numProcessors = info.dwNumberOfProcessors;
+#else
+    long numProcessors = sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+    return numProcessors > 0 ? ( std::size_t ) numProcessors : 1;
+}
+
+//-*****************************************************************************
+std::size_t NumThreadsFor( std::size_t iNumItems,
+                           std::size_t iMinPerThread,
+                           std::size_t iNumThreads )
+{
+    std::size_t maxThreads = iNumItems / std::max( iMinPerThread,
+                                                   ( std::size_t ) 1 );
+    if ( iNumThreads == 0 )
+    {
+        iNumThreads = GetNumProcessors();
+    }
+    return std::max( std::min( iNumThreads, maxThreads ),
+                     ( std::size_t ) 1 );
+}
+
+//-*****************************************************************************
+namespace {
+
+// keeps the first error for RunOnThreads to throw once everything is done
+void RunCatching( Thread::Function iFunction, void * iData,
+                  std::string & ioError )
+{
+    try
+    {
+        iFunction( iData );
+    }
+    catch ( std::exception & e )
+    {
+        if ( ioError.empty() )
+        {
+            ioError = e.what();
+        }
+    }
+    catch ( ... )
+    {
+        if ( ioError.empty() )
+        {
+            ioError = "Unknown error on a thread";
+        }
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void RunOnThreads( Thread::Function iFunction,
+                   const std::vector< void * > & iData )
+{
+    if ( iData.empty() )
+    {
+        return;
+    }
+
+    std::string error;
+
+    std::vector< ThreadPtr > threads;
+    for ( std::size_t i = 1; i < iData.size(); ++i )
+    {
+        ThreadPtr thread( new Thread() );
+        if ( thread->start( iFunction, iData[i] ) )
+        {
+            threads.push_back( thread );
+        }
+        else
+        {
+            RunCatching( iFunction, iData[i], error );
+        }
+    }
+
+    RunCatching( iFunction, iData[0], error );
+
+    // nothing is thrown until every thread is done with iData
+    for ( std::size_t i = 0; i < threads.size(); ++i )
+    {
+        try
+        {
+            threads[i]->join();
+        }
+        catch ( std::exception & e )
+        {
+            if ( error.empty() )
+            {
+                error = e.what();
+            }
+        }
+    }
+
+    if ( !error.empty() )
+    {
+        ALEMBIC_THROW( error );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,184 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_Util_Threads_h
+#define Alembic_Util_Threads_h
+
+#include <Alembic/Util/Foundation.h>
+
+#ifndef _MSC_VER
+#include <pthread.h>
+#endif
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A mutex and a single condition to wait on with it.  Util::mutex doesn't
+//! give access to what a condition needs, and std::condition_variable isn't
+//! there for builds that use boost or TR1.
+class ALEMBIC_EXPORT Monitor : noncopyable
+{
+public:
+    Monitor();
+    ~Monitor();
+
+    void lock();
+    void unlock();
+
+    //! Must be called with the monitor locked.
+    void wait();
+
+    void notifyAll();
+
+private:
+#ifdef _MSC_VER
+    CRITICAL_SECTION m_cs;
+    CONDITION_VARIABLE m_cond;
+#else
+    pthread_mutex_t m_mutex;
+    pthread_cond_t m_cond;
+#endif
+};
+
+//-*****************************************************************************
+class MonitorLock : noncopyable
+{
+public:
+    MonitorLock( Monitor & iMonitor ) : m_monitor( iMonitor )
+    {
+        m_monitor.lock();
+    }
+
+    ~MonitorLock()
+    {
+        m_monitor.unlock();
+    }
+
+private:
+    Monitor & m_monitor;
+};
+
+//-*****************************************************************************
+//! A thread running a single function.  Anything the function throws is
+//! caught on the thread and thrown again from join().
+class ALEMBIC_EXPORT Thread : noncopyable
+{
+public:
+    typedef void ( *Function )( void * iData );
+
+    Thread();
+
+    //! Waits for the thread if it was never joined, dropping any error.
+    ~Thread();
+
+    //! Starts running iFunction( iData ), false if no thread could be made.
+    bool start( Function iFunction, void * iData );
+
+    //! Waits for the thread to finish, throwing an Exception with the
+    //! message of anything the function threw.
+    void join();
+
+private:
+#ifdef _MSC_VER
+    static DWORD WINAPI entry( LPVOID iThread );
+    HANDLE m_handle;
+#else
+    static void * entry( void * iThread );
+    pthread_t m_handle;
+#endif
+
+    void run();
+
+    Function m_function;
+    void * m_data;
+    bool m_started;
+    bool m_failed;
+    std::string m_error;
+};
+
+typedef Alembic::Util::shared_ptr< Thread > ThreadPtr;
+
+//-*****************************************************************************
+//! The number of processors that are online, at least 1.
+ALEMBIC_EXPORT std::size_t GetNumProcessors();
+
+//-*****************************************************************************
+//! How many threads to split iNumItems over so that each gets at least
+//! iMinPerThread of them, at most iNumThreads or the number of processors if
+//! that is 0.
+ALEMBIC_EXPORT std::size_t NumThreadsFor( std::size_t iNumItems,
+                                          std::size_t iMinPerThread,
+                                          std::size_t iNumThreads );
+
+//-*****************************************************************************
+//! Calls iFunction on every one of iData, each on its own thread.  The first
+//! is done on the calling thread, as is any we couldn't get a thread for.
+//! Everything is finished before this returns, if anything threw then an
+//! Exception with the first message is thrown afterwards.
+ALEMBIC_EXPORT void RunOnThreads( Thread::Function iFunction,
+                                  const std::vector< void * > & iData );
+
+//-*****************************************************************************
+template < class WORKER >
+void RunWorker( void * iWorker )
+{
+    static_cast< WORKER * >( iWorker )->run();
+}
+
+//-*****************************************************************************
+//! Runs every one of ioWorkers, anything with a run() method doing its own
+//! part of the work, each on its own thread.  See RunOnThreads.
+template < class WORKER >
+void RunWorkers( std::vector< WORKER > & ioWorkers )
+{
+    std::vector< void * > data( ioWorkers.size() );
+    for ( std::size_t i = 0; i < ioWorkers.size(); ++i )
+    {
+        data[i] = &ioWorkers[i];
+    }
+    RunOnThreads( RunWorker< WORKER >, data );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,95 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2020,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_Util_Timer_h
+#define Alembic_Util_Timer_h
+
+#include <Alembic/Util/Foundation.h>
+
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+#include <chrono>
+#elif !defined(_MSC_VER)
+#include <time.h>
+#endif
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Measures the wall clock time since it was made or last reset, in seconds,
+//! with a monotonic clock.  It doesn't need C++11, so it can be used by
+//! builds that use boost or TR1 as well.
+class Timer
+{
+public:
+    Timer() { reset(); }
+
+    void reset() { m_start = now(); }
+
+    double elapsed() const { return now() - m_start; }
+
+    //! Seconds since some point in the past, only good for differences.
+    static double now()
+    {
+#if !defined(ALEMBIC_LIB_USES_BOOST) && !defined(ALEMBIC_LIB_USES_TR1)
+        std::chrono::duration< double > d =
+            std::chrono::steady_clock::now().time_since_epoch();
+        return d.count();
+#elif defined(_MSC_VER)
+        LARGE_INTEGER count, frequency;
+        QueryPerformanceCounter( &count );
+        QueryPerformanceFrequency( &frequency );
+        return ( double ) count.QuadPart / ( double ) frequency.QuadPart;
+#else
+        struct timespec t;
+        clock_gettime( CLOCK_MONOTONIC, &t );
+        return ( double ) t.tv_sec + ( double ) t.tv_nsec * 1e-9;
+#endif
+    }
+
+private:
+    double m_start;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif